@@ -83,7 +83,7 @@ namespace
 #endif
     }
 
-    bool compareRenderers(std::map<std::string, tgui::ObjectConverter> themePropertyValuePairs, std::map<std::string, tgui::ObjectConverter> widgetPropertyValuePairs)
+    bool compareRenderers(tgui::RendererPropertyValues themePropertyValuePairs, tgui::RendererPropertyValues widgetPropertyValuePairs)
     {
         for (auto themeIt = themePropertyValuePairs.begin(); themeIt != themePropertyValuePairs.end(); ++themeIt)
         {
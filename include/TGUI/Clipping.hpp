@@ -28,6 +28,7 @@
 
 #include <TGUI/Global.hpp>
 #include <TGUI/Vector2f.hpp>
+#include <TGUI/FloatRect.hpp>
 #include <SFML/Graphics/RenderTarget.hpp>
 #include <SFML/Graphics/View.hpp>
 
@@ -68,11 +69,25 @@ namespace tgui
         static void setGuiView(const sf::View& view);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the area that can currently be drawn to on the target, taking the active clipping into account
+        ///
+        /// @param target  Target to which we are drawing
+        ///
+        /// @return Clip rectangle in the coordinates of the current view
+        ///
+        /// Containers can use this to skip drawing child widgets whose bounds, after being transformed by the render states,
+        /// don't intersect with the returned rectangle. When the view is rotated, the bounding box of the view is returned.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static FloatRect getClipRect(const sf::RenderTarget& target);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     private:
 
         sf::RenderTarget& m_target;
         sf::View m_oldView;
+        bool m_viewChanged = false;
 
         static sf::View m_originalView;
     };
@@ -28,6 +28,8 @@
 
 
 #include <list>
+#include <unordered_map>
+#include <cstdint>
 
 #include <TGUI/Widget.hpp>
 
@@ -295,6 +297,32 @@ namespace tgui
         void moveWidgetToBack(const Widget::Ptr& widget);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Enables or disables the grid that is used to speed up finding the child widget below the mouse
+        ///
+        /// @param cellSize  Width and height of a single cell of the grid, or 0 to disable the grid
+        ///
+        /// By default, every widget in the container is checked when searching for the widget below the mouse. In a container
+        /// with many widgets, the children can instead be stored in a grid so that only the widgets overlapping with the
+        /// cell below the mouse have to be checked. A good cell size is about the size of a typical child widget.
+        ///
+        /// @warning When the grid is enabled, a child widget can only be found while the mouse is inside the rectangle
+        ///          formed by its position and full size. Widgets that react to the mouse outside that area (e.g. the open
+        ///          menus of a MenuBar) should be placed in a container without a grid.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setSpatialIndexCellSize(float cellSize);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the size of the cells of the grid that is used to find the child widget below the mouse
+        ///
+        /// @return Width and height of a single cell, or 0 when the grid is disabled
+        ///
+        /// @see setSpatialIndexCellSize
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        float getSpatialIndexCellSize() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Focuses the next widget in this container
         /// @return Whether a new widget was focused
@@ -327,6 +355,20 @@ namespace tgui
         void childWidgetFocused(const Widget::Ptr& child);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// Called when the position or size of one of the child widgets of this container may have changed.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void childWidgetBoundsChanged(const Widget* child);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// Called when child widgets are added, removed or reordered. The grid of child widgets will be rebuilt when needed.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void invalidateSpatialIndex();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @internal
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -398,10 +440,10 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Function called when one of the properties of the renderer is changed
         ///
-        /// @param property  Lowercase name of the property that was changed
+        /// @param property  Id of the property that was changed
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void rendererChanged(const std::string& property) override;
+        void rendererChanged(RendererProperty property) override;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -441,6 +483,30 @@ namespace tgui
         bool tryFocusWidget(const tgui::Widget::Ptr &widget, bool reverseWidgetOrder);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the index of the widget below the mouse, or the amount of widgets when no enabled widget lies below the mouse
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t findWidgetIndexBelowMouse(Vector2f mousePos);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Brings the grid of child widgets up-to-date. Returns false when the grid is disabled.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool updateSpatialIndex();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Adds the child widget at the given index to the cells of the grid that it overlaps
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void insertInSpatialIndex(std::size_t index);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Removes the child widget at the given index from the cells of the grid in which it was stored
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void removeFromSpatialIndex(std::size_t index);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
@@ -459,6 +525,34 @@ namespace tgui
         bool m_isolatedFocus = false;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        // Cells of the grid that are occupied by a child widget, remembered to remove the widget again when it moves
+        struct SpatialIndexEntry
+        {
+            std::size_t index = 0;
+            int left = 0;
+            int top = 0;
+            int right = 0;
+            int bottom = 0;
+            bool large = false;
+            bool pending = false;
+        };
+
+        float m_spatialIndexCellSize = 0;
+        bool m_spatialIndexDirty = true;
+
+        // Indices of the child widgets per cell, sorted from back to front
+        std::unordered_map<std::uint64_t, std::vector<std::size_t>> m_spatialIndexCells;
+
+        // Widgets that cover too many cells are not stored in the grid but are always checked
+        std::vector<std::size_t> m_spatialIndexLargeWidgets;
+
+        std::unordered_map<const Widget*, SpatialIndexEntry> m_spatialIndexEntries;
+        std::vector<const Widget*> m_spatialIndexPendingWidgets;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     };
 
@@ -502,6 +596,12 @@ namespace tgui
         void setFocused(bool focused) override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Informs the gui that one of its widgets changed and that it has to be drawn again
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void invalidate() override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Returns whether the mouse position (which is relative to the parent widget) lies on top of the widget
         ///
@@ -537,6 +637,9 @@ namespace tgui
 
         friend class Gui; // Required to let Gui access protected members from container and Widget
 
+        // Did any widget change since the gui was last drawn?
+        bool m_redrawNeeded = true;
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     };
 
@@ -32,11 +32,85 @@
 #include <string>
 #include <cstddef>
 #include <memory>
+#include <array>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
 {
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @internal
+    /// @brief Lookup tables with the advances and kerning of the glyphs of a font at a specific character size and style
+    ///
+    /// Measuring text with this table only has to ask the font for the glyphs in the Latin-1 range the first time they are
+    /// used, other characters are always taken from the font.
+    /// The table is obtained with Font::getGlyphAdvanceTable and remains valid while the font exists.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API GlyphAdvanceTable
+    {
+    public:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the horizontal offset to move to the next character
+        ///
+        /// @param codePoint  Unicode code point of the character
+        ///
+        /// @return Advance of the glyph, in pixels
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        float getAdvance(std::uint32_t codePoint) const
+        {
+            if ((codePoint < m_advances.size()) && (m_advances[codePoint] >= 0))
+                return m_advances[codePoint];
+            else
+                return loadAdvance(codePoint);
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the kerning offset of two glyphs
+        ///
+        /// @param first   Unicode code point of the first character
+        /// @param second  Unicode code point of the second character
+        ///
+        /// @return Kerning value for first and second, in pixels
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        float getKerning(std::uint32_t first, std::uint32_t second) const
+        {
+            if ((first < m_kerning.size()) && (second < m_kerning.size()) && m_kerning[first])
+                return (*m_kerning[first])[second];
+            else
+                return loadKerning(first, second);
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        GlyphAdvanceTable(const sf::Font& font, unsigned int characterSize, bool bold);
+
+        // Asks the font for the advance of a glyph and stores it when it lies inside the table
+        float loadAdvance(std::uint32_t codePoint) const;
+
+        // Asks the font for the kerning with all characters in the table when the first character lies inside the table
+        float loadKerning(std::uint32_t first, std::uint32_t second) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        const sf::Font& m_font;
+        unsigned int m_characterSize;
+        bool m_bold;
+
+        // Advances are negative until they are loaded. Kerning is loaded per first character, for all second characters.
+        mutable std::array<float, 256> m_advances;
+        mutable std::array<std::unique_ptr<std::array<float, 256>>, 256> m_kerning;
+
+        friend class Font;
+    };
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     class TGUI_API Font
@@ -229,6 +303,21 @@ namespace tgui
         float getLineSpacing(unsigned int characterSize) const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Returns the lookup table to quickly measure text with this font
+        ///
+        /// @param characterSize  Size of the characters
+        /// @param bold           Measure the bold version or the regular one?
+        ///
+        /// @return Table with the advances and kerning of the glyphs, which is shared by all Font objects with the same font
+        ///
+        /// The font must not be a nullptr.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const GlyphAdvanceTable& getGlyphAdvanceTable(unsigned int characterSize, bool bold) const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     private:
 
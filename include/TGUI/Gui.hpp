@@ -29,6 +29,7 @@
 
 #include <TGUI/Container.hpp>
 #include <SFML/Graphics/RenderWindow.hpp>
+#include <SFML/Graphics/RenderTexture.hpp>
 #include <queue>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -177,6 +178,52 @@ namespace tgui
         void draw();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether any widget changed since the last time the gui was drawn
+        ///
+        /// @return Has the gui changed since the last draw call?
+        ///
+        /// This function updates the time of the widgets, so that animations and blinking carets can request a redraw.
+        /// When it returns false, drawing the gui again would give the same result, so applications that only draw the gui
+        /// can skip clearing, drawing and displaying the window for this frame.
+        ///
+        /// Widgets invalidate themselves when a setter changes what they draw. Only changes that bypass the widget, such as
+        /// drawing on a texture that is still being used by a widget, require a call to Widget::invalidate or Gui::invalidate.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isRedrawNeeded();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Marks the gui as changed, so that isRedrawNeeded returns true and retained rendering redraws the widgets
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void invalidate();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether the drawn widgets are kept in a render texture and only redrawn when something changed
+        ///
+        /// @param enabled  Should retained rendering be used?
+        ///
+        /// When enabled, the draw function renders the widgets to a render texture of the same size as the target and only
+        /// updates it when isRedrawNeeded would return true. Other frames only draw the texture on the target.
+        ///
+        /// Retained rendering is disabled by default.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setRetainedRenderingEnabled(bool enabled);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether the drawn widgets are kept in a render texture and only redrawn when something changed
+        ///
+        /// @return Is retained rendering used?
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isRetainedRenderingEnabled() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Returns the internal container of the Gui
         ///
@@ -420,6 +467,18 @@ namespace tgui
         void init();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Passes the time since the last call to the widgets, unless the window doesn't have focus
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateTimeFromClock();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Redraws the widgets on the render texture when needed. Returns false when the render texture couldn't be created.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool updateRenderTexture();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
       protected:
 
@@ -447,6 +506,9 @@ namespace tgui
 
         bool m_TabKeyUsageEnabled = true;
 
+        // Render texture that contains the drawn widgets when retained rendering is used
+        std::unique_ptr<sf::RenderTexture> m_renderTexture;
+
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     };
@@ -0,0 +1,98 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2019 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#ifndef TGUI_ITEM_DATA_PROVIDER_HPP
+#define TGUI_ITEM_DATA_PROVIDER_HPP
+
+#include <TGUI/Global.hpp>
+#include <SFML/System/String.hpp>
+#include <memory>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Interface through which a ListView or ListBox can read items that are stored outside the widget
+    ///
+    /// When a data provider is set, the widget no longer keeps its own copy of the items. It only asks for the texts of the
+    /// rows that it has to draw or return. The widget doesn't know when your data changes, so after changing it you have to
+    /// call notifyItemsInserted, notifyItemsRemoved or notifyItemsChanged on the widget.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API ItemDataProvider
+    {
+    public:
+
+        typedef std::shared_ptr<ItemDataProvider> Ptr; ///< Shared data provider pointer
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Virtual destructor
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual ~ItemDataProvider() = default;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the amount of rows that the widget should display
+        ///
+        /// @return Number of rows
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual std::size_t getRowCount() const = 0;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the text that should be shown in a cell
+        ///
+        /// @param row     Index of the row, which is always smaller than the value returned by getRowCount()
+        /// @param column  Index of the column. A ListBox only has a single column, which has index 0.
+        ///
+        /// @return Text of the cell
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual sf::String getCellText(std::size_t row, std::size_t column) const = 0;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the id of a row
+        ///
+        /// The row index is always smaller than the value returned by getRowCount().
+        ///
+        /// @return Id of the row, which is passed to the ListBox signals. The default implementation returns an empty string.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual sf::String getRowId(std::size_t) const
+        {
+            return "";
+        }
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_ITEM_DATA_PROVIDER_HPP
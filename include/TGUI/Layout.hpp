@@ -32,6 +32,7 @@
 #include <functional>
 #include <memory>
 #include <string>
+#include <vector>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -39,6 +40,7 @@ namespace tgui
 {
     class Gui;
     class Widget;
+    class Container;
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     /// @brief Class to store the left, top, width or height of a widget
@@ -120,7 +122,7 @@ namespace tgui
         /// @internal
         /// @brief Constructs the layout with a mathematical operation between two other layouts
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        explicit Layout(Operation operation, std::unique_ptr<Layout> leftOperand, std::unique_ptr<Layout> rightOperand);
+        explicit Layout(Operation operation, const Layout& leftOperand, const Layout& rightOperand);
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -165,10 +167,7 @@ namespace tgui
         ///
         /// @return Value of the layout
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        bool isConstant() const
-        {
-            return m_operation == Operation::Value;
-        }
+        bool isConstant() const;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -180,6 +179,31 @@ namespace tgui
         std::string toString() const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Postpones updating layouts that depend on the position or size of other widgets
+        ///
+        /// By default, changing the position or size of a widget immediately recalculates all layouts that are bound to it,
+        /// which may resize the same widget many times when the bindings form a diamond (e.g. "parent.width - other.width").
+        /// Between beginDeferredRecalculation and endDeferredRecalculation, such changes only mark the layouts as dirty.
+        /// When the outermost endDeferredRecalculation is called, every dirty layout is evaluated once, after all layouts
+        /// that it depends on have been evaluated.
+        ///
+        /// Calls can be nested. Gui::setView uses this internally so that resizing the window updates each widget only once.
+        ///
+        /// @warning Until endDeferredRecalculation is called, the positions and sizes of widgets that use bound layouts
+        ///          may still have their old values.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void beginDeferredRecalculation();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Ends the scope started with beginDeferredRecalculation and updates all layouts that were marked as dirty
+        ///
+        /// @see beginDeferredRecalculation
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void endDeferredRecalculation();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @internal
         /// @brief Provides the layout access to the widget (and its parent) which allows searching potentially referred widgets
@@ -194,57 +218,113 @@ namespace tgui
         /// @internal
         /// @brief If the layout has bound a widget and the widget gets destroyed, this function is called
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void unbindWidget();
+        void unbindWidget(Widget* widget);
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @internal
-        /// @brief Recalculate the value of the layout based on the operation it contains and tell the parent layout to
-        ///        do the same when the value of the layout has changed.
+        /// @brief Recalculate the value of the layout from the bound widgets and inform the connected widget when the value
+        ///        of the layout has changed.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void recalculateValue();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Called by the bound widget when its position or size changed
+        ///
+        /// The value is recalculated immediately, unless recalculations are being deferred, in which case the layout is marked
+        /// as dirty and will be evaluated when endDeferredRecalculation is called.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void boundWidgetChanged();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     private:
 
+        // Compiled expression, which is shared between all layouts that were created from the same expression
+        struct Program;
+
+        // Widget referred to by a binding in the program. Each layout has its own bindings, as the same expression string
+        // refers to different widgets depending on the widget to which the layout is connected.
+        struct Binding
+        {
+            Operation operation = Operation::BindingString; // Which value of the widget is used
+            Widget* widget = nullptr; // Bound widget, nullptr when the widget wasn't found or was destroyed
+            float value = 0; // Value of the bound widget when the layout was last evaluated
+        };
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Calls the callback function of the connected widget to inform it that the value has changed
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void notifyConnectedWidget();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Reads the values of the bound widgets and evaluates the program, without informing the connected widget
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void calculateValue();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Evaluates the layouts of the widgets that this layout depends on and then this layout itself if it is dirty
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void recalculateInDependencyOrder(unsigned int pass);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Evaluates the dirty layouts of the bound widgets
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void recalculateDependencies(unsigned int pass);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Evaluates all dirty layouts, called when the outermost deferred recalculation scope ends
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void recalculateDirtyLayouts();
+
+
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        // If a widget is bound, inform it that the layout no longer binds it
+        // Informs the bound widgets that the layout no longer binds them
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void unbindLayout();
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        // Resets the parent pointers of the left and right operands if they exist and tell the bound widget that this layout
-        // requires information about changes to its position or size when the operation requires a widget to be bound.
+        // Tells the bound widgets that this layout requires information about changes to their position or size
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void resetPointers();
+        void bindLayout();
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        // Check whether sublayouts contain a string that refers to a widget which should be bound.
+        // Forgets the widgets that were found from binding strings, the same name may refer to a different widget for a copy
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void parseBindingStringRecursive(Widget* widget, bool xAxis);
+        void resetBindingStrings();
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Find the widget corresponding to the given name and bind it if found
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void parseBindingString(const std::string& expression, Widget* widget, bool xAxis);
+        static void parseBindingString(const std::string& expression, Widget* widget, bool xAxis, Binding& binding);
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     private:
 
         float m_value = 0;
-        Layout* m_parent = nullptr;
-        Operation m_operation = Operation::Value;
-        std::unique_ptr<Layout> m_leftOperand = nullptr; // The left operand of the operation in case the operation is a math operation
-        std::unique_ptr<Layout> m_rightOperand = nullptr; // The left operand of the operation in case the operation is a math operation
-        Widget* m_boundWidget = nullptr; // The widget on which this layout depends in case the operation is a binding
-        std::string m_boundString; // String referring  to a widget on which this layout depends in case the layout was created from a string and contains a binding operation
-        std::function<void()> m_connectedWidgetCallback = nullptr; // Function to call when the value of the layout changes in case the layout and sublayouts are not all constants
+        std::shared_ptr<const Program> m_program; // Compiled expression, nullptr when the layout is a constant
+        std::vector<Binding> m_bindings; // The widgets that are used by the bindings in the program
+        std::function<void()> m_connectedWidgetCallback = nullptr; // Function to call when the value of the layout changes in case the layout is not a constant
+        Widget* m_connectedWidget = nullptr; // Widget that was passed to connectWidget, reset when a different layout is assigned
+        Container* m_connectedParent = nullptr; // Parent of the connected widget at the moment the binding strings were searched
+
+        // State used for deferred recalculation, these are never copied to other layouts
+        bool m_dirty = false; // Layout has to be evaluated when the deferred recalculation ends
+        bool m_queued = false; // Layout is stored in the list of dirty layouts
+        bool m_evaluating = false; // The dependencies of this layout are currently being evaluated
+        unsigned int m_evaluatedPass = 0; // Last recalculation pass in which this layout was evaluated
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     };
@@ -68,6 +68,27 @@ namespace tgui
         void load(const std::string& primary);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Starts a transaction on all renderers in the theme
+        ///
+        /// Until commitTransaction is called, widgets using one of the renderers are not notified about property changes.
+        /// When the transaction is committed, each widget receives all the changes to its renderer at once.
+        /// This is useful when changing many properties (e.g. by calling load multiple times or by changing the renderers
+        /// manually) while many widgets are using the theme.
+        ///
+        /// @see WidgetRenderer::beginTransaction
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void beginTransaction();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Ends a transaction that was started with beginTransaction and notifies the widgets about the changes
+        ///
+        /// Only the renderers that were part of the theme when beginTransaction was called are part of the transaction.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void commitTransaction();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Gets data for the renderers
         ///
@@ -166,6 +187,9 @@ namespace tgui
         static std::shared_ptr<BaseThemeLoader> m_themeLoader;  ///< Theme loader which will do the actual loading
         std::map<std::string, std::shared_ptr<RendererData>> m_renderers; ///< Maps ids to renderer datas
         std::string m_primary;
+
+        unsigned int m_transactionDepth = 0;
+        std::vector<std::shared_ptr<RendererData>> m_transactionRenderers; ///< Renderers that were in the theme when the transaction started
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,163 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2019 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#ifndef TGUI_RENDER_BATCH_HPP
+#define TGUI_RENDER_BATCH_HPP
+
+#include <TGUI/Config.hpp>
+#include <SFML/Graphics/RenderTarget.hpp>
+#include <SFML/Graphics/RenderStates.hpp>
+#include <SFML/Graphics/Shape.hpp>
+#include <SFML/Graphics/Vertex.hpp>
+#include <vector>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Collects the triangles drawn to a render target, so that they can be drawn with less draw calls
+    ///
+    /// While the batch exists, triangles passed to RenderBatch::draw are not drawn immediately. Consecutive triangles that use
+    /// the same texture and blend mode are stored in a single vertex array, which is drawn when a different texture or blend
+    /// mode is needed, when something has to be drawn that can't be merged, when the clipping changes or when the batch is
+    /// destroyed. Triangles that are drawn with a shader are never merged.
+    ///
+    /// Containers create a batch while drawing their widgets. The draw function of a widget should therefore never call
+    /// target.draw itself, but pass everything to RenderBatch::draw so that it ends up on top of what was drawn before it.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API RenderBatch
+    {
+    public:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Starts collecting the triangles that are drawn to the target
+        ///
+        /// @param target   Target to which the triangles are drawn
+        /// @param enabled  Should the triangles be collected? When false, everything is drawn immediately until this object
+        ///                 is destroyed, even when a batch was already active.
+        ///
+        /// When a batch for the same target is already active, the triangles are added to that batch instead.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        explicit RenderBatch(sf::RenderTarget& target, bool enabled = true);
+
+
+        // The batch cannot be copied
+        RenderBatch(const RenderBatch&) = delete;
+        RenderBatch& operator=(const RenderBatch&) = delete;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Draws the collected triangles and reactivates the batch that was active when this one was created
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        ~RenderBatch();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Draws vertices to the target, or adds them to the active batch
+        ///
+        /// @param target       Target to draw to
+        /// @param vertices     Pointer to the vertices
+        /// @param vertexCount  Number of vertices in the array
+        /// @param type         Type of primitives to draw, only Triangles and TrianglesStrip can be added to the batch
+        /// @param states       Render states to use for drawing
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void draw(sf::RenderTarget& target, const sf::Vertex* vertices, std::size_t vertexCount,
+                         sf::PrimitiveType type, const sf::RenderStates& states = sf::RenderStates::Default);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Draws a shape to the target, or adds it to the active batch
+        ///
+        /// @param target  Target to draw to
+        /// @param shape   Convex shape to draw, it can only be added to the batch when it has no texture and no outline
+        /// @param states  Render states to use for drawing
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void draw(sf::RenderTarget& target, const sf::Shape& shape, const sf::RenderStates& states = sf::RenderStates::Default);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Draws a drawable object to the target after drawing the triangles that were collected for it
+        ///
+        /// @param target    Target to draw to
+        /// @param drawable  Object to draw
+        /// @param states    Render states to use for drawing
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void draw(sf::RenderTarget& target, const sf::Drawable& drawable, const sf::RenderStates& states = sf::RenderStates::Default);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Draws the triangles that were collected for the target
+        ///
+        /// @param target  Target of which the collected triangles should be drawn
+        ///
+        /// This has to be called before changing anything about the target (e.g. its view) while a batch may be active.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void flush(sf::RenderTarget& target);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns how many times a draw function of the render target was called via the batch
+        ///
+        /// @return Amount of draw calls since the program started
+        ///
+        /// This is meant for measuring how well the geometry of the widgets can be merged.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static std::size_t getDrawCallCount();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        // Returns the batch that collects the geometry for the target after making sure that it uses the texture and blend
+        // mode from the render states, or nullptr when the geometry has to be drawn immediately
+        static RenderBatch* getBatch(const sf::RenderTarget& target, const sf::RenderStates& states);
+
+        // Draws the collected triangles and clears them
+        void flush();
+
+        // Adds the vertices to the batch, they must use the same render states as the vertices that are already in it
+        void addTriangles(const sf::Vertex* vertices, std::size_t vertexCount, sf::PrimitiveType type, const sf::Transform& transform);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        sf::RenderTarget& m_target;
+        RenderBatch* m_previousBatch = nullptr; // Batch that was active when this one was created
+        bool m_nested = false; // Another batch for the same target was already active, so this object doesn't do anything
+
+        std::vector<sf::Vertex> m_vertices; // Collected triangles, with the transform already applied
+        const sf::Texture* m_texture = nullptr;
+        sf::BlendMode m_blendMode;
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_RENDER_BATCH_HPP
@@ -0,0 +1,218 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2019 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef TGUI_RENDERER_PROPERTY_HPP
+#define TGUI_RENDERER_PROPERTY_HPP
+
+
+#include <TGUI/Config.hpp>
+#include <string>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Properties that are used by the renderers of TGUI, sorted on their lowercase name
+#define TGUI_RENDERER_PROPERTIES(X) \
+    X(ArrowBackgroundColor) \
+    X(ArrowBackgroundColorHover) \
+    X(ArrowColor) \
+    X(ArrowColorHover) \
+    X(BackgroundColor) \
+    X(BackgroundColorChecked) \
+    X(BackgroundColorCheckedDisabled) \
+    X(BackgroundColorCheckedHover) \
+    X(BackgroundColorDisabled) \
+    X(BackgroundColorDown) \
+    X(BackgroundColorFocused) \
+    X(BackgroundColorHover) \
+    X(BorderBelowTitleBar) \
+    X(BorderBetweenArrows) \
+    X(BorderColor) \
+    X(BorderColorChecked) \
+    X(BorderColorCheckedDisabled) \
+    X(BorderColorCheckedFocused) \
+    X(BorderColorCheckedHover) \
+    X(BorderColorDisabled) \
+    X(BorderColorDown) \
+    X(BorderColorFocused) \
+    X(BorderColorHover) \
+    X(Borders) \
+    X(Button) \
+    X(CaretColor) \
+    X(CaretColorFocused) \
+    X(CaretColorHover) \
+    X(CaretWidth) \
+    X(CheckColor) \
+    X(CheckColorDisabled) \
+    X(CheckColorHover) \
+    X(CloseButton) \
+    X(DefaultTextColor) \
+    X(DefaultTextStyle) \
+    X(DistanceToSide) \
+    X(FillColor) \
+    X(Font) \
+    X(GridLinesColor) \
+    X(HeaderBackgroundColor) \
+    X(HeaderTextColor) \
+    X(ImageRotation) \
+    X(ListBox) \
+    X(MaximizeButton) \
+    X(MinimizeButton) \
+    X(MinimumResizableBorderWidth) \
+    X(Opacity) \
+    X(OpacityDisabled) \
+    X(Padding) \
+    X(PaddingBetweenButtons) \
+    X(Scrollbar) \
+    X(ScrollbarWidth) \
+    X(SelectedBackgroundColor) \
+    X(SelectedBackgroundColorHover) \
+    X(SelectedTextBackgroundColor) \
+    X(SelectedTextColor) \
+    X(SelectedTextColorHover) \
+    X(SelectedTextStyle) \
+    X(SelectedTrackColor) \
+    X(SelectedTrackColorHover) \
+    X(SeparatorColor) \
+    X(ShowTextOnTitleButtons) \
+    X(SpaceBetweenWidgets) \
+    X(TextColor) \
+    X(TextColorChecked) \
+    X(TextColorCheckedDisabled) \
+    X(TextColorCheckedHover) \
+    X(TextColorDisabled) \
+    X(TextColorDown) \
+    X(TextColorFilled) \
+    X(TextColorFocused) \
+    X(TextColorHover) \
+    X(TextDistanceRatio) \
+    X(TextStyle) \
+    X(TextStyleChecked) \
+    X(TextStyleDisabled) \
+    X(TextStyleDown) \
+    X(TextStyleFocused) \
+    X(TextStyleHover) \
+    X(Texture) \
+    X(TextureArrow) \
+    X(TextureArrowDown) \
+    X(TextureArrowDownHover) \
+    X(TextureArrowHover) \
+    X(TextureArrowUp) \
+    X(TextureArrowUpHover) \
+    X(TextureBackground) \
+    X(TextureBranchCollapsed) \
+    X(TextureBranchExpanded) \
+    X(TextureChecked) \
+    X(TextureCheckedDisabled) \
+    X(TextureCheckedFocused) \
+    X(TextureCheckedHover) \
+    X(TextureDisabled) \
+    X(TextureDisabledTab) \
+    X(TextureDown) \
+    X(TextureFill) \
+    X(TextureFocused) \
+    X(TextureForeground) \
+    X(TextureHover) \
+    X(TextureItemBackground) \
+    X(TextureLeaf) \
+    X(TextureSelectedItemBackground) \
+    X(TextureSelectedTab) \
+    X(TextureSelectedTabHover) \
+    X(TextureTab) \
+    X(TextureTabHover) \
+    X(TextureThumb) \
+    X(TextureThumbHover) \
+    X(TextureTitleBar) \
+    X(TextureTrack) \
+    X(TextureTrackHover) \
+    X(TextureUnchecked) \
+    X(TextureUncheckedDisabled) \
+    X(TextureUncheckedFocused) \
+    X(TextureUncheckedHover) \
+    X(ThumbColor) \
+    X(ThumbColorHover) \
+    X(TitleBarColor) \
+    X(TitleBarHeight) \
+    X(TitleColor) \
+    X(TrackColor) \
+    X(TrackColorHover) \
+    X(TransparentTexture)
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Small integer that identifies a renderer property
+    ///
+    /// Property names are interned: every distinct name gets its own id the first time that it is used. The properties of the
+    /// renderers that are part of TGUI have a fixed id, which is the enumerator with the same name. These ids belong to the
+    /// lowercase names, e.g. RendererProperty::TextColor is the id of "textcolor".
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    enum class RendererProperty : unsigned int
+    {
+    #define TGUI_RENDERER_PROPERTY_ENUMERATOR(NAME) NAME,
+        TGUI_RENDERER_PROPERTIES(TGUI_RENDERER_PROPERTY_ENUMERATOR)
+    #undef TGUI_RENDERER_PROPERTY_ENUMERATOR
+    };
+
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Returns the id of a renderer property
+    ///
+    /// @param name  Name of the property
+    ///
+    /// @return Id that belongs to the name, a new id is created when the name was never used before
+    ///
+    /// The name is case-sensitive, the renderer functions convert property names to lowercase before looking up their id.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    TGUI_API RendererProperty getRendererProperty(const std::string& name);
+
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Returns the id of a renderer property without creating a new one
+    ///
+    /// @param name      Name of the property
+    /// @param property  Id that belongs to the name when the function returns true
+    ///
+    /// @return Whether an id existed for the name
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    TGUI_API bool findRendererProperty(const std::string& name, RendererProperty& property);
+
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Returns the name of a renderer property
+    ///
+    /// @param property  Id of the property
+    ///
+    /// @return Name that was used to create the id
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    TGUI_API const std::string& getRendererPropertyName(RendererProperty property);
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_RENDERER_PROPERTY_HPP
@@ -29,12 +29,259 @@
 
 #include <TGUI/Config.hpp>
 #include <TGUI/ObjectConverter.hpp>
+#include <TGUI/RendererProperty.hpp>
 #include <TGUI/Loading/DataIO.hpp>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <vector>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
 {
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Values of renderer properties, stored in a flat list that is sorted on property id
+    ///
+    /// The interface resembles the one of std::map, but the elements contain the id of the property instead of its name.
+    /// Use getRendererPropertyName to get the name from the id. Just like with std::map, references to the values remain
+    /// valid when other properties are inserted.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API RendererPropertyValues
+    {
+    public:
+
+        using value_type = std::pair<const RendererProperty, ObjectConverter>;
+
+    private:
+
+        using Storage = std::vector<std::unique_ptr<value_type>>;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Iterator over the sorted list that hides that each element is stored in a separate allocation
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        template <typename Value, typename BaseIterator>
+        class Iterator
+        {
+        public:
+
+            using iterator_category = std::bidirectional_iterator_tag;
+            using value_type = typename std::remove_const<Value>::type;
+            using difference_type = std::ptrdiff_t;
+            using pointer = Value*;
+            using reference = Value&;
+
+            Iterator() = default;
+
+            Iterator(BaseIterator it) :
+                m_it{it}
+            {
+            }
+
+            // Allows converting an iterator into a const_iterator
+            template <typename OtherValue, typename OtherBaseIterator>
+            Iterator(const Iterator<OtherValue, OtherBaseIterator>& other) :
+                m_it{other.base()}
+            {
+            }
+
+            reference operator*() const
+            {
+                return **m_it;
+            }
+
+            pointer operator->() const
+            {
+                return m_it->get();
+            }
+
+            Iterator& operator++()
+            {
+                ++m_it;
+                return *this;
+            }
+
+            Iterator operator++(int)
+            {
+                Iterator old = *this;
+                ++m_it;
+                return old;
+            }
+
+            Iterator& operator--()
+            {
+                --m_it;
+                return *this;
+            }
+
+            Iterator operator--(int)
+            {
+                Iterator old = *this;
+                --m_it;
+                return old;
+            }
+
+            bool operator==(const Iterator& other) const
+            {
+                return m_it == other.m_it;
+            }
+
+            bool operator!=(const Iterator& other) const
+            {
+                return m_it != other.m_it;
+            }
+
+            BaseIterator base() const
+            {
+                return m_it;
+            }
+
+        private:
+
+            BaseIterator m_it;
+        };
+
+    public:
+
+        using iterator = Iterator<value_type, Storage::iterator>;
+        using const_iterator = Iterator<const value_type, Storage::const_iterator>;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Default constructor
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        RendererPropertyValues() = default;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Copy constructor
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        RendererPropertyValues(const RendererPropertyValues& other);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Move constructor
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        RendererPropertyValues(RendererPropertyValues&& other) = default;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Overload of copy assignment operator
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        RendererPropertyValues& operator=(const RendererPropertyValues& other);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Overload of move assignment operator
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        RendererPropertyValues& operator=(RendererPropertyValues&& other) = default;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the value of a property, an empty value is inserted when the property did not exist yet
+        ///
+        /// @param property  Id of the property
+        ///
+        /// @return Reference to the value of the property
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        ObjectConverter& operator[](RendererProperty property);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the value of a property, an empty value is inserted when the property did not exist yet
+        ///
+        /// @param property  Name of the property
+        ///
+        /// @return Reference to the value of the property
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        ObjectConverter& operator[](const std::string& property);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Finds a property
+        ///
+        /// @param property  Id of the property
+        ///
+        /// @return Iterator to the element of the property, or end() when the property does not exist
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        iterator find(RendererProperty property);
+        const_iterator find(RendererProperty property) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Finds a property
+        ///
+        /// @param property  Name of the property
+        ///
+        /// @return Iterator to the element of the property, or end() when the property does not exist
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        iterator find(const std::string& property);
+        const_iterator find(const std::string& property) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns an iterator to the first element, elements are sorted on property id
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        iterator begin()
+        {
+            return m_values.begin();
+        }
+
+        const_iterator begin() const
+        {
+            return m_values.begin();
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns an iterator past the last element
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        iterator end()
+        {
+            return m_values.end();
+        }
+
+        const_iterator end() const
+        {
+            return m_values.end();
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the amount of properties
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t size() const
+        {
+            return m_values.size();
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether there are no properties
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool empty() const
+        {
+            return m_values.empty();
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Removes all properties
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void clear()
+        {
+            m_values.clear();
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        Storage m_values;
+    };
+
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     /// @brief Shared data used in renderer classes
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -45,7 +292,9 @@ namespace tgui
         static std::shared_ptr<RendererData> create(const std::map<std::string, ObjectConverter>& init = {})
         {
             auto data = std::make_shared<RendererData>();
-            data->propertyValuePairs = init;
+            for (const auto& pair : init)
+                data->propertyValuePairs[pair.first] = pair.second;
+
             return data;
         }
 
@@ -68,9 +317,13 @@ namespace tgui
             return rendererData;
         };
 
-        std::map<std::string, ObjectConverter> propertyValuePairs;
-        std::map<const void*, std::function<void(const std::string& property)>> observers;
+        RendererPropertyValues propertyValuePairs;
+        std::map<const void*, std::function<void(const std::vector<RendererProperty>& properties)>> observers;
         bool shared = true;
+
+        // While a transaction is open, changed properties are collected here (sorted) instead of being sent to the observers
+        unsigned int transactionDepth = 0;
+        std::vector<RendererProperty> changedProperties;
     };
 
 
@@ -197,6 +450,16 @@ namespace tgui
         void setProperty(const std::string& property, ObjectConverter&& value);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes a property of the renderer
+        ///
+        /// @param property  Id of the property that you would like to change
+        /// @param value     The new value that you like to assign to the property.
+        ///                  The ObjectConverter is implicitly constructed from the possible value types
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setProperty(RendererProperty property, ObjectConverter&& value);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Retrieves the value of a certain property
         ///
@@ -210,22 +473,62 @@ namespace tgui
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        /// @brief Gets a map with all properties and their values
+        /// @brief Retrieves the value of a certain property
+        ///
+        /// @param property  Id of the property that you would like to retrieve
+        ///
+        /// @return The value inside a ObjectConverter object which you can extract with the correct get function or
+        ///         an ObjectConverter object with type ObjectConverter::Type::None when the property did not exist.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        ObjectConverter getProperty(RendererProperty property) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Starts collecting property changes instead of notifying the widgets about each change immediately
+        ///
+        /// Every widget that uses the renderer is told about all properties that changed at once when commitTransaction is
+        /// called, so that work like recalculating the widget size only has to happen once for multiple properties.
+        /// Transactions can be nested, the widgets are only notified when the outermost transaction is committed.
+        ///
+        /// @code
+        /// renderer->beginTransaction();
+        /// renderer->setBorders(2);
+        /// renderer->setPadding(5);
+        /// renderer->setTextColor(sf::Color::Red);
+        /// renderer->commitTransaction();
+        /// @endcode
+        ///
+        /// @see commitTransaction
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void beginTransaction();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Ends a transaction that was started with beginTransaction
+        ///
+        /// When this ends the outermost transaction, the widgets using the renderer are notified about all properties that
+        /// were changed since beginTransaction was called.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void commitTransaction();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Gets all properties and their values
         ///
         /// @return Property-value pairs of the renderer
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        const std::map<std::string, ObjectConverter>& getPropertyValuePairs() const;
+        const RendererPropertyValues& getPropertyValuePairs() const;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Subscribes a callback function to changes in the renderer
         ///
         /// @param id       Unique identifier for this callback function so that you can unsubscribe it later
-        /// @param function Callback function to call when the renderer changes
+        /// @param function Callback function to call when the renderer changes, it receives the sorted ids of the changed properties
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void subscribe(const void* id, const std::function<void(const std::string& property)>& function);
+        void subscribe(const void* id, const std::function<void(const std::vector<RendererProperty>& properties)>& function);
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -34,9 +34,9 @@
 #include <SFML/System/String.hpp>
 #include <functional>
 #include <typeindex>
+#include <cstdint>
 #include <memory>
 #include <vector>
-#include <deque>
 #include <map>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -49,7 +49,8 @@ namespace tgui
 
     namespace internal_signal
     {
-        extern TGUI_API std::deque<const void*> parameters;
+        // Signal handlers receive an array with pointers to the parameters, the first element points to the sending widget
+        using Handler = std::function<void(const void* const* parameters)>;
     }
 
 
@@ -70,14 +71,11 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Constructor
         ///
-        /// @param name             Name of the signal
-        /// @param extraParameters  Amount of extra parameters to reserve space for
+        /// @param name  Name of the signal
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        Signal(std::string&& name, std::size_t extraParameters = 0) :
+        Signal(std::string&& name) :
             m_name{std::move(name)}
         {
-            if (1 + extraParameters > internal_signal::parameters.size())
-                internal_signal::parameters.resize(1 + extraParameters);
         }
 
 
@@ -125,6 +123,17 @@ namespace tgui
         unsigned int connect(const DelegateEx& handler);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Connects a signal handler that reads the parameters of the signal directly
+        ///
+        /// @param handler  Callback function that is given the list of parameters that was passed to the emit function
+        ///
+        /// @return Unique id of the connection
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        unsigned int connectInternal(internal_signal::Handler handler);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Disconnect a signal handler from this signal
         ///
@@ -150,17 +159,8 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         bool emit(const Widget* widget)
         {
-            if (m_handlers.empty() || !m_enabled)
-                return false;
-
-            internal_signal::parameters[0] = static_cast<const void*>(&widget);
-
-            // Copy the handlers before calling them in case the widget (and this signal) gets destroyed during the handler
-            auto handlers = m_handlers;
-            for (auto& handler : handlers)
-                handler.second();
-
-            return true;
+            const void* parameters[] = {static_cast<const void*>(&widget)};
+            return callHandlers(parameters);
         }
 
 
@@ -169,7 +169,7 @@ namespace tgui
         ///
         /// @return signal name
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        std::string getName() const
+        const std::string& getName() const
         {
             return m_name;
         }
@@ -203,6 +203,18 @@ namespace tgui
         }
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Returns whether emitting the signal would call any functions
+        ///
+        /// Widgets use this to avoid preparing expensive parameters for a signal that nobody listens to.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool hasHandlers() const
+        {
+            return m_handlers && !m_handlers->empty() && m_enabled;
+        }
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @internal
         /// @brief Checks whether the unbound parameters match with this signal
@@ -211,14 +223,47 @@ namespace tgui
         virtual unsigned int validateTypes(std::initializer_list<std::type_index> unboundParameters) const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Extracts the widget stored in the first parameter
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static std::shared_ptr<Widget> getWidget(const void* const* parameters);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @internal
-        /// @brief Extracts the widget stored in the first parameter
+        /// @brief Calls all connected signal handlers with the given parameters
+        ///
+        /// @param parameters  Pointers to the parameters, the first element has to point to the sending widget
+        ///
+        /// @return True when at least one signal handler was called
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        static std::shared_ptr<Widget> getWidget();
+        bool callHandlers(const void* const* parameters)
+        {
+            if (!m_handlers || m_handlers->empty() || !m_enabled)
+                return false;
+
+            // Keep a reference to the handlers in case the widget (and this signal) gets destroyed during the handler.
+            // Connecting or disconnecting while the handlers are being called will give the signal a new list instead of
+            // changing the one that is being iterated.
+            const auto handlers = m_handlers;
+            for (const auto& handler : *handlers)
+                handler.second(parameters);
+
+            return true;
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the handler list so that it can be changed, the list is copied first when it is still being iterated
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::vector<std::pair<unsigned int, internal_signal::Handler>>& getHandlersForWriting();
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -226,7 +271,7 @@ namespace tgui
 
         bool m_enabled = true;
         std::string m_name;
-        std::map<unsigned int, std::function<void()>> m_handlers;
+        std::shared_ptr<std::vector<std::pair<unsigned int, internal_signal::Handler>>> m_handlers;
     };
 
 #ifdef TGUI_REMOVE_DEPRECATED_CODE
@@ -241,7 +286,7 @@ namespace tgui
          * @brief Constructor
          ************************************************************************************************************************/ \
         Signal##TypeName(std::string&& name) : \
-            Signal{std::move(name), 1} \
+            Signal{std::move(name)} \
         { \
         } \
         \
@@ -251,11 +296,8 @@ namespace tgui
          ************************************************************************************************************************/ \
         bool emit(const Widget* widget, Type param) \
         { \
-            if (m_handlers.empty()) \
-                return false; \
-         \
-            internal_signal::parameters[1] = static_cast<const void*>(&param); \
-            return Signal::emit(widget); \
+            const void* parameters[] = {static_cast<const void*>(&widget), static_cast<const void*>(&param)}; \
+            return callHandlers(parameters); \
         } \
         \
     private: \
@@ -282,7 +324,7 @@ namespace tgui
          * @brief Constructor
          ************************************************************************************************************************/ \
         Signal##TypeName(std::string&& name) : \
-            Signal{std::move(name), 1} \
+            Signal{std::move(name)} \
         { \
         } \
         \
@@ -310,11 +352,8 @@ namespace tgui
          ************************************************************************************************************************/ \
         bool emit(const Widget* widget, Type param) \
         { \
-            if (m_handlers.empty()) \
-                return false; \
-         \
-            internal_signal::parameters[1] = static_cast<const void*>(&param); \
-            return Signal::emit(widget); \
+            const void* parameters[] = {static_cast<const void*>(&widget), static_cast<const void*>(&param)}; \
+            return callHandlers(parameters); \
         } \
         \
     private: \
@@ -352,7 +391,7 @@ namespace tgui
         /// @brief Constructor
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         SignalRange(std::string&& name) :
-            Signal{std::move(name), 2}
+            Signal{std::move(name)}
         {
         }
 
@@ -415,7 +454,7 @@ namespace tgui
         /// @brief Constructor
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         SignalChildWindow(std::string&& name) :
-            Signal{std::move(name), 1}
+            Signal{std::move(name)}
         {
         }
 
@@ -480,7 +519,7 @@ namespace tgui
         /// @brief Constructor
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         SignalItem(std::string&& name) :
-            Signal{std::move(name), 2}
+            Signal{std::move(name)}
         {
         }
 
@@ -531,12 +570,8 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         bool emit(const Widget* widget, const sf::String& item, const sf::String& id)
         {
-            if (m_handlers.empty())
-                return false;
-
-            internal_signal::parameters[1] = static_cast<const void*>(&item);
-            internal_signal::parameters[2] = static_cast<const void*>(&id);
-            return Signal::emit(widget);
+            const void* parameters[] = {static_cast<const void*>(&widget), static_cast<const void*>(&item), static_cast<const void*>(&id)};
+            return callHandlers(parameters);
         }
 
 
@@ -570,7 +605,7 @@ namespace tgui
         /// @brief Constructor
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         SignalAnimation(std::string&& name) :
-            Signal{std::move(name), 2}
+            Signal{std::move(name)}
         {
         }
 
@@ -580,12 +615,8 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         bool emit(const Widget* widget, ShowAnimationType type, bool visible)
         {
-            if (m_handlers.empty())
-                return false;
-
-            internal_signal::parameters[1] = static_cast<const void*>(&type);
-            internal_signal::parameters[2] = static_cast<const void*>(&visible);
-            return Signal::emit(widget);
+            const void* parameters[] = {static_cast<const void*>(&widget), static_cast<const void*>(&type), static_cast<const void*>(&visible)};
+            return callHandlers(parameters);
         }
 
 
@@ -622,7 +653,7 @@ namespace tgui
         /// @brief Constructor
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         SignalItemHierarchy(std::string&& name) :
-            Signal{std::move(name), 2}
+            Signal{std::move(name)}
         {
         }
 
@@ -673,12 +704,8 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         bool emit(const Widget* widget, const sf::String& item, const std::vector<sf::String>& fullItem)
         {
-            if (m_handlers.empty())
-                return false;
-
-            internal_signal::parameters[1] = static_cast<const void*>(&item);
-            internal_signal::parameters[2] = static_cast<const void*>(&fullItem);
-            return Signal::emit(widget);
+            const void* parameters[] = {static_cast<const void*>(&widget), static_cast<const void*>(&item), static_cast<const void*>(&fullItem)};
+            return callHandlers(parameters);
         }
 
 
@@ -805,15 +832,43 @@ namespace tgui
     protected:
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        /// @brief Retrieves a signal based on its name
+        /// @brief Calculates the case-insensitive hash of a signal name
+        ///
+        /// @param name  Name of the signal
+        ///
+        /// The function can be evaluated at compile time, so that getSignal can use the hashes as case labels.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static constexpr std::uint64_t hashSignalName(const char* name, std::uint64_t hash = 14695981039346656037ULL)
+        {
+            // FNV-1a hash of the name with the ASCII characters converted to lowercase
+            return (*name == '\0') ? hash
+                : hashSignalName(name + 1, (hash ^ static_cast<unsigned char>(((*name >= 'A') && (*name <= 'Z')) ? (*name - 'A' + 'a') : *name)) * 1099511628211ULL);
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Retrieves a signal based on the hash of its name
+        ///
+        /// @param signalNameHash  Case-insensitive hash of the signal name, as returned by hashSignalName
+        ///
+        /// @return Signal that corresponds to the hash or a nullptr when the widget has no signal with that name
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual Signal* getSignal(std::uint64_t signalNameHash) = 0;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Retrieves the signal with the given name and hash, throws an exception when the widget has no such signal
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        virtual Signal& getSignal(std::string signalName) = 0;
+        Signal& findSignal(const std::string& signalName, std::uint64_t signalNameHash);
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     private:
 
-        std::map<unsigned int, std::string> m_connectedSignals;
+        std::map<unsigned int, std::uint64_t> m_connectedSignals; // Maps connection ids to the hash of the signal name
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -121,20 +121,21 @@ namespace tgui
             static decltype(auto) bindImpl(std::index_sequence<Indices...>, Signal& signal, Func&& func, BoundArgs&&... args)
             {
                 const std::size_t offset = (sizeof...(UnboundArgs) > 0) ? signal.validateTypes({typeid(UnboundArgs)...}) : 0;
+                const std::string signalName = signal.getName();
             #if defined TGUI_USE_CPP17
-                return [=](const std::shared_ptr<Widget>& widget, const std::string& signalName) {
+                return [=](const void* const* parameters) {
                     std::invoke(func, // An error "variable 'func' has function type" here means you passed a reference instead of a function pointer to 'connect'
                                 args...,
-                                widget,
+                                Signal::getWidget(parameters),
                                 signalName,
-                                internal_signal::dereference<UnboundArgs>(internal_signal::parameters[offset + Indices])...);
+                                internal_signal::dereference<UnboundArgs>(parameters[offset + Indices])...);
             #else
-                return [=,o=offset](const std::shared_ptr<Widget>& widget, const std::string& signalName) { // MinGW TDM GCC 5.1 won't compile code without "o=offset" hack
+                return [=,o=offset](const void* const* parameters) { // MinGW TDM GCC 5.1 won't compile code without "o=offset" hack
                     invokeFunc(func, // An error "variable 'func' has function type" here means you passed a reference instead of a function pointer to 'connect'
                                args...,
-                               widget,
+                               Signal::getWidget(parameters),
                                signalName,
-                               internal_signal::dereference<UnboundArgs>(internal_signal::parameters[o + Indices])...);
+                               internal_signal::dereference<UnboundArgs>(parameters[o + Indices])...);
             #endif
                 };
             }
@@ -156,15 +157,15 @@ namespace tgui
             {
                 const std::size_t offset = (sizeof...(UnboundArgs) > 0) ? signal.validateTypes({typeid(UnboundArgs)...}) : 0;
             #if defined TGUI_USE_CPP17
-                return [=]{
+                return [=](const void* const* parameters){
                     std::invoke(func, // An error "variable 'func' has function type" here means you passed a reference instead of a function pointer to 'connect'
                                args...,
-                               internal_signal::dereference<UnboundArgs>(internal_signal::parameters[offset + Indices])...);
+                               internal_signal::dereference<UnboundArgs>(parameters[offset + Indices])...);
             #else
-                return [=,o=offset]{ // MinGW TDM GCC 5.1 won't compile code without "o=offset" hack
+                return [=,o=offset](const void* const* parameters){ // MinGW TDM GCC 5.1 won't compile code without "o=offset" hack
                     invokeFunc(func, // An error "variable 'func' has function type" here means you passed a reference instead of a function pointer to 'connect'
                                args...,
-                               internal_signal::dereference<UnboundArgs>(internal_signal::parameters[o + Indices])...);
+                               internal_signal::dereference<UnboundArgs>(parameters[o + Indices])...);
             #endif
                 };
             }
@@ -279,7 +280,8 @@ namespace tgui
     unsigned int SignalWidgetBase::connect(std::string signalName, Func&& handler, const BoundArgs&... args)
     {
         unsigned int id;
-        Signal& signal = getSignal(toLower(signalName));
+        const std::uint64_t signalNameHash = hashSignalName(signalName.c_str());
+        Signal& signal = findSignal(signalName, signalNameHash);
 
         if constexpr (std::is_convertible_v<Func, std::function<void(const BoundArgs&...)>>
                    && std::is_invocable_v<decltype(&handler), BoundArgs...>
@@ -309,10 +311,10 @@ namespace tgui
         {
             // Function with unbound arguments
             using binder = internal_signal::func_traits<void, std::decay_t<Func>, BoundArgs...>;
-            id = signal.connect(binder::bind(signal, std::forward<Func>(handler), args...));
+            id = signal.connectInternal(binder::bind(signal, std::forward<Func>(handler), args...));
         }
 
-        m_connectedSignals[id] = toLower(signalName);
+        m_connectedSignals[id] = signalNameHash;
         return id;
     }
 
@@ -320,21 +322,23 @@ namespace tgui
     template <typename Func, typename... Args, typename std::enable_if<std::is_convertible<Func, std::function<void(const Args&...)>>::value>::type*>
     unsigned int SignalWidgetBase::connect(std::string signalName, Func&& handler, const Args&... args)
     {
-        const unsigned int id = getSignal(toLower(signalName)).connect([f=std::function<void(const Args&...)>(handler),args...](){ f(args...); });
-        m_connectedSignals[id] = toLower(signalName);
+        const std::uint64_t signalNameHash = hashSignalName(signalName.c_str());
+        const unsigned int id = findSignal(signalName, signalNameHash).connect([f=std::function<void(const Args&...)>(handler),args...](){ f(args...); });
+        m_connectedSignals[id] = signalNameHash;
         return id;
     }
 
     template <typename Func, typename... BoundArgs, typename std::enable_if<std::is_convertible<Func, std::function<void(const BoundArgs&..., std::shared_ptr<Widget>, const std::string&)>>::value>::type*>
     unsigned int SignalWidgetBase::connect(std::string signalName, Func&& handler, BoundArgs&&... args)
     {
-        const unsigned int id = getSignal(toLower(signalName)).connect(
+        const std::uint64_t signalNameHash = hashSignalName(signalName.c_str());
+        const unsigned int id = findSignal(signalName, signalNameHash).connect(
                                     [f=std::function<void(const BoundArgs&..., const std::shared_ptr<Widget>&, const std::string&)>(handler), args...]
                                     (const std::shared_ptr<Widget>& w, const std::string& s)
                                     { f(args..., w, s); }
                                 );
 
-        m_connectedSignals[id] = toLower(signalName);
+        m_connectedSignals[id] = signalNameHash;
         return id;
     }
 
@@ -342,10 +346,11 @@ namespace tgui
                                                                          && !std::is_convertible<Func, std::function<void(const BoundArgs&..., std::shared_ptr<Widget>, const std::string&)>>::value>::type*>
     unsigned int SignalWidgetBase::connect(std::string signalName, Func&& handler, BoundArgs&&... args)
     {
-        Signal& signal = getSignal(toLower(signalName));
+        const std::uint64_t signalNameHash = hashSignalName(signalName.c_str());
+        Signal& signal = findSignal(signalName, signalNameHash);
         using binder = internal_signal::func_traits<void, typename std::decay<Func>::type, BoundArgs...>;
-        const unsigned int id = signal.connect(binder::bind(signal, std::forward<Func>(handler), std::forward<BoundArgs>(args)...));
-        m_connectedSignals[id] = toLower(signalName);
+        const unsigned int id = signal.connectInternal(binder::bind(signal, std::forward<Func>(handler), std::forward<BoundArgs>(args)...));
+        m_connectedSignals[id] = signalNameHash;
         return id;
     }
 #endif
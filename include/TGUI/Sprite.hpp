@@ -30,7 +30,6 @@
 #include <TGUI/Vector2f.hpp>
 #include <TGUI/FloatRect.hpp>
 #include <TGUI/Color.hpp>
-#include <TGUI/Aurora/SmartPtr/CopiedPtr.hpp>
 #include <SFML/Graphics/Transformable.hpp>
 #include <SFML/Graphics/RenderStates.hpp>
 #include <SFML/Graphics/Vertex.hpp>
@@ -231,7 +230,7 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Update the location of the vertices
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void updateVertices();
+        void updateVertices() const;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -239,8 +238,10 @@ namespace tgui
 
         Vector2f    m_size;
         Texture     m_texture;
-        aurora::CopiedPtr<sf::Texture> m_svgTexture;
-        std::vector<sf::Vertex> m_vertices;
+        // The vertices are recalculated while drawing when the image was loaded or rasterized on a worker thread
+        mutable std::shared_ptr<sf::Texture> m_svgTexture;
+        mutable std::vector<sf::Vertex> m_vertices;
+        mutable bool m_textureLoading = false;
 
         FloatRect   m_visibleRect;
 
@@ -248,7 +249,7 @@ namespace tgui
         Color       m_vertexColor = Color::White;
         float       m_opacity = 1;
 
-        ScalingType m_scalingType = ScalingType::Normal;
+        mutable ScalingType m_scalingType = ScalingType::Normal;
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -29,6 +29,9 @@
 #include <TGUI/Vector2f.hpp>
 
 #include <SFML/System/String.hpp>
+#include <SFML/Graphics/Texture.hpp>
+
+#include <memory>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -88,10 +91,88 @@ namespace tgui
         void rasterize(sf::Texture& texture, sf::Vector2u size);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Returns a texture containing the image rasterized at the given size
+        ///
+        /// @param size  Size that the texture should have
+        ///
+        /// @return Texture that must not be changed, or nullptr when the image couldn't be rasterized
+        ///
+        /// The texture is taken from a cache that is shared by all svg images, so sprites that display the same svg at the
+        /// same size only rasterize it once and share the texture.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::shared_ptr<sf::Texture> getRasterizedTexture(sf::Vector2u size);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Returns a texture containing the image rasterized at the given size, without blocking to rasterize it
+        ///
+        /// @param size  Size that the texture should have
+        ///
+        /// @return Texture that must not be changed, or nullptr when the image isn't rasterized at this size yet
+        ///
+        /// When the texture isn't in the cache yet, the image is rasterized on a worker thread and the texture is created
+        /// in the next Gui::draw call. Calling this function again afterwards will return the texture.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::shared_ptr<sf::Texture> requestRasterizedTexture(sf::Vector2u size);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether sprites rasterize svg images on worker threads
+        ///
+        /// @param enabled  Should resizing a sprite with an svg image no longer block until the image is rasterized?
+        ///
+        /// When enabled, a sprite keeps showing the previous rasterization (stretched to the new size) until the image has
+        /// been rasterized at the new size. A sprite that wasn't rasterized before shows nothing in the meantime.
+        /// This option is disabled by default.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void setAsyncRasterizationEnabled(bool enabled);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether sprites rasterize svg images on worker threads
+        ///
+        /// @return Is asynchronous rasterization enabled?
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static bool isAsyncRasterizationEnabled();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the amount of memory that the cache of rasterized svg images may use
+        ///
+        /// @param bytes  Maximum combined size of the cached textures, in bytes
+        ///
+        /// When the limit is exceeded, the textures that were least recently requested are removed from the cache. Textures
+        /// that are still used by a sprite remain alive until the sprite no longer needs them.
+        /// The default budget is 16 MB.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void setRasterCacheBudget(std::size_t bytes);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the amount of memory that the cache of rasterized svg images may use
+        ///
+        /// @return Maximum combined size of the cached textures, in bytes
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static std::size_t getRasterCacheBudget();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the amount of memory that is currently used by the cache of rasterized svg images
+        ///
+        /// @return Combined size of the cached textures, in bytes
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static std::size_t getRasterCacheUsage();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     private:
-        NSVGimage* m_svg = nullptr;
+        std::shared_ptr<NSVGimage> m_svg; // Shared with the worker threads that are rasterizing the image
         NSVGrasterizer* m_rasterizer = nullptr;
+
+        static bool m_asyncRasterizationEnabled;
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -32,6 +32,8 @@
 #include <TGUI/TextStyle.hpp>
 #include <SFML/Graphics/Text.hpp>
 #include <SFML/Graphics/Transformable.hpp>
+#include <SFML/Graphics/Vertex.hpp>
+#include <vector>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -129,6 +131,29 @@ namespace tgui
         static sf::String wordWrap(float maxWidth, const sf::String& text, Font font, unsigned int textSize, bool bold, bool dropLeadingSpace = true);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns how many times a measurement was found in the text layout cache
+        ///
+        /// getLineWidth, wordWrap and calculateExtraVerticalSpace remember their results per font, so that measuring the same
+        /// text again doesn't require looking up all glyphs again. Only the most recently used results are kept.
+        ///
+        /// @return Number of calls that could use a cached result since the program started
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static std::size_t getLayoutCacheHits();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns how many times a measurement wasn't found in the text layout cache
+        ///
+        /// @return Number of calls that had to measure the text since the program started
+        ///
+        /// @see getLayoutCacheHits
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static std::size_t getLayoutCacheMisses();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     public:
 
@@ -315,6 +340,12 @@ namespace tgui
         void recalculateSize();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Creates the triangles of the glyphs, so that they can be drawn together with the geometry of other widgets
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateVertices() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     private:
 
@@ -323,6 +354,9 @@ namespace tgui
         Font         m_font;
         Color        m_color;
         float        m_opacity = 1;
+
+        mutable std::vector<sf::Vertex> m_vertices; // Triangles of the glyphs, created when the text is drawn
+        mutable bool m_verticesOutdated = true;
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
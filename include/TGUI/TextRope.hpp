@@ -0,0 +1,201 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2019 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#ifndef TGUI_TEXT_ROPE_HPP
+#define TGUI_TEXT_ROPE_HPP
+
+#include <TGUI/Config.hpp>
+#include <SFML/System/String.hpp>
+#include <memory>
+#include <random>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Storage for long texts in which characters can be inserted and erased anywhere without moving the rest of the text
+    ///
+    /// The characters are stored in chunks that are kept in a balanced tree, so inserting, erasing and accessing a character
+    /// take logarithmic time instead of time proportional to the length of the text. A contiguous copy of the text is only
+    /// created when toString is called, and it is kept until the text changes again.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API TextRope
+    {
+    public:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Default constructor that creates an empty text
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TextRope();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Constructor that stores a copy of the text
+        ///
+        /// @param text  Initial text
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TextRope(const sf::String& text);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Copy constructor
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TextRope(const TextRope& other);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Move constructor
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TextRope(TextRope&& other);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Destructor
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        ~TextRope();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Copy assignment operator
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TextRope& operator=(const TextRope& other);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Move assignment operator
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TextRope& operator=(TextRope&& other);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Replaces the stored text
+        ///
+        /// @param text  New text
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        TextRope& operator=(const sf::String& text);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the amount of characters in the text
+        ///
+        /// @return Length of the text
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t getSize() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether the text is empty
+        ///
+        /// @return True when the text contains no characters
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isEmpty() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the character at the given position
+        ///
+        /// @param index  Position of the character, which must be smaller than getSize()
+        ///
+        /// @return Character at the given position
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        sf::Uint32 operator[](std::size_t index) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Inserts text at the given position
+        ///
+        /// @param index  Position before which the text is inserted, a value of getSize() appends the text
+        /// @param text   Text to insert
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void insert(std::size_t index, const sf::String& text);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Removes characters from the text
+        ///
+        /// @param index  Position of the first character to remove
+        /// @param count  Amount of characters to remove, the range is clamped to the end of the text
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void erase(std::size_t index, std::size_t count = 1);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Removes all characters
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void clear();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns part of the text
+        ///
+        /// @param index  Position of the first character
+        /// @param count  Amount of characters, the range is clamped to the end of the text
+        ///
+        /// @return Copy of the requested characters
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        sf::String substring(std::size_t index, std::size_t count = sf::String::InvalidPos) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the text as a contiguous string
+        ///
+        /// @return Reference to a cached copy of the text, which remains valid until the text is changed
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const sf::String& toString() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        struct Node;
+
+        // Splits the tree in the first index characters and the remaining characters
+        void split(std::unique_ptr<Node> node, std::size_t index, std::unique_ptr<Node>& left, std::unique_ptr<Node>& right);
+
+        // Joins two trees, all characters of the left tree are placed in front of those in the right tree
+        static std::unique_ptr<Node> merge(std::unique_ptr<Node> left, std::unique_ptr<Node> right);
+
+        // Creates a tree containing the given characters
+        std::unique_ptr<Node> createTree(const sf::String& text, std::size_t index, std::size_t count);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        std::unique_ptr<Node> m_root;
+        std::minstd_rand m_random;
+
+        mutable sf::String m_string;
+        mutable bool m_stringOutdated = false;
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_TEXT_ROPE_HPP
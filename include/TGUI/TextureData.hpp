@@ -35,8 +35,11 @@
 #include <SFML/Graphics/Rect.hpp>
 #include <SFML/Graphics/Shader.hpp>
 
+#include <functional>
+#include <map>
 #include <memory>
 #include <string>
+#include <vector>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -52,6 +55,23 @@ namespace tgui
         sf::Texture texture;
         sf::IntRect rect;
 
+        // When the texture atlas is enabled in the TextureManager, all parts of an image share this texture instead of
+        // each having their own copy in the texture member. The atlasRect is then the part of the texture that is used.
+        std::shared_ptr<sf::Texture> atlasTexture;
+        sf::IntRect atlasRect;
+
+        // When the TextureManager doesn't keep images in memory, the image is replaced by a mask that stores one bit per
+        // pixel of the image, which is true when the pixel is fully transparent
+        std::shared_ptr<const std::vector<bool>> alphaMask;
+        sf::Vector2u imageSize;
+
+        // When the TextureManager loads images asynchronously, this is true while a worker thread is still decoding the image
+        bool loading = false;
+
+        // Functions that are called on the gui thread after the image has finished loading asynchronously. The key identifies
+        // the subscriber, so that it can unsubscribe when it is destroyed before the image is loaded.
+        std::map<const void*, std::function<void()>> loadingFinishedObservers;
+
 #ifndef TGUI_NEXT
         sf::Shader* shader = nullptr;
 #endif
@@ -29,7 +29,10 @@
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 #include <TGUI/TextureData.hpp>
+#include <TGUI/Color.hpp>
+#include <functional>
 #include <memory>
+#include <vector>
 #include <list>
 #include <map>
 
@@ -79,10 +82,159 @@ namespace tgui
         static void removeTexture(std::shared_ptr<TextureData> textureDataToRemove);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether different parts of the same image should share a single texture
+        ///
+        /// @param enabled  Should textures loaded from now on be stored in a texture atlas?
+        ///
+        /// When enabled, the whole image is only uploaded once to the graphics card and every part that is loaded from it
+        /// (e.g. the different textures that a theme loads from one image) just references a rectangle inside that texture.
+        /// This reduces the amount of video memory and the number of texture switches while drawing.
+        ///
+        /// Since the parts share the texture, changing the smooth property of one part affects all parts of the same image.
+        /// Smoothing may also cause pixels just outside the part to become visible on its edges.
+        ///
+        /// Textures that were already loaded are not affected by this setting. The atlas is disabled by default.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void setTextureAtlasEnabled(bool enabled);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether different parts of the same image share a single texture
+        ///
+        /// @return Are textures being stored in a texture atlas?
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static bool isTextureAtlasEnabled();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether the images should be kept in memory after they have been uploaded to the graphics card
+        ///
+        /// @param keep  Should the loaded images be kept in memory?
+        ///
+        /// The image is only used to find out which pixels are transparent, e.g. when checking whether the mouse is on top of
+        /// a picture. When the images aren't kept, only a mask with one bit per pixel is stored for this purpose instead of
+        /// the 4 bytes per pixel that the image requires. The image data in the TextureData will then be a nullptr.
+        ///
+        /// Textures that were already loaded are not affected by this setting. Images are kept in memory by default.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void setKeepImagesInMemory(bool keep);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether the images are kept in memory after they have been uploaded to the graphics card
+        ///
+        /// @return Are the loaded images kept in memory?
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static bool getKeepImagesInMemory();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether images should be decoded on worker threads
+        ///
+        /// @param enabled  Should loading a texture return immediately instead of waiting until the image has been decoded?
+        ///
+        /// When enabled, the texture data of a newly loaded image is in a loading state (TextureData::loading is true) and has
+        /// an empty texture and an image size of 0x0. The image is decoded on a worker thread and the texture is created in
+        /// the next Gui::draw call. Sprites draw the loading color instead of the image in the meantime.
+        /// Widgets that calculate their size from the size of the image (e.g. Picture and BitmapButton) recalculate it once
+        /// their image has finished loading, so a picture that was created without a size is 0x0 until then.
+        ///
+        /// The image loader (Texture::setImageLoader) is called on a worker thread, so a custom loader must be thread-safe.
+        /// When the loading fails then a warning is printed and the texture remains empty, no exception is thrown.
+        /// Svg images and images loaded while the texture atlas is enabled are still loaded immediately.
+        ///
+        /// Asynchronous loading is disabled by default.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void setAsyncLoadingEnabled(bool enabled);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether images are decoded on worker threads
+        ///
+        /// @return Is asynchronous loading enabled?
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static bool isAsyncLoadingEnabled();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the color that sprites draw while their image is still being loaded
+        ///
+        /// @param color  Color drawn instead of the image
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void setLoadingColor(const Color& color);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the color that sprites draw while their image is still being loaded
+        ///
+        /// @return Color drawn instead of the image
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static const Color& getLoadingColor();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the amount of images that are still being loaded asynchronously
+        ///
+        /// @return Number of images that are being decoded or whose textures haven't been created yet
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static unsigned int getLoadingImageCount();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Calls a function once all images that are being loaded asynchronously have finished loading
+        ///
+        /// @param func  Function to call on the gui thread
+        ///
+        /// After loading a theme or a form, this can be used to find out when all of its textures are ready.
+        /// The function is called immediately when no images are being loaded.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void addLoadingFinishedCallback(std::function<void()> func);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Blocks until all images that are being loaded asynchronously have finished loading
+        ///
+        /// The textures are created and the loading finished callbacks are called before this function returns.
+        /// When using retained rendering, call Gui::invalidate afterwards.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void waitUntilLoaded();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
+        // Creates the texture from the image that was loaded in the texture data
+        static bool loadTextureFromImage(TextureData& data);
+
+        // Called on the gui thread when a worker thread finished decoding an image
+        static void finishAsyncLoad(const sf::String& filename, const std::shared_ptr<sf::Image>& image);
+
+        // Makes the texture data reference a part of the shared texture of an image, loading the image if it wasn't loaded yet
+        static bool loadAtlasPart(Texture& texture, const sf::String& filename, const std::list<TextureDataHolder>& loadedParts, TextureData& data);
+
+        // Replaces the image by an alpha mask when images shouldn't be kept in memory
+        static void releaseImage(TextureData& data, const std::list<TextureDataHolder>& loadedParts);
+
+
         static std::map<sf::String, std::list<TextureDataHolder>> m_imageMap;
+        static bool m_textureAtlasEnabled;
+        static bool m_keepImagesInMemory;
+        static bool m_asyncLoadingEnabled;
+        static Color m_loadingColor;
+        static unsigned int m_loadingImageCount;
+        static std::vector<std::function<void()>> m_loadingFinishedCallbacks;
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -32,7 +32,9 @@
 #include <TGUI/Signal.hpp>
 #include <TGUI/Sprite.hpp>
 #include <TGUI/Layout.hpp>
+#include <TGUI/RenderBatch.hpp>
 #include <TGUI/Vector2f.hpp>
+#include <TGUI/FloatRect.hpp>
 #include <TGUI/Loading/Theme.hpp>
 #include <TGUI/Loading/DataIO.hpp>
 #include <TGUI/Loading/Serializer.hpp>
@@ -46,6 +48,7 @@
 #include <SFML/Graphics/RenderTarget.hpp>
 
 #include <unordered_set>
+#include <typeinfo>
 
 #ifdef TGUI_USE_CPP17
     #include <any>
@@ -510,6 +513,18 @@ namespace tgui
         bool isContainer() const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Informs the gui that the widget changed and has to be drawn again
+        ///
+        /// Widgets call this function themselves when their position, size, visibility, renderer or any other property that
+        /// affects what they draw is changed, as well as when events or animations change them. It only has to be called
+        /// manually after changes that bypass the widget, e.g. when drawing on a texture that the widget is displaying.
+        ///
+        /// @see Gui::isRedrawNeeded
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void invalidate();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @internal
         /// This function is called when the widget is added to a container.
@@ -531,6 +546,17 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         virtual bool mouseOnWidget(Vector2f pos) const = 0;
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the area in which the widget draws, relative to the parent widget
+        ///
+        /// @return Rectangle that contains everything that the widget draws
+        ///
+        /// Containers don't draw child widgets of which this area lies outside the visible part of the container. By default,
+        /// this is the rectangle formed by the position, widget offset and full size. Custom widgets that draw outside that
+        /// rectangle (e.g. a shadow) have to override this function.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual FloatRect getDrawBounds() const;
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @internal
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -645,6 +671,9 @@ namespace tgui
         ///
         /// This is a pure virtual function that has to be implemented by the derived class to define how the widget is drawn.
         ///
+        /// Widgets whose draw function only draws via drawRectangleShape, drawBorders, Sprite, Text and RenderBatch::draw can
+        /// set m_renderBatchType to the type of their class, so that their geometry is merged with that of other widgets.
+        ///
         /// @param target Render target to draw to
         /// @param states Current render states
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -690,23 +719,29 @@ namespace tgui
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        /// @brief Retrieves a signal based on its name
+        /// @brief Retrieves a signal based on the hash of its name
         ///
-        /// @param signalName  Name of the signal
+        /// @param signalNameHash  Case-insensitive hash of the signal name, as returned by hashSignalName
         ///
-        /// @return Signal that corresponds to the name
-        ///
-        /// @throw Exception when the name does not match any signal
+        /// @return Signal that corresponds to the hash or a nullptr when the widget has no signal with that name
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        Signal& getSignal(std::string signalName) override;
+        Signal* getSignal(std::uint64_t signalNameHash) override;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Function called when one of the properties of the renderer is changed
         ///
-        /// @param property  Lowercase name of the property that was changed
+        /// @param property  Id of the property that was changed
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void rendererChanged(RendererProperty property);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        virtual void rendererChanged(const std::string& property);
+        // Calls setSize with the current size to recalculate everything that depends on the renderer properties.
+        // When called from rendererChanged while a batch of properties is being processed, the call is postponed until all
+        // properties have been handled, so that the widget is only resized once.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void requestSizeUpdate();
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -752,13 +787,33 @@ namespace tgui
                          Color color) const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Makes sure that textureLoaded is called once the image of the texture has finished loading asynchronously.
+        // Nothing happens when the texture isn't being loaded.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void callWhenTextureLoaded(const Texture& texture);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Called after the image of a texture that was passed to callWhenTextureLoaded has finished loading
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual void textureLoaded();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     private:
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Callback function which is called on a renderer change and which calls the virtual rendererChanged function
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void rendererChangedCallback(const std::string& property);
+        void rendererChangedCallback(const std::vector<RendererProperty>& properties);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Adds or removes this widget to or from the observers of the textures in m_loadingTextures
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void subscribeToLoadingTextures();
+        void unsubscribeFromLoadingTextures();
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -815,6 +870,11 @@ namespace tgui
         // This is set to true for widgets that store other widgets inside them
         bool m_containerWidget = false;
 
+        // Class of which the draw function doesn't draw anything directly on the render target, set in the constructor of
+        // that class. A derived class may override the draw function, so only widgets of exactly this type are drawn in the
+        // same RenderBatch as the widgets before them.
+        const std::type_info* m_renderBatchType = nullptr;
+
         // The tool tip connected to the widget
         Widget::Ptr m_toolTip = nullptr;
 
@@ -839,12 +899,20 @@ namespace tgui
         tgui::Any m_userData;
     #endif
 
-        std::function<void(const std::string& property)> m_rendererChangedCallback = [this](const std::string& property){ rendererChangedCallback(property); };
+        // Used to postpone setSize calls from rendererChanged until all changed properties have been processed
+        bool m_processingRendererChanges = false;
+        bool m_sizeUpdateRequested = false;
+
+        // Textures that were still being loaded asynchronously when callWhenTextureLoaded was called
+        std::vector<std::weak_ptr<TextureData>> m_loadingTextures;
+
+        std::function<void(const std::vector<RendererProperty>& properties)> m_rendererChangedCallback = [this](const std::vector<RendererProperty>& properties){ rendererChangedCallback(properties); };
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
         friend class Container; // Container accesses m_mouseDown, m_draggableWidget, save and load
+        friend class Layout; // Layout accesses m_position and m_size when evaluating deferred layouts in dependency order
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
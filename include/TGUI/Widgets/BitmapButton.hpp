@@ -143,6 +143,12 @@ namespace tgui
         void updateSize() override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Recalculates the size of the image and the button once the image has finished loading
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void textureLoaded() override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Makes a copy of the widget
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -196,24 +196,22 @@ namespace tgui
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        /// @brief Retrieves a signal based on its name
+        /// @brief Retrieves a signal based on the hash of its name
         ///
-        /// @param signalName  Name of the signal
+        /// @param signalNameHash  Case-insensitive hash of the signal name, as returned by hashSignalName
         ///
-        /// @return Signal that corresponds to the name
-        ///
-        /// @throw Exception when the name does not match any signal
+        /// @return Signal that corresponds to the hash or a nullptr when the widget has no signal with that name
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        Signal& getSignal(std::string signalName) override;
+        Signal* getSignal(std::uint64_t signalNameHash) override;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Function called when one of the properties of the renderer is changed
         ///
-        /// @param property  Lowercase name of the property that was changed
+        /// @param property  Id of the property that was changed
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void rendererChanged(const std::string& property) override;
+        void rendererChanged(RendererProperty property) override;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
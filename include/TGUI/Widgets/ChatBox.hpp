@@ -51,8 +51,12 @@ namespace tgui
 
         struct Line
         {
-            Text text;
             sf::String string;
+            Color color;
+            TextStyle style;
+            sf::String wrappedString;    // String of the line after word-wrapping
+            float height = 0;            // Height of the line after word-wrapping
+            bool heightOutdated = false; // Does the line still need to be word-wrapped again to find its height?
         };
 
 
@@ -368,33 +372,46 @@ namespace tgui
     private:
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        // Recalculates the text attribute of the line
+        // Returns the string of the line after word-wrapping it to the width of the chat box
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void recalculateLineText(Line& line);
+        sf::String wordWrapLine(const Line& line) const;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        // Recalculates all text attributes, recalculate the full text height and update the displayed text
+        // Word-wraps the line to find its height. Returns how much the height of the line changed.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        float recalculateLineHeight(Line& line);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Marks the heights of all lines as outdated. Only the visible lines are word-wrapped immediately, the other lines are
+        // recalculated a few at a time in the update function.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void recalculateAllLines();
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        // Recalculates the space used by all the lines
+        // Removes a line without updating the displayed text
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void eraseLine(std::size_t lineIndex);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Updates the scrollbar after the space used by all the lines changed
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void recalculateFullTextHeight();
+        void updateScrollbarMaximum();
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        // Updates the position of the lines
+        // Creates the text objects for the lines that are visible with the current scrollbar value
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void updateDisplayedText();
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        // Updates the position and size of the panel and scrollbar
+        // This function is called every frame with the time passed since the last frame.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void updateRendering();
+        void update(sf::Time elapsedTime) override;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -413,10 +430,10 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Function called when one of the properties of the renderer is changed
         ///
-        /// @param property  Lowercase name of the property that was changed
+        /// @param property  Id of the property that was changed
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void rendererChanged(const std::string& property) override;
+        void rendererChanged(RendererProperty property) override;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -463,6 +480,14 @@ namespace tgui
         CopiedSharedPtr<ScrollbarChildWidget> m_scroll;
 
         std::deque<Line> m_lines;
+        std::size_t m_outdatedLineCount = 0;
+        std::size_t m_nextOutdatedLine = 0;
+
+        // Text objects only exist for the lines that are currently visible. The index and top position of the first visible
+        // line are kept up-to-date when lines change, so that scrolling only has to look at the lines near the view.
+        std::vector<Text> m_visibleLineTexts;
+        std::size_t m_firstVisibleLine = 0;
+        float m_firstVisibleLineTop = 0;
 
         Sprite m_spriteBackground;
 
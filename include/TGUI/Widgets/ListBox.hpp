@@ -31,6 +31,7 @@
 #include <TGUI/Widgets/Scrollbar.hpp>
 #include <TGUI/Renderers/ListBoxRenderer.hpp>
 #include <TGUI/Text.hpp>
+#include <TGUI/ItemDataProvider.hpp>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -358,11 +359,65 @@ namespace tgui
         /// @return item ids
         ///
         /// Items that were not given an id simply have an empty string as id.
+        /// The list is always empty while the list box has a data provider.
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         const std::vector<sf::String>& getItemIds() const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Lets the list box read its items from your own data instead of storing copies of them
+        ///
+        /// @param provider  Object that returns the amount of rows and their texts, or nullptr to stop using it
+        ///
+        /// All items that were added to the list box are removed when calling this function. The text of an item is taken
+        /// from column 0 of the data provider and its id from getRowId. While a data provider is set, functions like addItem,
+        /// changeItem and removeItem can't be used. Call notifyItemsInserted, notifyItemsRemoved or notifyItemsChanged
+        /// instead when your data changes.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setDataProvider(ItemDataProvider::Ptr provider);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the data provider from which the list box reads its items
+        ///
+        /// @return Data provider that was set with setDataProvider, or nullptr when the list box stores its own items
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        ItemDataProvider::Ptr getDataProvider() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Informs the list box that rows were inserted in the data provider
+        ///
+        /// @param index  Index of the first inserted row
+        /// @param count  Amount of rows that were inserted
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void notifyItemsInserted(std::size_t index, std::size_t count);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Informs the list box that rows were removed from the data provider
+        ///
+        /// @param index  Index of the first removed row, as it was before the rows were removed
+        /// @param count  Amount of rows that were removed
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void notifyItemsRemoved(std::size_t index, std::size_t count);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Informs the list box that the texts of some rows in the data provider have changed
+        ///
+        /// @param index  Index of the first changed row
+        /// @param count  Amount of rows that were changed
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void notifyItemsChanged(std::size_t index, std::size_t count);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Changes the height of the items in the list box
         ///
@@ -519,24 +574,22 @@ namespace tgui
     protected:
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        /// @brief Retrieves a signal based on its name
+        /// @brief Retrieves a signal based on the hash of its name
         ///
-        /// @param signalName  Name of the signal
+        /// @param signalNameHash  Case-insensitive hash of the signal name, as returned by hashSignalName
         ///
-        /// @return Signal that corresponds to the name
-        ///
-        /// @throw Exception when the name does not match any signal
+        /// @return Signal that corresponds to the hash or a nullptr when the widget has no signal with that name
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        Signal& getSignal(std::string signalName) override;
+        Signal* getSignal(std::uint64_t signalNameHash) override;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Function called when one of the properties of the renderer is changed
         ///
-        /// @param property  Lowercase name of the property that was changed
+        /// @param property  Id of the property that was changed
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void rendererChanged(const std::string& property) override;
+        void rendererChanged(RendererProperty property) override;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -557,6 +610,30 @@ namespace tgui
         Vector2f getInnerSize() const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the id of an item, which is either stored in the list box or requested from the data provider
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        sf::String getIdOfItem(std::size_t index) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Changes the color of the Text object of an item. Does nothing for items from a data provider that aren't visible.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setItemColor(std::size_t index, const Color& color);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Changes the style of the Text object of an item. Does nothing for items from a data provider that aren't visible.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setItemStyle(std::size_t index, TextStyle style);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Makes sure that Text objects exist for the visible items when a data provider is used
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateVisibleItemTexts(std::size_t firstItem, std::size_t lastItem) const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Update the colors and text style of the selected and hovered items
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -612,6 +689,12 @@ namespace tgui
         std::vector<Text>       m_items;
         std::vector<sf::String> m_itemIds;
 
+        // When the items come from a data provider then Text objects only exist for the items that were visible when the
+        // list box was last drawn. Clearing m_visibleItemTexts causes them to be recreated on the next draw.
+        ItemDataProvider::Ptr m_dataProvider;
+        mutable std::vector<Text> m_visibleItemTexts;
+        mutable std::size_t m_firstVisibleItem = 0;
+
         // What is the index of the selected item?
         // This is also used by combo box, so it can't just be changed to a pointer!
         int m_selectedItem = -1;
@@ -31,6 +31,7 @@
 #include <TGUI/Widgets/Scrollbar.hpp>
 #include <TGUI/Renderers/ListViewRenderer.hpp>
 #include <TGUI/Text.hpp>
+#include <TGUI/ItemDataProvider.hpp>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -59,7 +60,7 @@ namespace tgui
 
         struct Item
         {
-            std::vector<Text> texts;
+            std::vector<sf::String> texts;
             Sprite icon;
         };
 
@@ -397,6 +398,53 @@ namespace tgui
         std::vector<std::vector<sf::String>> getItemRows() const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Lets the list view read its items from your own data instead of storing copies of them
+        ///
+        /// @param provider  Object that returns the amount of rows and the text in each cell, or nullptr to stop using it
+        ///
+        /// All items that were added to the list view are removed when calling this function. While a data provider is set,
+        /// functions like addItem, changeItem, removeItem and setItemIcon can't be used. Call notifyItemsInserted,
+        /// notifyItemsRemoved or notifyItemsChanged instead when your data changes.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setDataProvider(ItemDataProvider::Ptr provider);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the data provider from which the list view reads its items
+        ///
+        /// @return Data provider that was set with setDataProvider, or nullptr when the list view stores its own items
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        ItemDataProvider::Ptr getDataProvider() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Informs the list view that rows were inserted in the data provider
+        ///
+        /// @param index  Index of the first inserted row
+        /// @param count  Amount of rows that were inserted
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void notifyItemsInserted(std::size_t index, std::size_t count);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Informs the list view that rows were removed from the data provider
+        ///
+        /// @param index  Index of the first removed row, as it was before the rows were removed
+        /// @param count  Amount of rows that were removed
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void notifyItemsRemoved(std::size_t index, std::size_t count);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Informs the list view that the texts of some rows in the data provider have changed
+        ///
+        /// @param index  Index of the first changed row
+        /// @param count  Amount of rows that were changed
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void notifyItemsChanged(std::size_t index, std::size_t count);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Changes the height of the items in the list view
         ///
@@ -655,23 +703,21 @@ namespace tgui
     protected:
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        /// @brief Retrieves a signal based on its name
-        ///
-        /// @param signalName  Name of the signal
+        /// @brief Retrieves a signal based on the hash of its name
         ///
-        /// @return Signal that corresponds to the name
+        /// @param signalNameHash  Case-insensitive hash of the signal name, as returned by hashSignalName
         ///
-        /// @throw Exception when the name does not match any signal
+        /// @return Signal that corresponds to the hash or a nullptr when the widget has no signal with that name
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        Signal& getSignal(std::string signalName) override;
+        Signal* getSignal(std::uint64_t signalNameHash) override;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Function called when one of the properties of the renderer is changed
         ///
-        /// @param property  Lowercase name of the property that was changed
+        /// @param property  Id of the property that was changed
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void rendererChanged(const std::string& property) override;
+        void rendererChanged(RendererProperty property) override;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -695,7 +741,7 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Create a Text object for an item from the given caption, using the preset color, font, text size and opacity
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        Text createText(const sf::String& caption);
+        Text createText(const sf::String& caption) const;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -705,9 +751,15 @@ namespace tgui
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        // Changes the color of all Text objects in an item
+        // Returns the color that the texts of an item should have, depending on whether it is selected and/or hovered
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void setItemColor(std::size_t index, const Color& color);
+        Color getItemTextColor(std::size_t index) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Changes the color of the Text objects in an item, if the item is visible
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateItemColor(std::size_t index);
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -774,6 +826,12 @@ namespace tgui
         void drawHeaderText(sf::RenderTarget& target, sf::RenderStates states, float columnWidth, float headerHeight, std::size_t column) const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Makes sure that Text objects exist for the items in the given range. Texts of items that were already visible are reused.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateVisibleItemTexts(std::size_t firstItem, std::size_t lastItem) const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Draw the texts in a single column
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -808,6 +866,12 @@ namespace tgui
 
         std::vector<Column> m_columns;
         std::vector<Item>   m_items;
+        ItemDataProvider::Ptr m_dataProvider;
+
+        // Text objects only exist for the items that were visible when the list view was last drawn.
+        // Clearing m_visibleItemTexts causes them to be recreated on the next draw.
+        mutable std::vector<std::vector<Text>> m_visibleItemTexts;
+        mutable std::size_t m_firstVisibleItem = 0;
 
         int m_selectedItem = -1;
         int m_hoveredItem = -1;
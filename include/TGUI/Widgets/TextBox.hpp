@@ -31,6 +31,7 @@
 #include <TGUI/Widgets/Scrollbar.hpp>
 #include <TGUI/Renderers/TextBoxRenderer.hpp>
 #include <TGUI/Text.hpp>
+#include <TGUI/TextRope.hpp>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -439,6 +440,13 @@ namespace tgui
         void deleteSelectedCharacters();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Remembers which part of the text was edited, so that rearrangeText only has to word-wrap the affected paragraphs.
+        // This has to be called after each change to m_text, with the position of the change and the amount of new characters.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void markTextChanged(std::size_t position, std::size_t insertedCharacters);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Rearrange the text inside the text box (by using word wrap).
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -450,10 +458,16 @@ namespace tgui
         void updateScrollbars();
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        // This function will split the text into five pieces so that the text can be easily drawn.
+        // This function is called when the selection or caret changed. It moves the view to the caret and updates the texts.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void updateSelectionTexts();
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // This function will split the visible lines into five pieces so that the text can be easily drawn.
+        // Only the lines that are visible are placed in the text objects, so the cost doesn't depend on the length of the text.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateVisibleTexts();
+
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Draw the widget to a render target
@@ -487,30 +501,28 @@ namespace tgui
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        // Recalculates which lines are currently visible.
+        // Recalculates which lines are currently visible. The texts are updated when the visible lines changed.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void recalculateVisibleLines();
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        /// @brief Retrieves a signal based on its name
-        ///
-        /// @param signalName  Name of the signal
+        /// @brief Retrieves a signal based on the hash of its name
         ///
-        /// @return Signal that corresponds to the name
+        /// @param signalNameHash  Case-insensitive hash of the signal name, as returned by hashSignalName
         ///
-        /// @throw Exception when the name does not match any signal
+        /// @return Signal that corresponds to the hash or a nullptr when the widget has no signal with that name
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        Signal& getSignal(std::string signalName) override;
+        Signal* getSignal(std::uint64_t signalNameHash) override;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Function called when one of the properties of the renderer is changed
         ///
-        /// @param property  Lowercase name of the property that was changed
+        /// @param property  Id of the property that was changed
         ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void rendererChanged(const std::string& property) override;
+        void rendererChanged(RendererProperty property) override;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -543,7 +555,7 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
-        sf::String   m_text;
+        TextRope     m_text;
         unsigned int m_textSize = 18;
         unsigned int m_lineHeight = 24;
 
@@ -552,6 +564,22 @@ namespace tgui
 
         std::vector<sf::String> m_lines;
 
+        // Information about each paragraph (part of the text between newlines) from the last time the text was rearranged.
+        // This allows rearrangeText to only word-wrap the paragraphs that were changed.
+        struct ParagraphInfo
+        {
+            std::size_t length = 0;
+            std::size_t lineCount = 0;
+            float width = 0; // Width of the line when there is no word-wrap (character count with monospaced font optimization)
+        };
+        std::vector<ParagraphInfo> m_paragraphs;
+        float m_wordWrapWidth = 0;
+
+        // Part of the text that was changed since the paragraphs were last updated. The characters in front of m_changedTextStart
+        // and the last m_unchangedTextAtEnd characters are still the same (m_changedTextStart is InvalidPos when nothing changed).
+        std::size_t m_changedTextStart = sf::String::InvalidPos;
+        std::size_t m_unchangedTextAtEnd = 0;
+
         // The maximum characters (0 by default, which means no limit)
         std::size_t m_maxChars = 0;
 
@@ -559,6 +587,10 @@ namespace tgui
         std::size_t m_topLine = 1;
         std::size_t m_visibleLines = 1;
 
+        // The range of lines that is currently stored in the text objects (the visible lines)
+        std::size_t m_firstDrawnLine = 0;
+        std::size_t m_lastDrawnLine = 0;
+
         // Information about the selection
         sf::Vector2<std::size_t> m_selStart;
         sf::Vector2<std::size_t> m_selEnd;
@@ -0,0 +1,101 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2019 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#ifndef TGUI_WORKER_POOL_HPP
+#define TGUI_WORKER_POOL_HPP
+
+
+#include <TGUI/Config.hpp>
+#include <functional>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Threads on which slow work (e.g. rasterizing svg images) is performed without blocking the gui
+    ///
+    /// The threads are only started when the first task is added.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API WorkerPool
+    {
+      public:
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Runs a task on one of the worker threads
+        ///
+        /// @param task      Function that is called on a worker thread, it must not access widgets or create textures
+        /// @param finished  Optional function that is called on the gui thread after the task was completed
+        ///
+        /// The finished functions are called from processFinishedTasks, which Gui::draw calls every frame.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void addTask(std::function<void()> task, std::function<void()> finished = nullptr);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Calls the finished functions of the tasks that were completed since the last call
+        ///
+        /// @return Whether any task was completed since the last call
+        ///
+        /// This function is called by the gui, you only have to call it yourself when not drawing via a tgui::Gui.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static bool processFinishedTasks();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Blocks until all tasks that were added have been completed
+        ///
+        /// The finished functions of the tasks are not called by this function, call processFinishedTasks afterwards.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void waitForTasks();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the amount of worker threads
+        ///
+        /// @param count  Amount of threads that run tasks, values smaller than 1 are treated as 1
+        ///
+        /// The default amount is one less than the amount of hardware threads, with a minimum of 1.
+        /// Tasks that are already running will be completed before this function returns.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void setThreadCount(unsigned int count);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the amount of worker threads
+        ///
+        /// @return Amount of threads that run tasks
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static unsigned int getThreadCount();
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_WORKER_POOL_HPP
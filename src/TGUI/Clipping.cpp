@@ -24,6 +24,7 @@
 
 
 #include <TGUI/Clipping.hpp>
+#include <TGUI/RenderBatch.hpp>
 #include <cmath>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -35,9 +36,29 @@ namespace tgui
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Clipping::Clipping(sf::RenderTarget& target, const sf::RenderStates& states, Vector2f topLeft, Vector2f size) :
-        m_target {target},
-        m_oldView{target.getView()}
+        m_target{target}
     {
+        // When the requested area contains everything that is already visible, the intersection with the current clipping
+        // area is the current area itself and the view doesn't have to be changed
+        const sf::View& currentView = target.getView();
+        if (currentView.getRotation() == 0)
+        {
+            const FloatRect clipRect = getClipRect(target);
+            const FloatRect requestedRect = states.transform.transformRect({topLeft, size});
+            if ((requestedRect.left <= clipRect.left) && (requestedRect.top <= clipRect.top)
+             && (requestedRect.left + requestedRect.width >= clipRect.left + clipRect.width)
+             && (requestedRect.top + requestedRect.height >= clipRect.top + clipRect.height))
+            {
+                return;
+            }
+        }
+
+        m_oldView = currentView;
+        m_viewChanged = true;
+
+        // Triangles that were collected before have to be drawn with the old clipping
+        RenderBatch::flush(target);
+
         Vector2f bottomRight = Vector2f(states.transform.transformPoint(topLeft + size));
         topLeft = Vector2f(states.transform.transformPoint(topLeft));
 
@@ -97,7 +118,11 @@ namespace tgui
 
     Clipping::~Clipping()
     {
-        m_target.setView(m_oldView);
+        if (m_viewChanged)
+        {
+            RenderBatch::flush(m_target);
+            m_target.setView(m_oldView);
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -108,6 +133,14 @@ namespace tgui
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    FloatRect Clipping::getClipRect(const sf::RenderTarget& target)
+    {
+        // The inverse view transform maps the visible area, which is -1 to 1 in normalized device coordinates, back to the view
+        return target.getView().getInverseTransform().transformRect({-1, -1, 2, 2});
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
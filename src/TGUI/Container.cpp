@@ -25,10 +25,13 @@
 
 #include <TGUI/Container.hpp>
 #include <TGUI/ToolTip.hpp>
+#include <TGUI/Clipping.hpp>
 #include <TGUI/Widgets/RadioButton.hpp>
 #include <TGUI/Loading/WidgetFactory.hpp>
 
+#include <algorithm>
 #include <cassert>
+#include <cmath>
 #include <fstream>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -58,6 +61,31 @@ namespace tgui
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+        // Widgets covering more cells than this are checked on every search instead of being added to each of those cells
+        const std::int64_t maxCellsPerWidget = 256;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        int getCellCoordinate(float position, float cellSize)
+        {
+            const float cell = std::floor(position / cellSize);
+            if (!(cell > -1073741824.f))
+                return -1073741824;
+            else if (cell > 1073741824.f)
+                return 1073741824;
+            else
+                return static_cast<int>(cell);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        std::uint64_t getCellKey(int x, int y)
+        {
+            return (static_cast<std::uint64_t>(static_cast<std::uint32_t>(x)) << 32) | static_cast<std::uint32_t>(y);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
         std::unique_ptr<DataIO::Node> saveRenderer(RendererData* renderer, const std::string& name)
         {
             auto node = std::make_unique<DataIO::Node>();
@@ -73,7 +101,7 @@ namespace tgui
                     if (rendererRootNode->propertyValuePairs.empty() && (rendererRootNode->children.size() == 1))
                         rendererRootNode = std::move(rendererRootNode->children[0]);
 
-                    rendererRootNode->name = pair.first;
+                    rendererRootNode->name = getRendererPropertyName(pair.first);
                     node->children.push_back(std::move(rendererRootNode));
                 }
                 else
@@ -85,10 +113,10 @@ namespace tgui
                         continue;
 
                     // Skip "font = null"
-                    if (pair.first == "font" && value == "null")
+                    if (pair.first == RendererProperty::Font && value == "null")
                         continue;
 
-                    node->propertyValuePairs[pair.first] = std::make_unique<DataIO::ValueNode>(value);
+                    node->propertyValuePairs[getRendererPropertyName(pair.first)] = std::make_unique<DataIO::ValueNode>(value);
                 }
             }
 
@@ -108,7 +136,8 @@ namespace tgui
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Container::Container(const Container& other) :
-        Widget{other}
+        Widget                {other},
+        m_spatialIndexCellSize{other.m_spatialIndexCellSize}
     {
         // Copy all the widgets
         for (std::size_t i = 0; i < other.m_widgets.size(); ++i)
@@ -123,7 +152,8 @@ namespace tgui
         m_widgetNames         {std::move(other.m_widgetNames)},
         m_widgetBelowMouse    {std::move(other.m_widgetBelowMouse)},
         m_focusedWidget       {std::move(other.m_focusedWidget)},
-        m_handingMouseReleased{std::move(other.m_handingMouseReleased)}
+        m_handingMouseReleased{std::move(other.m_handingMouseReleased)},
+        m_spatialIndexCellSize{std::move(other.m_spatialIndexCellSize)}
     {
         for (auto& widget : m_widgets)
             widget->setParent(this);
@@ -153,6 +183,8 @@ namespace tgui
 
             m_widgetBelowMouse = nullptr;
             m_focusedWidget = nullptr;
+            m_spatialIndexCellSize = right.m_spatialIndexCellSize;
+            invalidateSpatialIndex();
 
             // Remove all the old widgets
             Container::removeAllWidgets();
@@ -181,6 +213,8 @@ namespace tgui
             m_widgetBelowMouse     = std::move(right.m_widgetBelowMouse);
             m_focusedWidget        = std::move(right.m_focusedWidget);
             m_handingMouseReleased = std::move(right.m_handingMouseReleased);
+            m_spatialIndexCellSize = std::move(right.m_spatialIndexCellSize);
+            invalidateSpatialIndex();
 
             for (auto& widget : m_widgets)
                 widget->setParent(this);
@@ -207,7 +241,7 @@ namespace tgui
             {
                 m_prevInnerSize = getInnerSize();
                 for (auto& layout : m_boundSizeLayouts)
-                    layout->recalculateValue();
+                    layout->boundWidgetChanged();
             }
         }
     }
@@ -297,6 +331,8 @@ namespace tgui
 
         m_widgetBelowMouse = nullptr;
         m_focusedWidget = nullptr;
+
+        invalidateSpatialIndex();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -473,6 +509,9 @@ namespace tgui
             // Remove the old widget
             m_widgets.erase(m_widgets.begin() + i);
             m_widgetNames.erase(m_widgetNames.begin() + i);
+
+            invalidateSpatialIndex();
+            invalidate();
             break;
         }
     }
@@ -496,6 +535,9 @@ namespace tgui
             // Remove the old widget
             m_widgets.erase(m_widgets.begin() + i + 1);
             m_widgetNames.erase(m_widgetNames.begin() + i + 1);
+
+            invalidateSpatialIndex();
+            invalidate();
             break;
         }
     }
@@ -745,16 +787,16 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Container::rendererChanged(const std::string& property)
+    void Container::rendererChanged(RendererProperty property)
     {
         Widget::rendererChanged(property);
 
-        if ((property == "opacity") || (property == "opacitydisabled"))
+        if ((property == RendererProperty::Opacity) || (property == RendererProperty::OpacityDisabled))
         {
             for (std::size_t i = 0; i < m_widgets.size(); ++i)
                 m_widgets[i]->setInheritedOpacity(m_opacityCached);
         }
-        else if (property == "font")
+        else if (property == RendererProperty::Font)
         {
             for (const auto& widget : m_widgets)
             {
@@ -995,38 +1037,245 @@ namespace tgui
 
     Widget::Ptr Container::mouseOnWhichWidget(Vector2f mousePos)
     {
-        Widget::Ptr widget = nullptr;
-        for (auto it = m_widgets.rbegin(); it != m_widgets.rend(); ++it)
+        const std::size_t index = findWidgetIndexBelowMouse(mousePos);
+        Widget* const widget = (index < m_widgets.size()) ? m_widgets[index].get() : nullptr;
+
+        // If the mouse is on a different widget, tell the old widget that the mouse has left.
+        // The shared pointer is only copied when the widget below the mouse actually changes.
+        if (m_widgetBelowMouse.get() != widget)
+        {
+            if (m_widgetBelowMouse)
+                m_widgetBelowMouse->mouseNoLongerOnWidget();
+
+            if (widget)
+                m_widgetBelowMouse = m_widgets[index];
+            else
+                m_widgetBelowMouse = nullptr;
+        }
+
+        return m_widgetBelowMouse;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t Container::findWidgetIndexBelowMouse(Vector2f mousePos)
+    {
+        if (updateSpatialIndex())
         {
-            if ((*it)->isVisible())
+            static const std::vector<std::size_t> emptyCell;
+            const auto cellIt = m_spatialIndexCells.find(getCellKey(getCellCoordinate(mousePos.x, m_spatialIndexCellSize),
+                                                                    getCellCoordinate(mousePos.y, m_spatialIndexCellSize)));
+            const std::vector<std::size_t>& cell = (cellIt != m_spatialIndexCells.end()) ? cellIt->second : emptyCell;
+
+            // Merge the widgets in the cell with the large widgets, starting with the one in front
+            auto cellRevIt = cell.rbegin();
+            auto largeRevIt = m_spatialIndexLargeWidgets.rbegin();
+            while ((cellRevIt != cell.rend()) || (largeRevIt != m_spatialIndexLargeWidgets.rend()))
             {
-                if ((*it)->mouseOnWidget(mousePos))
-                {
-                    if ((*it)->isEnabled())
-                        widget = *it;
+                std::size_t index;
+                if ((largeRevIt == m_spatialIndexLargeWidgets.rend()) || ((cellRevIt != cell.rend()) && (*cellRevIt > *largeRevIt)))
+                    index = *cellRevIt++;
+                else
+                    index = *largeRevIt++;
 
-                    break;
-                }
+                const Widget* widget = m_widgets[index].get();
+                if (widget->isVisible() && widget->mouseOnWidget(mousePos))
+                    return widget->isEnabled() ? index : m_widgets.size();
             }
+
+            return m_widgets.size();
         }
 
-        // If the mouse is on a different widget, tell the old widget that the mouse has left
-        if (m_widgetBelowMouse && (widget != m_widgetBelowMouse))
-            m_widgetBelowMouse->mouseNoLongerOnWidget();
+        for (std::size_t i = m_widgets.size(); i > 0; --i)
+        {
+            const Widget* widget = m_widgets[i-1].get();
+            if (widget->isVisible() && widget->mouseOnWidget(mousePos))
+                return widget->isEnabled() ? (i-1) : m_widgets.size();
+        }
+
+        return m_widgets.size();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::setSpatialIndexCellSize(float cellSize)
+    {
+        m_spatialIndexCellSize = std::max(0.f, cellSize);
+        invalidateSpatialIndex();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        m_widgetBelowMouse = widget;
-        return widget;
+    float Container::getSpatialIndexCellSize() const
+    {
+        return m_spatialIndexCellSize;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::childWidgetBoundsChanged(const Widget* child)
+    {
+        // Nothing has to be tracked when the grid is disabled or when it is going to be rebuilt anyway
+        if ((m_spatialIndexCellSize == 0) || m_spatialIndexDirty)
+            return;
+
+        const auto it = m_spatialIndexEntries.find(child);
+        if (it == m_spatialIndexEntries.end())
+        {
+            m_spatialIndexDirty = true;
+            return;
+        }
+
+        // The cells are only updated when the grid is needed, as the widget might still be moved again before that
+        if (!it->second.pending)
+        {
+            it->second.pending = true;
+            m_spatialIndexPendingWidgets.push_back(child);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::invalidateSpatialIndex()
+    {
+        m_spatialIndexDirty = true;
+        m_spatialIndexCells.clear();
+        m_spatialIndexLargeWidgets.clear();
+        m_spatialIndexEntries.clear();
+        m_spatialIndexPendingWidgets.clear();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Container::updateSpatialIndex()
+    {
+        if (m_spatialIndexCellSize == 0)
+            return false;
+
+        if (m_spatialIndexDirty)
+        {
+            invalidateSpatialIndex();
+            m_spatialIndexEntries.reserve(m_widgets.size());
+            for (std::size_t i = 0; i < m_widgets.size(); ++i)
+            {
+                m_spatialIndexEntries[m_widgets[i].get()].index = i;
+                insertInSpatialIndex(i);
+            }
+
+            m_spatialIndexDirty = false;
+        }
+        else if (!m_spatialIndexPendingWidgets.empty())
+        {
+            for (const Widget* widget : m_spatialIndexPendingWidgets)
+            {
+                auto& entry = m_spatialIndexEntries[widget];
+                entry.pending = false;
+                removeFromSpatialIndex(entry.index);
+                insertInSpatialIndex(entry.index);
+            }
+
+            m_spatialIndexPendingWidgets.clear();
+        }
+
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::insertInSpatialIndex(std::size_t index)
+    {
+        const Widget* widget = m_widgets[index].get();
+        const Vector2f topLeft = widget->getPosition() + widget->getWidgetOffset();
+        const Vector2f bottomRight = topLeft + widget->getFullSize();
+
+        auto& entry = m_spatialIndexEntries[widget];
+        entry.left = getCellCoordinate(std::min(topLeft.x, bottomRight.x), m_spatialIndexCellSize);
+        entry.top = getCellCoordinate(std::min(topLeft.y, bottomRight.y), m_spatialIndexCellSize);
+        entry.right = getCellCoordinate(std::max(topLeft.x, bottomRight.x), m_spatialIndexCellSize);
+        entry.bottom = getCellCoordinate(std::max(topLeft.y, bottomRight.y), m_spatialIndexCellSize);
+
+        const std::int64_t cellCount = (static_cast<std::int64_t>(entry.right) - entry.left + 1)
+                                     * (static_cast<std::int64_t>(entry.bottom) - entry.top + 1);
+        entry.large = (cellCount > maxCellsPerWidget);
+
+        // Indices are inserted in order while rebuilding, so the position in the lists is usually found at the end
+        if (entry.large)
+        {
+            m_spatialIndexLargeWidgets.insert(std::lower_bound(m_spatialIndexLargeWidgets.begin(), m_spatialIndexLargeWidgets.end(), index), index);
+            return;
+        }
+
+        for (int y = entry.top; y <= entry.bottom; ++y)
+        {
+            for (int x = entry.left; x <= entry.right; ++x)
+            {
+                auto& cell = m_spatialIndexCells[getCellKey(x, y)];
+                cell.insert(std::lower_bound(cell.begin(), cell.end(), index), index);
+            }
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::removeFromSpatialIndex(std::size_t index)
+    {
+        const auto& entry = m_spatialIndexEntries[m_widgets[index].get()];
+        if (entry.large)
+        {
+            const auto it = std::lower_bound(m_spatialIndexLargeWidgets.begin(), m_spatialIndexLargeWidgets.end(), index);
+            if ((it != m_spatialIndexLargeWidgets.end()) && (*it == index))
+                m_spatialIndexLargeWidgets.erase(it);
+
+            return;
+        }
+
+        for (int y = entry.top; y <= entry.bottom; ++y)
+        {
+            for (int x = entry.left; x <= entry.right; ++x)
+            {
+                const auto cellIt = m_spatialIndexCells.find(getCellKey(x, y));
+                if (cellIt == m_spatialIndexCells.end())
+                    continue;
+
+                auto& cell = cellIt->second;
+                const auto it = std::lower_bound(cell.begin(), cell.end(), index);
+                if ((it != cell.end()) && (*it == index))
+                    cell.erase(it);
+
+                if (cell.empty())
+                    m_spatialIndexCells.erase(cellIt);
+            }
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void Container::drawWidgetContainer(sf::RenderTarget* target, const sf::RenderStates& states) const
     {
-        // Draw all widgets when they are visible
+        // Collect the geometry of all widgets, so that it can be drawn with as little draw calls as possible
+        RenderBatch batch{*target};
+
+        // Draw all widgets when they are visible, but skip the ones that lie completely outside the clipping area
+        const FloatRect clipRect = Clipping::getClipRect(*target);
         for (const auto& widget : m_widgets)
         {
-            if (widget->isVisible())
+            if (!widget->isVisible())
+                continue;
+
+            const FloatRect bounds = states.transform.transformRect(widget->getDrawBounds());
+            if ((bounds.left > clipRect.left + clipRect.width) || (bounds.left + bounds.width < clipRect.left)
+             || (bounds.top > clipRect.top + clipRect.height) || (bounds.top + bounds.height < clipRect.top))
+                continue;
+
+            // Widgets that may draw directly on the target can't have their geometry collected
+            const Widget& drawnWidget = *widget;
+            if (drawnWidget.m_renderBatchType && (typeid(drawnWidget) == *drawnWidget.m_renderBatchType))
                 widget->draw(*target, states);
+            else
+            {
+                RenderBatch unbatched{*target, false};
+                widget->draw(*target, states);
+            }
         }
     }
 
@@ -1088,6 +1337,7 @@ namespace tgui
     GuiContainer::GuiContainer()
     {
         m_type = "GuiContainer";
+        m_renderBatchType = &typeid(GuiContainer);
         m_focused = true;
         m_isolatedFocus = true;
     }
@@ -1108,6 +1358,13 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void GuiContainer::invalidate()
+    {
+        m_redrawNeeded = true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     bool GuiContainer::mouseOnWidget(Vector2f) const
     {
         return true;
@@ -200,9 +200,9 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void CustomWidgetForBindings::rendererChanged(const std::string& property)
+    void CustomWidgetForBindings::rendererChanged(RendererProperty property)
     {
-        if (!implRendererChanged(property))
+        if (!implRendererChanged(getRendererPropertyName(property)))
             Widget::rendererChanged(property);
     }
 
@@ -27,11 +27,62 @@
 #include <TGUI/Loading/Deserializer.hpp>
 
 #include <cassert>
+#include <map>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
 {
+    namespace
+    {
+        struct FontGlyphAdvanceTables
+        {
+            // The address of a destroyed font can be reused by a new font, in which case the tables are no longer valid
+            std::weak_ptr<sf::Font> font;
+
+            std::map<std::pair<unsigned int, bool>, std::unique_ptr<GlyphAdvanceTable>> tables;
+        };
+
+        std::map<const sf::Font*, FontGlyphAdvanceTables> glyphAdvanceTables;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    GlyphAdvanceTable::GlyphAdvanceTable(const sf::Font& font, unsigned int characterSize, bool bold) :
+        m_font         (font),
+        m_characterSize{characterSize},
+        m_bold         {bold}
+    {
+        m_advances.fill(-1);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    float GlyphAdvanceTable::loadAdvance(std::uint32_t codePoint) const
+    {
+        const float advance = m_font.getGlyph(codePoint, m_characterSize, m_bold).advance;
+        if (codePoint < m_advances.size())
+            m_advances[codePoint] = advance;
+
+        return advance;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    float GlyphAdvanceTable::loadKerning(std::uint32_t first, std::uint32_t second) const
+    {
+        if (first >= m_kerning.size())
+            return m_font.getKerning(first, second, m_characterSize);
+
+        auto row = std::make_unique<std::array<float, 256>>();
+        for (std::uint32_t i = 0; i < row->size(); ++i)
+            (*row)[i] = m_font.getKerning(first, i, m_characterSize);
+
+        m_kerning[first] = std::move(row);
+        return (second < m_kerning.size()) ? (*m_kerning[first])[second] : m_font.getKerning(first, second, m_characterSize);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Font::Font(std::nullptr_t)
@@ -228,6 +279,36 @@ namespace tgui
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const GlyphAdvanceTable& Font::getGlyphAdvanceTable(unsigned int characterSize, bool bold) const
+    {
+        assert(m_font != nullptr);
+
+        FontGlyphAdvanceTables& fontTables = glyphAdvanceTables[m_font.get()];
+        if (fontTables.font.expired())
+        {
+            // Either the font had no tables yet or this is a new font with the address of a destroyed one.
+            // Remove the tables of all destroyed fonts while we are at it.
+            for (auto it = glyphAdvanceTables.begin(); it != glyphAdvanceTables.end();)
+            {
+                if ((it->first != m_font.get()) && it->second.font.expired())
+                    it = glyphAdvanceTables.erase(it);
+                else
+                    ++it;
+            }
+
+            fontTables.tables.clear();
+            fontTables.font = m_font;
+        }
+
+        auto& table = fontTables.tables[{characterSize, bold}];
+        if (!table)
+            table = std::unique_ptr<GlyphAdvanceTable>(new GlyphAdvanceTable(*m_font, characterSize, bold));
+
+        return *table;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
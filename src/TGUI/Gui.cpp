@@ -26,6 +26,7 @@
 #include <TGUI/Clipboard.hpp>
 #include <TGUI/ToolTip.hpp>
 #include <TGUI/Clipping.hpp>
+#include <TGUI/WorkerPool.hpp>
 
 #include <SFML/Graphics/RenderTexture.hpp>
 
@@ -113,6 +114,7 @@ namespace tgui
         m_target = &target;
 
         setView(target.getDefaultView());
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -133,11 +135,16 @@ namespace tgui
             m_container->m_size = view.getSize();
             m_container->onSizeChange.emit(m_container.get(), m_container->getSize());
 
+            // Update all widgets that depend on the size of the window at once, so that each widget only changes once
+            Layout::beginDeferredRecalculation();
             for (auto& layout : m_container->m_boundSizeLayouts)
-                layout->recalculateValue();
+                layout->boundWidgetChanged();
+            Layout::endDeferredRecalculation();
         }
         else // Set it anyway in case something changed that we didn't care to check
             m_view = view;
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -246,6 +253,9 @@ namespace tgui
         #endif
         }
 
+        // Any event can change the state of the widgets, e.g. by hovering or unhovering them
+        invalidate();
+
         return m_container->handleEvent(event);
     }
 
@@ -284,18 +294,43 @@ namespace tgui
         assert(m_target != nullptr);
 
         // Update the time
-        if (m_windowFocused)
-            updateTime(m_clock.restart());
-        else
-            m_clock.restart();
+        updateTimeFromClock();
+
+        // Create the textures of images that were loaded or rasterized in the background
+        if (WorkerPool::processFinishedTasks())
+            invalidate();
 
-        // Change the view
         const sf::View oldView = m_target->getView();
-        m_target->setView(m_view);
-        Clipping::setGuiView(m_view);
+        if (m_renderTexture && updateRenderTexture())
+        {
+            // Draw the previously drawn widgets with a single draw call. The render texture contains premultiplied colors,
+            // because it was cleared with a transparent color before drawing the widgets on it.
+            const Vector2f size{sf::Vector2f{m_renderTexture->getSize()}};
+            const sf::Vertex vertices[] = {
+                {{0, 0}, {0, 0}},
+                {{0, size.y}, {0, size.y}},
+                {{size.x, 0}, {size.x, 0}},
+                {{size.x, size.y}, {size.x, size.y}}
+            };
+
+            sf::RenderStates states;
+            states.texture = &m_renderTexture->getTexture();
+            states.blendMode = sf::BlendMode{sf::BlendMode::One, sf::BlendMode::OneMinusSrcAlpha};
+
+            m_target->setView(m_target->getDefaultView());
+            m_target->draw(vertices, 4, sf::PrimitiveType::TrianglesStrip, states);
+        }
+        else
+        {
+            // Change the view
+            m_target->setView(m_view);
+            Clipping::setGuiView(m_view);
+
+            // Draw the widgets
+            m_container->drawWidgetContainer(m_target, sf::RenderStates::Default);
+        }
 
-        // Draw the widgets
-        m_container->drawWidgetContainer(m_target, sf::RenderStates::Default);
+        m_container->m_redrawNeeded = false;
 
         // Restore the old view
         m_target->setView(oldView);
@@ -303,6 +338,45 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool Gui::isRedrawNeeded()
+    {
+        updateTimeFromClock();
+
+        if (WorkerPool::processFinishedTasks())
+            invalidate();
+
+        return m_container->m_redrawNeeded;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Gui::invalidate()
+    {
+        m_container->invalidate();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Gui::setRetainedRenderingEnabled(bool enabled)
+    {
+        if (enabled && !m_renderTexture)
+        {
+            m_renderTexture = std::make_unique<sf::RenderTexture>();
+            invalidate();
+        }
+        else if (!enabled)
+            m_renderTexture = nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Gui::isRetainedRenderingEnabled() const
+    {
+        return m_renderTexture != nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     GuiContainer::Ptr Gui::getContainer() const
     {
         return m_container;
@@ -484,6 +558,46 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Gui::updateTimeFromClock()
+    {
+        if (m_windowFocused)
+            updateTime(m_clock.restart());
+        else
+            m_clock.restart();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Gui::updateRenderTexture()
+    {
+        const sf::Vector2u targetSize = m_target->getSize();
+        if (m_renderTexture->getSize() != targetSize)
+        {
+            if (!m_renderTexture->create(targetSize.x, targetSize.y))
+            {
+                TGUI_PRINT_WARNING("Failed to create render texture for retained rendering, widgets will be drawn directly.");
+                m_renderTexture = nullptr;
+                return false;
+            }
+
+            m_container->m_redrawNeeded = true;
+        }
+
+        if (m_container->m_redrawNeeded)
+        {
+            m_renderTexture->clear(sf::Color::Transparent);
+            m_renderTexture->setView(m_view);
+            Clipping::setGuiView(m_view);
+
+            m_container->drawWidgetContainer(m_renderTexture.get(), sf::RenderStates::Default);
+            m_renderTexture->display();
+        }
+
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Gui::init()
     {
     #ifdef SFML_SYSTEM_WINDOWS
@@ -28,12 +28,171 @@
 #include <TGUI/Gui.hpp>
 #include <TGUI/to_string.hpp>
 #include <SFML/System/Err.hpp>
+#include <unordered_map>
+#include <algorithm>
 #include <cassert>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
 {
+    namespace
+    {
+        // Layouts are only marked as dirty when the position or size of a widget changes while this is larger than 0
+        unsigned int deferredRecalculationDepth = 0;
+
+        // Counter to know which layouts were already evaluated while going over the dirty layouts
+        unsigned int recalculationPass = 0;
+
+        // Layouts that have to be evaluated when the deferred recalculation ends
+        std::vector<Layout*> dirtyLayouts;
+
+        bool isBindingOperation(Layout::Operation operation)
+        {
+            return (operation == Layout::Operation::BindingLeft) || (operation == Layout::Operation::BindingTop)
+                || (operation == Layout::Operation::BindingWidth) || (operation == Layout::Operation::BindingHeight)
+                || (operation == Layout::Operation::BindingInnerWidth) || (operation == Layout::Operation::BindingInnerHeight)
+                || (operation == Layout::Operation::BindingString);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    // The expression is stored as a flat list of nodes, in which the operands are always placed in front of the node that uses
+    // them and the last node contains the result. The nodes that don't depend on any widget are calculated while compiling.
+    struct Layout::Program
+    {
+        struct Node
+        {
+            Operation operation = Operation::Value;
+            bool constant = true; // The node doesn't depend on any binding, so its value never changes
+            float value = 0; // The constant or the calculated value when the node doesn't depend on a binding
+            std::size_t leftOperand = 0; // Index of the left operand node in case of a math operation
+            std::size_t rightOperand = 0; // Index of the right operand node in case of a math operation
+            std::size_t binding = 0; // Index in the bindings of the layout in case of a binding
+        };
+
+        std::size_t addValue(float value)
+        {
+            Node node;
+            node.value = value;
+            nodes.push_back(node);
+            return nodes.size() - 1;
+        }
+
+        std::size_t addBinding(Operation operation, std::string bindingString)
+        {
+            Node node;
+            node.operation = operation;
+            node.constant = false;
+            node.binding = bindingStrings.size();
+            nodes.push_back(node);
+
+            bindingStrings.push_back(std::move(bindingString));
+            return nodes.size() - 1;
+        }
+
+        std::size_t addOperation(Operation operation, std::size_t leftOperand, std::size_t rightOperand)
+        {
+            Node node;
+            node.operation = operation;
+            node.leftOperand = leftOperand;
+            node.rightOperand = rightOperand;
+
+            // Constant folding, the result of an operation on two constants is already calculated here
+            node.constant = nodes[leftOperand].constant && nodes[rightOperand].constant;
+            if (node.constant)
+                node.value = calculate(operation, nodes[leftOperand].value, nodes[rightOperand].value);
+
+            nodes.push_back(node);
+            return nodes.size() - 1;
+        }
+
+        // Copies the nodes of the layout and returns the index of the node containing its result
+        std::size_t addLayout(const Layout& layout)
+        {
+            if (!layout.m_program)
+                return addValue(layout.m_value);
+
+            const std::size_t nodeOffset = nodes.size();
+            const std::size_t bindingOffset = bindingStrings.size();
+            for (Node node : layout.m_program->nodes)
+            {
+                if (isBindingOperation(node.operation))
+                    node.binding += bindingOffset;
+                else if (node.operation != Operation::Value)
+                {
+                    node.leftOperand += nodeOffset;
+                    node.rightOperand += nodeOffset;
+                }
+
+                nodes.push_back(node);
+            }
+
+            bindingStrings.insert(bindingStrings.end(), layout.m_program->bindingStrings.begin(), layout.m_program->bindingStrings.end());
+            return nodes.size() - 1;
+        }
+
+        // Copies the node and its operands to the other program, which drops the unused nodes that parsing leaves behind
+        std::size_t copyTo(Program& program, std::size_t index) const
+        {
+            const Node& node = nodes[index];
+            if (node.operation == Operation::Value)
+                return program.addValue(node.value);
+            else if (isBindingOperation(node.operation))
+                return program.addBinding(node.operation, bindingStrings[node.binding]);
+            else
+            {
+                const std::size_t leftOperand = copyTo(program, node.leftOperand);
+                const std::size_t rightOperand = copyTo(program, node.rightOperand);
+                return program.addOperation(node.operation, leftOperand, rightOperand);
+            }
+        }
+
+        std::size_t parse(std::string expression);
+
+        float evaluate(std::size_t index, const std::vector<Binding>& bindings) const
+        {
+            const Node& node = nodes[index];
+            if (node.constant)
+                return node.value;
+
+            if (isBindingOperation(node.operation))
+                return bindings[node.binding].value;
+
+            return calculate(node.operation, evaluate(node.leftOperand, bindings), evaluate(node.rightOperand, bindings));
+        }
+
+        std::string toString(std::size_t index) const;
+
+        static float calculate(Operation operation, float left, float right)
+        {
+            switch (operation)
+            {
+                case Operation::Plus:
+                    return left + right;
+                case Operation::Minus:
+                    return left - right;
+                case Operation::Multiplies:
+                    return left * right;
+                case Operation::Divides:
+                    return (right != 0) ? (left / right) : 0;
+                case Operation::Minimum:
+                    return std::min(left, right);
+                case Operation::Maximum:
+                    return std::max(left, right);
+                default:
+                    assert(false);
+                    return 0;
+            }
+        }
+
+        std::vector<Node> nodes;
+        std::vector<std::string> bindingStrings; // For each binding, the string that refers to the widget (empty for bind functions)
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     static std::pair<std::string, std::string> parseMinMaxExpresssion(const std::string& expression)
     {
         unsigned int bracketCount = 0;
@@ -64,12 +223,12 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    Layout::Layout(std::string expression)
+    std::size_t Layout::Program::parse(std::string expression)
     {
         // Empty strings have value 0 (although this might indicate a mistake in the expression, it is valid for unary minus)
         expression = trim(expression);
         if (expression.empty())
-            return;
+            return addValue(0);
 
         auto searchPos = expression.find_first_of("+-/*()");
 
@@ -81,15 +240,11 @@ namespace tgui
             {
                 // We don't know if we have to bind the width or height, so bind "size" and let the connectWidget function figure it out later
                 if (expression == "100%")
-                {
-                    m_boundString = "&.innersize";
-                    m_operation = Operation::BindingString;
-                }
+                    return addBinding(Operation::BindingString, "&.innersize");
                 else // value is a fraction of parent size
                 {
-                    *this = Layout{Layout::Operation::Multiplies,
-                                   std::make_unique<Layout>(tgui::stof(expression.substr(0, expression.length()-1)) / 100.f),
-                                   std::make_unique<Layout>("&.innersize")};
+                    const std::size_t fraction = addValue(tgui::stof(expression.substr(0, expression.length()-1)) / 100.f);
+                    return addOperation(Operation::Multiplies, fraction, addBinding(Operation::BindingString, "&.innersize"));
                 }
             }
             else
@@ -114,30 +269,25 @@ namespace tgui
                  || (expression.size() >= 11 && expression.substr(expression.size()-11) == "innerheight"))
                 {
                     // We can't search for the referenced widget yet as no widget is connected to the widget yet, so store the string for future parsing
-                    m_boundString = expression;
-                    m_operation = Operation::BindingString;
+                    return addBinding(Operation::BindingString, expression);
                 }
                 else if (expression.size() >= 5 && expression.substr(expression.size()-5) == "right")
                 {
-                    *this = Layout{Operation::Plus,
-                                   std::make_unique<Layout>(expression.substr(0, expression.size()-5) + "left"),
-                                   std::make_unique<Layout>(expression.substr(0, expression.size()-5) + "width")};
+                    const std::size_t left = addBinding(Operation::BindingString, expression.substr(0, expression.size()-5) + "left");
+                    return addOperation(Operation::Plus, left, addBinding(Operation::BindingString, expression.substr(0, expression.size()-5) + "width"));
                 }
                 else if (expression.size() >= 6 && expression.substr(expression.size()-6) == "bottom")
                 {
-                    *this = Layout{Operation::Plus,
-                                   std::make_unique<Layout>(expression.substr(0, expression.size()-6) + "top"),
-                                   std::make_unique<Layout>(expression.substr(0, expression.size()-6) + "height")};
+                    const std::size_t top = addBinding(Operation::BindingString, expression.substr(0, expression.size()-6) + "top");
+                    return addOperation(Operation::Plus, top, addBinding(Operation::BindingString, expression.substr(0, expression.size()-6) + "height"));
                 }
                 else // Constant value
-                    m_value = tgui::stof(expression);
+                    return addValue(tgui::stof(expression));
             }
-
-            return;
         }
 
-        // The string contains an expression, so split it up in multiple layouts
-        std::list<Layout> operands;
+        // The string contains an expression, so split it up in multiple parts
+        std::vector<std::size_t> operands;
         std::vector<Operation> operators;
         decltype(searchPos) prevSearchPos = 0;
         while (searchPos != std::string::npos)
@@ -146,19 +296,19 @@ namespace tgui
             {
             case '+':
                 operators.push_back(Operation::Plus);
-                operands.emplace_back(expression.substr(prevSearchPos, searchPos - prevSearchPos));
+                operands.push_back(parse(expression.substr(prevSearchPos, searchPos - prevSearchPos)));
                 break;
             case '-':
                 operators.push_back(Operation::Minus);
-                operands.emplace_back(expression.substr(prevSearchPos, searchPos - prevSearchPos));
+                operands.push_back(parse(expression.substr(prevSearchPos, searchPos - prevSearchPos)));
                 break;
             case '*':
                 operators.push_back(Operation::Multiplies);
-                operands.emplace_back(expression.substr(prevSearchPos, searchPos - prevSearchPos));
+                operands.push_back(parse(expression.substr(prevSearchPos, searchPos - prevSearchPos)));
                 break;
             case '/':
                 operators.push_back(Operation::Divides);
-                operands.emplace_back(expression.substr(prevSearchPos, searchPos - prevSearchPos));
+                operands.push_back(parse(expression.substr(prevSearchPos, searchPos - prevSearchPos)));
                 break;
             case '(':
             {
@@ -175,21 +325,18 @@ namespace tgui
                     {
                         // If the entire layout was in brackets then remove these brackets
                         if ((searchPos == 0) && (bracketPos == expression.size()-1))
-                        {
-                            *this = Layout{expression.substr(1, expression.size()-2)};
-                            return;
-                        }
+                            return parse(expression.substr(1, expression.size()-2));
                         else if ((searchPos == 3) && (bracketPos == expression.size()-1) && (expression.substr(0, 3) == "min"))
                         {
                             const auto& minSubExpressions = parseMinMaxExpresssion(expression.substr(4, expression.size() - 5));
-                            *this = Layout{Operation::Minimum, std::make_unique<Layout>(minSubExpressions.first), std::make_unique<Layout>(minSubExpressions.second)};
-                            return;
+                            const std::size_t left = parse(minSubExpressions.first);
+                            return addOperation(Operation::Minimum, left, parse(minSubExpressions.second));
                         }
                         else if ((searchPos == 3) && (bracketPos == expression.size()-1) && (expression.substr(0, 3) == "max"))
                         {
                             const auto& maxSubExpressions = parseMinMaxExpresssion(expression.substr(4, expression.size() - 5));
-                            *this = Layout{Operation::Maximum, std::make_unique<Layout>(maxSubExpressions.first), std::make_unique<Layout>(maxSubExpressions.second)};
-                            return;
+                            const std::size_t left = parse(maxSubExpressions.first);
+                            return addOperation(Operation::Maximum, left, parse(maxSubExpressions.second));
                         }
                         else // The brackets form a sub-expression
                             searchPos = bracketPos;
@@ -203,7 +350,7 @@ namespace tgui
                 if (bracketPos == std::string::npos)
                 {
                     TGUI_PRINT_WARNING("bracket mismatch while parsing layout string '" << expression << "'.");
-                    return;
+                    return addValue(0);
                 }
                 else
                 {
@@ -214,7 +361,7 @@ namespace tgui
             }
             case ')':
                 TGUI_PRINT_WARNING("bracket mismatch while parsing layout string '" << expression << "'.");
-                return;
+                return addValue(0);
             };
 
             prevSearchPos = searchPos + 1;
@@ -225,145 +372,221 @@ namespace tgui
         {
             // We would get an infinite loop if we don't abort in this condition
             TGUI_PRINT_WARNING("error in expression '" << expression << "'.");
-            return;
+            return addValue(0);
         }
 
-        operands.emplace_back(expression.substr(prevSearchPos));
+        operands.push_back(parse(expression.substr(prevSearchPos)));
 
         // First perform all * and / operations
-        auto operandIt = operands.begin();
+        std::size_t operandIndex = 0;
         for (std::size_t i = 0; i < operators.size(); ++i)
         {
             if ((operators[i] == Operation::Multiplies) || (operators[i] == Operation::Divides))
             {
-                auto nextOperandIt = operandIt;
-                std::advance(nextOperandIt, 1);
-
-                (*operandIt) = Layout{operators[i],
-                                      std::make_unique<Layout>(*operandIt),
-                                      std::make_unique<Layout>(*nextOperandIt)};
-
-                operands.erase(nextOperandIt);
+                operands[operandIndex] = addOperation(operators[i], operands[operandIndex], operands[operandIndex + 1]);
+                operands.erase(operands.begin() + operandIndex + 1);
             }
             else
-                ++operandIt;
+                ++operandIndex;
         }
 
         // Now perform all + and - operations
-        operandIt = operands.begin();
         for (std::size_t i = 0; i < operators.size(); ++i)
         {
             if ((operators[i] == Operation::Plus) || (operators[i] == Operation::Minus))
             {
-                assert(operandIt != operands.end());
-
-                auto nextOperandIt = operandIt;
-                std::advance(nextOperandIt, 1);
-
-                assert(nextOperandIt != operands.end());
+                assert(operands.size() >= 2);
 
                 // Handle unary plus or minus
-                if ((operandIt->m_operation == Operation::Value) && (nextOperandIt->m_operation == Operation::Value) && (operandIt->m_value == 0))
+                const Node& leftNode = nodes[operands[0]];
+                const Node& rightNode = nodes[operands[1]];
+                if ((leftNode.operation == Operation::Value) && (rightNode.operation == Operation::Value) && (leftNode.value == 0))
                 {
                     if (operators[i] == Operation::Minus)
-                        nextOperandIt->m_value = -nextOperandIt->m_value;
-
-                    *operandIt = *nextOperandIt;
+                        operands[0] = addValue(-rightNode.value);
+                    else
+                        operands[0] = operands[1];
                 }
                 else // Normal addition or subtraction
-                {
-                    *operandIt = Layout{operators[i],
-                                        std::make_unique<Layout>(*operandIt),
-                                        std::make_unique<Layout>(*nextOperandIt)};
-                }
+                    operands[0] = addOperation(operators[i], operands[0], operands[1]);
 
-                operands.erase(nextOperandIt);
+                operands.erase(operands.begin() + 1);
             }
         }
 
         assert(operands.size() == 1);
-        *this = operands.front();
+        return operands.front();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    Layout::Layout(Operation operation, Widget* boundWidget) :
-        m_operation  {operation},
-        m_boundWidget{boundWidget}
+    std::string Layout::Program::toString(std::size_t index) const
     {
-        assert((m_operation == Operation::BindingLeft) || (m_operation == Operation::BindingTop)
-               || (m_operation == Operation::BindingWidth) || (m_operation == Operation::BindingHeight)
-               || (m_operation == Operation::BindingInnerWidth) || (m_operation == Operation::BindingInnerHeight));
-        assert(m_boundWidget != nullptr);
+        const Node& node = nodes[index];
+        if (node.operation == Operation::Value)
+        {
+            return to_string(node.value);
+        }
+        else if (node.operation == Operation::Minimum)
+        {
+            return "min(" + toString(node.leftOperand) + ", " + toString(node.rightOperand) + ")";
+        }
+        else if (node.operation == Operation::Maximum)
+        {
+            return "max(" + toString(node.leftOperand) + ", " + toString(node.rightOperand) + ")";
+        }
+        else if ((node.operation == Operation::Plus) || (node.operation == Operation::Minus) || (node.operation == Operation::Multiplies) || (node.operation == Operation::Divides))
+        {
+            char operatorChar;
+            if (node.operation == Operation::Plus)
+                operatorChar = '+';
+            else if (node.operation == Operation::Minus)
+                operatorChar = '-';
+            else if (node.operation == Operation::Multiplies)
+                operatorChar = '*';
+            else // if (node.operation == Operation::Divides)
+                operatorChar = '/';
+
+            auto subExpressionNeedsBrackets = [this](std::size_t operandIndex)
+                {
+                    const Node& operand = nodes[operandIndex];
+                    if ((operand.operation == Operation::Value) || isBindingOperation(operand.operation))
+                        return false;
+
+                    if ((operand.operation == Operation::Minimum) || (operand.operation == Operation::Maximum))
+                        return false;
+
+                    if ((operand.operation == Operation::Multiplies) && (nodes[operand.leftOperand].operation == Operation::Value) && (toString(operand.rightOperand) == "100%"))
+                        return false;
+
+                    return true;
+                };
+
+            const std::string left = toString(node.leftOperand);
+            const std::string right = toString(node.rightOperand);
+            if (subExpressionNeedsBrackets(node.leftOperand) && subExpressionNeedsBrackets(node.rightOperand))
+                return "(" + left + ") " + operatorChar + " (" + right + ")";
+            else if (subExpressionNeedsBrackets(node.leftOperand))
+                return "(" + left + ") " + operatorChar + " " + right;
+            else if (subExpressionNeedsBrackets(node.rightOperand))
+                return left + " " + operatorChar + " (" + right + ")";
+            else
+            {
+                if ((node.operation == Operation::Multiplies) && (nodes[node.leftOperand].operation == Operation::Value) && (right == "100%"))
+                    return to_string(nodes[node.leftOperand].value * 100) + '%';
+                else
+                    return left + " " + operatorChar + " " + right;
+            }
+        }
+        else
+        {
+            if (bindingStrings[node.binding] == "&.innersize")
+                return "100%";
+
+            // Hopefully the expression is stored in the binding string, otherwise (i.e. when bind functions were used) it is infeasible to turn it into a string
+            return bindingStrings[node.binding];
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Layout::Layout(std::string expression)
+    {
+        // Parsing is a lot slower than evaluating, so each expression is only compiled once. Layouts created from the same string
+        // share the compiled program, which is never modified after it was created.
+        static const std::size_t maxCachedPrograms = 1024;
+        static std::unordered_map<std::string, std::shared_ptr<const Program>> compiledPrograms;
 
-        if (m_operation == Operation::BindingLeft)
-            m_value = m_boundWidget->getPosition().x;
-        else if (m_operation == Operation::BindingTop)
-            m_value = m_boundWidget->getPosition().y;
-        else if (m_operation == Operation::BindingWidth)
-            m_value = m_boundWidget->getSize().x;
-        else if (m_operation == Operation::BindingHeight)
-            m_value = m_boundWidget->getSize().y;
-        else if (m_operation == Operation::BindingInnerWidth)
+        auto it = compiledPrograms.find(expression);
+        if (it == compiledPrograms.end())
         {
-            const auto* boundContainer = dynamic_cast<Container*>(boundWidget);
-            if (boundContainer)
-                m_value = boundContainer->getInnerSize().x;
+            Program parsedProgram;
+            const std::size_t root = parsedProgram.parse(expression);
+
+            auto program = std::make_shared<Program>();
+            parsedProgram.copyTo(*program, root);
+
+            if (compiledPrograms.size() >= maxCachedPrograms)
+                compiledPrograms.clear();
+
+            it = compiledPrograms.emplace(std::move(expression), std::move(program)).first;
         }
-        else if (m_operation == Operation::BindingInnerHeight)
+
+        // A constant doesn't need the program
+        const Program::Node& result = it->second->nodes.back();
+        if (result.operation == Operation::Value)
         {
-            const auto* boundContainer = dynamic_cast<Container*>(boundWidget);
-            if (boundContainer)
-                m_value = boundContainer->getInnerSize().y;
+            m_value = result.value;
+            return;
         }
 
-        resetPointers();
-        recalculateValue();
+        m_program = it->second;
+        m_bindings.resize(m_program->bindingStrings.size());
+        calculateValue();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    Layout::Layout(Operation operation, std::unique_ptr<Layout> leftOperand, std::unique_ptr<Layout> rightOperand) :
-        m_operation   {operation},
-        m_leftOperand {std::move(leftOperand)},
-        m_rightOperand{std::move(rightOperand)}
+    Layout::Layout(Operation operation, Widget* boundWidget)
     {
-        assert(m_leftOperand != nullptr);
-        assert(m_rightOperand != nullptr);
-        resetPointers();
-        recalculateValue();
+        assert((operation == Operation::BindingLeft) || (operation == Operation::BindingTop)
+               || (operation == Operation::BindingWidth) || (operation == Operation::BindingHeight)
+               || (operation == Operation::BindingInnerWidth) || (operation == Operation::BindingInnerHeight));
+        assert(boundWidget != nullptr);
+
+        auto program = std::make_shared<Program>();
+        program->addBinding(operation, "");
+        m_program = std::move(program);
+
+        Binding binding;
+        binding.operation = operation;
+        binding.widget = boundWidget;
+        m_bindings.push_back(binding);
+
+        bindLayout();
+        calculateValue();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    Layout::Layout(const Layout& other) :
-        m_value          {other.m_value},
-        m_parent         {other.m_parent},
-        m_operation      {other.m_operation},
-        m_leftOperand    {other.m_leftOperand ? std::make_unique<Layout>(*other.m_leftOperand) : nullptr},
-        m_rightOperand   {other.m_rightOperand ? std::make_unique<Layout>(*other.m_rightOperand) : nullptr},
-        m_boundWidget    {other.m_boundWidget},
-        m_boundString    {other.m_boundString}
+    Layout::Layout(Operation operation, const Layout& leftOperand, const Layout& rightOperand)
     {
-        // Disconnect the bound widget if a string was used, the same name may apply to a different widget now
-        if (!m_boundString.empty())
-            m_boundWidget = nullptr;
+        auto program = std::make_shared<Program>();
+        const std::size_t left = program->addLayout(leftOperand);
+        const std::size_t right = program->addLayout(rightOperand);
+        program->addOperation(operation, left, right);
+        m_program = std::move(program);
+
+        m_bindings = leftOperand.m_bindings;
+        m_bindings.insert(m_bindings.end(), rightOperand.m_bindings.begin(), rightOperand.m_bindings.end());
+        resetBindingStrings();
+
+        bindLayout();
+        calculateValue();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        resetPointers();
+    Layout::Layout(const Layout& other) :
+        m_value   {other.m_value},
+        m_program {other.m_program},
+        m_bindings{other.m_bindings}
+    {
+        resetBindingStrings();
+        bindLayout();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Layout::Layout(Layout&& other) :
-        m_value          {std::move(other.m_value)},
-        m_parent         {std::move(other.m_parent)},
-        m_operation      {other.m_operation},
-        m_leftOperand    {std::move(other.m_leftOperand)},
-        m_rightOperand   {std::move(other.m_rightOperand)},
-        m_boundWidget    {other.m_boundWidget},
-        m_boundString    {std::move(other.m_boundString)}
+        m_value  {other.m_value},
+        m_program{std::move(other.m_program)}
     {
-        resetPointers();
+        // The bound widgets have to refer to this layout instead of the moved one
+        other.unbindLayout();
+        m_bindings = std::move(other.m_bindings);
+        other.m_bindings.clear();
+        bindLayout();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -375,18 +598,13 @@ namespace tgui
             unbindLayout();
 
             m_value           = other.m_value;
-            m_parent          = other.m_parent;
-            m_operation       = other.m_operation;
-            m_leftOperand     = other.m_leftOperand ? std::make_unique<Layout>(*other.m_leftOperand) : nullptr;
-            m_rightOperand    = other.m_rightOperand ? std::make_unique<Layout>(*other.m_rightOperand) : nullptr;
-            m_boundWidget     = other.m_boundWidget;
-            m_boundString     = other.m_boundString;
+            m_program         = other.m_program;
+            m_bindings        = other.m_bindings;
+            m_connectedWidget = nullptr;
+            m_connectedParent = nullptr;
 
-            // Disconnect the bound widget if a string was used, the same name may apply to a different widget now
-            if (!m_boundString.empty())
-                m_boundWidget = nullptr;
-
-            resetPointers();
+            resetBindingStrings();
+            bindLayout();
         }
 
         return *this;
@@ -399,16 +617,16 @@ namespace tgui
         if (this != &other)
         {
             unbindLayout();
+            other.unbindLayout();
 
-            m_value           = std::move(other.m_value);
-            m_parent          = std::move(other.m_parent);
-            m_operation       = other.m_operation;
-            m_leftOperand     = std::move(other.m_leftOperand);
-            m_rightOperand    = std::move(other.m_rightOperand);
-            m_boundWidget     = other.m_boundWidget;
-            m_boundString     = std::move(other.m_boundString);
+            m_value           = other.m_value;
+            m_program         = std::move(other.m_program);
+            m_bindings        = std::move(other.m_bindings);
+            m_connectedWidget = nullptr;
+            m_connectedParent = nullptr;
+            other.m_bindings.clear();
 
-            resetPointers();
+            bindLayout();
         }
 
         return *this;
@@ -419,301 +637,387 @@ namespace tgui
     Layout::~Layout()
     {
         unbindLayout();
+
+        if (m_queued)
+            std::replace(dirtyLayouts.begin(), dirtyLayouts.end(), this, static_cast<Layout*>(nullptr));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Layout::isConstant() const
+    {
+        return !m_program;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     std::string Layout::toString() const
     {
-        if (m_operation == Operation::Value)
-        {
+        if (!m_program)
             return to_string(m_value);
-        }
-        else if (m_operation == Operation::Minimum)
-        {
-            return "min(" + m_leftOperand->toString() + ", " + m_rightOperand->toString() + ")";
-        }
-        else if (m_operation == Operation::Maximum)
-        {
-            return "max(" + m_leftOperand->toString() + ", " + m_rightOperand->toString() + ")";
-        }
-        else if ((m_operation == Operation::Plus) || (m_operation == Operation::Minus) || (m_operation == Operation::Multiplies) || (m_operation == Operation::Divides))
-        {
-            char operatorChar;
-            if (m_operation == Operation::Plus)
-                operatorChar = '+';
-            else if (m_operation == Operation::Minus)
-                operatorChar = '-';
-            else if (m_operation == Operation::Multiplies)
-                operatorChar = '*';
-            else // if (m_operation == Operation::Divides)
-                operatorChar = '/';
 
-            auto subExpressionNeedsBrackets = [](const std::unique_ptr<Layout>& operand)
-                {
-                    if (!operand->m_leftOperand)
-                        return false;
-
-                    if ((operand->m_operation == Operation::Minimum) || (operand->m_operation == Operation::Maximum))
-                        return false;
+        return m_program->toString(m_program->nodes.size() - 1);
+    }
 
-                    if ((operand->m_operation == Operation::Multiplies) && (operand->m_leftOperand->m_operation == Operation::Value) && (operand->m_rightOperand->toString() == "100%"))
-                        return false;
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-                    return true;
-                };
+    void Layout::unbindLayout()
+    {
+        for (const auto& binding : m_bindings)
+        {
+            if (!binding.widget)
+                continue;
 
-            if (subExpressionNeedsBrackets(m_leftOperand) && subExpressionNeedsBrackets(m_rightOperand))
-                return "(" + m_leftOperand->toString() + ") " + operatorChar + " (" + m_rightOperand->toString() + ")";
-            else if (subExpressionNeedsBrackets(m_leftOperand))
-                return "(" + m_leftOperand->toString() + ") " + operatorChar + " " + m_rightOperand->toString();
-            else if (subExpressionNeedsBrackets(m_rightOperand))
-                return m_leftOperand->toString() + " " + operatorChar + " (" + m_rightOperand->toString() + ")";
+            if ((binding.operation == Operation::BindingLeft) || (binding.operation == Operation::BindingTop))
+                binding.widget->unbindPositionLayout(this);
             else
-            {
-                if ((m_operation == Operation::Multiplies) && (m_leftOperand->m_operation == Operation::Value) && (m_rightOperand->toString() == "100%"))
-                    return to_string(m_leftOperand->getValue() * 100) + '%';
-                else
-                    return m_leftOperand->toString() + " " + operatorChar + " " + m_rightOperand->toString();
-            }
+                binding.widget->unbindSizeLayout(this);
         }
-        else
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Layout::bindLayout()
+    {
+        for (const auto& binding : m_bindings)
         {
-            if (m_boundString == "&.innersize")
-                return "100%";
+            if (!binding.widget)
+                continue;
 
-            // Hopefully the expression is stored in the bound string, otherwise (i.e. when bind functions were used) it is infeasible to turn it into a string
-            return m_boundString;
+            if ((binding.operation == Operation::BindingLeft) || (binding.operation == Operation::BindingTop))
+                binding.widget->bindPositionLayout(this);
+            else
+                binding.widget->bindSizeLayout(this);
         }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Layout::unbindLayout()
+    void Layout::resetBindingStrings()
     {
-        if (m_boundWidget)
+        for (std::size_t i = 0; i < m_bindings.size(); ++i)
         {
-            assert((m_operation == Operation::BindingLeft) || (m_operation == Operation::BindingTop)
-                   || (m_operation == Operation::BindingWidth) || (m_operation == Operation::BindingHeight)
-                   || (m_operation == Operation::BindingInnerWidth) || (m_operation == Operation::BindingInnerHeight));
-
-            if ((m_operation == Operation::BindingLeft) || (m_operation == Operation::BindingTop))
-                m_boundWidget->unbindPositionLayout(this);
-            else
-                m_boundWidget->unbindSizeLayout(this);
+            if (!m_program->bindingStrings[i].empty())
+            {
+                m_bindings[i].operation = Operation::BindingString;
+                m_bindings[i].widget = nullptr;
+            }
         }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Layout::resetPointers()
+    void Layout::connectWidget(Widget* widget, bool xAxis, std::function<void()> valueChangedCallbackHandler)
     {
-        if (m_leftOperand != nullptr)
+        m_connectedWidgetCallback = std::move(valueChangedCallbackHandler);
+        if (m_bindings.empty())
+            return;
+
+        // The widgets only have to be searched again when this layout is connected for the first time, when the widget was
+        // moved to a different parent or when some of the referred widgets weren't found yet. In all other cases (e.g. when
+        // the widget calls this function while reacting to a value change of its own layout) the result can't be different.
+        bool searchWidgets = (widget != m_connectedWidget) || (widget->getParent() != m_connectedParent);
+        for (std::size_t i = 0; (i < m_bindings.size()) && !searchWidgets; ++i)
         {
-            assert(m_rightOperand != nullptr);
+            if (!m_bindings[i].widget && !m_program->bindingStrings[i].empty())
+                searchWidgets = true;
+        }
+
+        if (!searchWidgets)
+            return;
 
-            m_leftOperand->m_parent = this;
-            m_rightOperand->m_parent = this;
+        m_connectedWidget = widget;
+        m_connectedParent = widget->getParent();
+
+        // Parse the binding strings even when the referred widgets were already found, the widget may be added to a different parent
+        unbindLayout();
+        for (std::size_t i = 0; i < m_bindings.size(); ++i)
+        {
+            if (!m_program->bindingStrings[i].empty())
+                parseBindingString(m_program->bindingStrings[i], widget, xAxis, m_bindings[i]);
         }
+        bindLayout();
+
+        recalculateValue();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Layout::notifyConnectedWidget()
+    {
+        if (m_connectedWidgetCallback)
+            m_connectedWidgetCallback();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        if (m_boundWidget)
+    void Layout::unbindWidget(Widget* widget)
+    {
+        // The widget is being destroyed and is already removing this layout from its list, so it must not be informed about it
+        for (std::size_t i = 0; i < m_bindings.size(); ++i)
         {
-            assert((m_operation == Operation::BindingLeft) || (m_operation == Operation::BindingTop)
-                   || (m_operation == Operation::BindingWidth) || (m_operation == Operation::BindingHeight)
-                   || (m_operation == Operation::BindingInnerWidth) || (m_operation == Operation::BindingInnerHeight));
+            if (m_bindings[i].widget != widget)
+                continue;
+
+            m_bindings[i].widget = nullptr;
 
-            if ((m_operation == Operation::BindingLeft) || (m_operation == Operation::BindingTop))
-                m_boundWidget->bindPositionLayout(this);
+            // A widget referred to by a string keeps its last value until a widget with that name is found again
+            if (m_program->bindingStrings[i].empty())
+                m_bindings[i].value = 0;
             else
-                m_boundWidget->bindSizeLayout(this);
+                m_bindings[i].operation = Operation::BindingString;
         }
+
+        recalculateValue();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Layout::connectWidget(Widget* widget, bool xAxis, std::function<void()> valueChangedCallbackHandler)
+    void Layout::recalculateValue()
     {
         const float oldValue = m_value;
 
-        // No callbacks must be made while parsing, a single callback will be made when done if needed
-        m_connectedWidgetCallback = nullptr;
+        calculateValue();
+
+        if (m_value != oldValue)
+            notifyConnectedWidget();
+    }
 
-        parseBindingStringRecursive(widget, xAxis);
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        // Restore the callback function
-        m_connectedWidgetCallback = valueChangedCallbackHandler;
+    void Layout::calculateValue()
+    {
+        if (!m_program)
+            return;
 
-        if (m_value != oldValue)
+        for (auto& binding : m_bindings)
         {
-            if (m_connectedWidgetCallback)
-                m_connectedWidgetCallback();
+            if (!binding.widget)
+                continue;
+
+            switch (binding.operation)
+            {
+                case Operation::BindingLeft:
+                    binding.value = binding.widget->getPosition().x;
+                    break;
+                case Operation::BindingTop:
+                    binding.value = binding.widget->getPosition().y;
+                    break;
+                case Operation::BindingWidth:
+                    binding.value = binding.widget->getSize().x;
+                    break;
+                case Operation::BindingHeight:
+                    binding.value = binding.widget->getSize().y;
+                    break;
+                case Operation::BindingInnerWidth:
+                {
+                    const auto* boundContainer = dynamic_cast<Container*>(binding.widget);
+                    if (boundContainer)
+                        binding.value = boundContainer->getInnerSize().x;
+                    break;
+                }
+                case Operation::BindingInnerHeight:
+                {
+                    const auto* boundContainer = dynamic_cast<Container*>(binding.widget);
+                    if (boundContainer)
+                        binding.value = boundContainer->getInnerSize().y;
+                    break;
+                }
+                default:
+                    break;
+            };
         }
+
+        m_value = m_program->evaluate(m_program->nodes.size() - 1, m_bindings);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Layout::unbindWidget()
+    void Layout::boundWidgetChanged()
     {
-        m_boundWidget = nullptr;
-
-        if (!m_boundString.empty())
-            m_operation = Operation::BindingString;
-        else
+        if (deferredRecalculationDepth == 0)
         {
-            m_value = 0;
-            m_operation = Operation::Value;
+            recalculateValue();
+            return;
         }
 
-        recalculateValue();
+        if (m_dirty)
+            return;
+
+        m_dirty = true;
+
+        // If the layout was already evaluated in the current pass then it has to be evaluated again
+        if (!m_evaluating)
+            m_evaluatedPass = 0;
+
+        m_queued = true;
+        dirtyLayouts.push_back(this);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Layout::recalculateValue()
+    void Layout::beginDeferredRecalculation()
     {
-        const float oldValue = m_value;
+        ++deferredRecalculationDepth;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        switch (m_operation)
+    void Layout::endDeferredRecalculation()
+    {
+        assert(deferredRecalculationDepth > 0);
+        if (deferredRecalculationDepth == 0)
+            return;
+
+        // Widgets that change while evaluating the dirty layouts must mark their bound layouts as dirty as well,
+        // so the depth is only decreased after all layouts have been evaluated.
+        if (deferredRecalculationDepth == 1)
         {
-            case Operation::Value:
-                break;
-            case Operation::Plus:
-                m_value = m_leftOperand->getValue() + m_rightOperand->getValue();
-                break;
-            case Operation::Minus:
-                m_value = m_leftOperand->getValue() - m_rightOperand->getValue();
-                break;
-            case Operation::Multiplies:
-                m_value = m_leftOperand->getValue() * m_rightOperand->getValue();
-                break;
-            case Operation::Divides:
-                if (m_rightOperand->getValue() != 0)
-                    m_value = m_leftOperand->getValue() / m_rightOperand->getValue();
-                else
-                    m_value = 0;
-                break;
-            case Operation::Minimum:
-                m_value = std::min(m_leftOperand->getValue(), m_rightOperand->getValue());
-                break;
-            case Operation::Maximum:
-                m_value = std::max(m_leftOperand->getValue(), m_rightOperand->getValue());
-                break;
-            case Operation::BindingLeft:
-                m_value = m_boundWidget->getPosition().x;
-                break;
-            case Operation::BindingTop:
-                m_value = m_boundWidget->getPosition().y;
-                break;
-            case Operation::BindingWidth:
-                m_value = m_boundWidget->getSize().x;
-                break;
-            case Operation::BindingHeight:
-                m_value = m_boundWidget->getSize().y;
-                break;
-            case Operation::BindingInnerWidth:
+            try
             {
-                const auto* boundContainer = dynamic_cast<Container*>(m_boundWidget);
-                if (boundContainer)
-                    m_value = boundContainer->getInnerSize().x;
-                break;
+                recalculateDirtyLayouts();
             }
-            case Operation::BindingInnerHeight:
+            catch (...)
             {
-                const auto* boundContainer = dynamic_cast<Container*>(m_boundWidget);
-                if (boundContainer)
-                    m_value = boundContainer->getInnerSize().y;
-                break;
-            }
-            case Operation::BindingString:
-                // The string should have already been parsed by now.
-                // Passing here either means something is wrong with the string or the layout was not connected to a widget with a parent yet.
-                break;
-        };
+                for (auto* layout : dirtyLayouts)
+                {
+                    if (layout)
+                    {
+                        layout->m_dirty = false;
+                        layout->m_queued = false;
+                        layout->m_evaluating = false;
+                    }
+                }
 
-        if (m_value != oldValue)
-        {
-            if (m_parent)
-                m_parent->recalculateValue();
-            else
-            {
-                // The topmost layout must tell the connected widget about the new value
-                if (m_connectedWidgetCallback)
-                    m_connectedWidgetCallback();
+                dirtyLayouts.clear();
+                --deferredRecalculationDepth;
+                throw;
             }
         }
+
+        --deferredRecalculationDepth;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Layout::parseBindingStringRecursive(Widget* widget, bool xAxis)
+    void Layout::recalculateDirtyLayouts()
     {
-        if (m_leftOperand)
+        const unsigned int pass = ++recalculationPass;
+
+        // New layouts can be added to the list while evaluating, so the size has to be checked in every iteration
+        for (std::size_t i = 0; i < dirtyLayouts.size(); ++i)
         {
-            assert(m_rightOperand != nullptr);
+            if (dirtyLayouts[i])
+                dirtyLayouts[i]->recalculateInDependencyOrder(pass);
+        }
 
-            m_leftOperand->parseBindingStringRecursive(widget, xAxis);
-            m_rightOperand->parseBindingStringRecursive(widget, xAxis);
+        for (auto* layout : dirtyLayouts)
+        {
+            if (layout)
+                layout->m_queued = false;
         }
 
-        // Parse the string binding even when the referred widget was already found. The widget may be added to a different parent
-        if (!m_boundString.empty())
-            parseBindingString(m_boundString, widget, xAxis);
+        dirtyLayouts.clear();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Layout::recalculateInDependencyOrder(unsigned int pass)
+    {
+        // Don't evaluate the layout twice and stop when the bindings contain a cycle
+        if ((m_evaluatedPass == pass) || m_evaluating)
+            return;
+
+        m_evaluating = true;
+        recalculateDependencies(pass);
+        m_evaluating = false;
+        m_evaluatedPass = pass;
+
+        if (!m_dirty)
+            return;
+
+        m_dirty = false;
+        recalculateValue();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Layout::recalculateDependencies(unsigned int pass)
+    {
+        // The bindings are accessed by index, a widget that gets updated may assign a different layout to this one
+        for (std::size_t i = 0; i < m_bindings.size(); ++i)
+        {
+            Widget* const widget = m_bindings[i].widget;
+            if (!widget)
+                continue;
+
+            if ((m_bindings[i].operation == Operation::BindingLeft) || (m_bindings[i].operation == Operation::BindingTop))
+            {
+                widget->m_position.x.recalculateInDependencyOrder(pass);
+                widget->m_position.y.recalculateInDependencyOrder(pass);
+            }
+            else
+            {
+                widget->m_size.x.recalculateInDependencyOrder(pass);
+                widget->m_size.y.recalculateInDependencyOrder(pass);
+            }
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Layout::parseBindingString(const std::string& expression, Widget* widget, bool xAxis)
+    void Layout::parseBindingString(const std::string& expression, Widget* widget, bool xAxis, Binding& binding)
     {
         if (expression == "x" || expression == "left")
         {
-            m_operation = Operation::BindingLeft;
-            m_boundWidget = widget;
+            binding.operation = Operation::BindingLeft;
+            binding.widget = widget;
         }
         else if (expression == "y" || expression == "top")
         {
-            m_operation = Operation::BindingTop;
-            m_boundWidget = widget;
+            binding.operation = Operation::BindingTop;
+            binding.widget = widget;
         }
         else if (expression == "w" || expression == "width")
         {
-            m_operation = Operation::BindingWidth;
-            m_boundWidget = widget;
+            binding.operation = Operation::BindingWidth;
+            binding.widget = widget;
         }
         else if (expression == "h" || expression == "height")
         {
-            m_operation = Operation::BindingHeight;
-            m_boundWidget = widget;
+            binding.operation = Operation::BindingHeight;
+            binding.widget = widget;
         }
         else if (expression == "iw" || expression == "innerwidth")
         {
-            m_operation = Operation::BindingInnerWidth;
-            m_boundWidget = widget;
+            binding.operation = Operation::BindingInnerWidth;
+            binding.widget = widget;
         }
         else if (expression == "ih" || expression == "innerheight")
         {
-            m_operation = Operation::BindingInnerHeight;
-            m_boundWidget = widget;
+            binding.operation = Operation::BindingInnerHeight;
+            binding.widget = widget;
         }
         else if (expression == "size")
         {
             if (xAxis)
-                return parseBindingString("width", widget, xAxis);
+                return parseBindingString("width", widget, xAxis, binding);
             else
-                return parseBindingString("height", widget, xAxis);
+                return parseBindingString("height", widget, xAxis, binding);
         }
         else if (expression == "innersize")
         {
             if (xAxis)
-                return parseBindingString("innerwidth", widget, xAxis);
+                return parseBindingString("innerwidth", widget, xAxis, binding);
             else
-                return parseBindingString("innerheight", widget, xAxis);
+                return parseBindingString("innerheight", widget, xAxis, binding);
         }
         else if ((expression == "pos") || (expression == "position"))
         {
             if (xAxis)
-                return parseBindingString("x", widget, xAxis);
+                return parseBindingString("x", widget, xAxis, binding);
             else
-                return parseBindingString("y", widget, xAxis);
+                return parseBindingString("y", widget, xAxis, binding);
         }
         else
         {
@@ -724,7 +1028,7 @@ namespace tgui
                 if (widgetName == "parent" || widgetName == "&")
                 {
                     if (widget->getParent())
-                        return parseBindingString(expression.substr(dotPos+1), widget->getParent(), xAxis);
+                        return parseBindingString(expression.substr(dotPos+1), widget->getParent(), xAxis, binding);
                 }
                 else if (!widgetName.empty())
                 {
@@ -737,7 +1041,7 @@ namespace tgui
                         for (std::size_t i = 0; i < widgets.size(); ++i)
                         {
                             if (toLower(widgetNames[i]) == widgetName)
-                                return parseBindingString(expression.substr(dotPos+1), widgets[i].get(), xAxis);
+                                return parseBindingString(expression.substr(dotPos+1), widgets[i].get(), xAxis, binding);
                         }
                     }
 
@@ -749,7 +1053,7 @@ namespace tgui
                         for (std::size_t i = 0; i < widgets.size(); ++i)
                         {
                             if (toLower(widgetNames[i]) == widgetName)
-                                return parseBindingString(expression.substr(dotPos+1), widgets[i].get(), xAxis);
+                                return parseBindingString(expression.substr(dotPos+1), widgets[i].get(), xAxis, binding);
                         }
                     }
                 }
@@ -758,9 +1062,6 @@ namespace tgui
             // The referred widget was not found or there was something wrong with the string
             return;
         }
-
-        resetPointers();
-        recalculateValue();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -768,35 +1069,35 @@ namespace tgui
 
     Layout operator-(Layout right)
     {
-        return Layout{Layout::Operation::Minus, std::make_unique<Layout>(), std::make_unique<Layout>(std::move(right))};
+        return Layout{Layout::Operation::Minus, Layout{}, std::move(right)};
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Layout operator+(Layout left, Layout right)
     {
-        return Layout{Layout::Operation::Plus, std::make_unique<Layout>(std::move(left)), std::make_unique<Layout>(std::move(right))};
+        return Layout{Layout::Operation::Plus, std::move(left), std::move(right)};
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Layout operator-(Layout left, Layout right)
     {
-        return Layout{Layout::Operation::Minus, std::make_unique<Layout>(std::move(left)), std::make_unique<Layout>(std::move(right))};
+        return Layout{Layout::Operation::Minus, std::move(left), std::move(right)};
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Layout operator*(Layout left, Layout right)
     {
-        return Layout{Layout::Operation::Multiplies, std::make_unique<Layout>(std::move(left)), std::make_unique<Layout>(std::move(right))};
+        return Layout{Layout::Operation::Multiplies, std::move(left), std::move(right)};
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Layout operator/(Layout left, Layout right)
     {
-        return Layout{Layout::Operation::Divides, std::make_unique<Layout>(std::move(left)), std::make_unique<Layout>(std::move(right))};
+        return Layout{Layout::Operation::Divides, std::move(left), std::move(right)};
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -878,18 +1179,14 @@ namespace tgui
 
         Layout bindRight(Widget::Ptr widget)
         {
-            return Layout{Layout::Operation::Plus,
-                          std::make_unique<Layout>(Layout::Operation::BindingLeft, widget.get()),
-                          std::make_unique<Layout>(Layout::Operation::BindingWidth, widget.get())};
+            return Layout{Layout::Operation::Plus, bindLeft(widget), bindWidth(widget)};
         }
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
         Layout bindBottom(Widget::Ptr widget)
         {
-            return Layout{Layout::Operation::Plus,
-                          std::make_unique<Layout>(Layout::Operation::BindingTop, widget.get()),
-                          std::make_unique<Layout>(Layout::Operation::BindingHeight, widget.get())};
+            return Layout{Layout::Operation::Plus, bindTop(widget), bindHeight(widget)};
         }
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -931,14 +1228,14 @@ namespace tgui
 
         Layout bindMin(const Layout& value1, const Layout& value2)
         {
-            return Layout{Layout::Operation::Minimum, std::make_unique<Layout>(value1), std::make_unique<Layout>(value2)};
+            return Layout{Layout::Operation::Minimum, value1, value2};
         }
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
         Layout bindMax(const Layout& value1, const Layout& value2)
         {
-            return Layout{Layout::Operation::Maximum, std::make_unique<Layout>(value1), std::make_unique<Layout>(value2)};
+            return Layout{Layout::Operation::Maximum, value1, value2};
         }
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -175,14 +175,14 @@ namespace tgui
 
             std::string result = "\"" + texture.getId() + "\"";
 
-            if ((texture.getData()->rect != sf::IntRect{}) && texture.getData()->image
-             && (texture.getData()->rect != sf::IntRect{0, 0, static_cast<int>(texture.getData()->image->getSize().x), static_cast<int>(texture.getData()->image->getSize().y)}))
+            if ((texture.getData()->rect != sf::IntRect{}) && (texture.getData()->imageSize != sf::Vector2u{})
+             && (texture.getData()->rect != sf::IntRect{0, 0, static_cast<int>(texture.getData()->imageSize.x), static_cast<int>(texture.getData()->imageSize.y)}))
             {
                 result += " Part(" + to_string(texture.getData()->rect.left) + ", " + to_string(texture.getData()->rect.top)
                             + ", " + to_string(texture.getData()->rect.width) + ", " + to_string(texture.getData()->rect.height) + ")";
             }
 
-            if (texture.getMiddleRect() != sf::IntRect{0, 0, static_cast<int>(texture.getData()->texture.getSize().x), static_cast<int>(texture.getData()->texture.getSize().y)})
+            if (texture.getMiddleRect() != sf::IntRect{0, 0, static_cast<int>(texture.getImageSize().x), static_cast<int>(texture.getImageSize().y)})
             {
                 result += " Middle(" + to_string(texture.getMiddleRect().left) + ", " + to_string(texture.getMiddleRect().top)
                               + ", " + to_string(texture.getMiddleRect().width) + ", " + to_string(texture.getMiddleRect().height) + ")";
@@ -231,12 +231,12 @@ namespace tgui
                 {
                     std::stringstream ss{ObjectConverter{pair.second}.getString()};
                     node->children.push_back(DataIO::parse(ss));
-                    node->children.back()->name = pair.first;
+                    node->children.back()->name = getRendererPropertyName(pair.first);
                 }
                 else
                 {
                     strValue = ObjectConverter{pair.second}.getString();
-                    node->propertyValuePairs[pair.first] = std::make_unique<DataIO::ValueNode>(strValue);
+                    node->propertyValuePairs[getRendererPropertyName(pair.first)] = std::make_unique<DataIO::ValueNode>(strValue);
                 }
             }
 
@@ -27,6 +27,9 @@
 #include <TGUI/Loading/Serializer.hpp>
 #include <TGUI/Global.hpp>
 
+#include <algorithm>
+#include <iterator>
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
@@ -284,6 +287,10 @@ namespace tgui
 
     Theme::~Theme()
     {
+        // Don't leave the renderers in a transaction that can no longer be committed
+        for (auto& renderer : m_transactionRenderers)
+            WidgetRenderer{renderer}.commitTransaction();
+
         if (m_defaultTheme == this)
             setDefault(nullptr);
     }
@@ -299,7 +306,6 @@ namespace tgui
         for (auto& pair : m_renderers)
         {
             auto& renderer = pair.second;
-            const auto oldData = renderer;
 
             if (!m_themeLoader->canLoad(m_primary, pair.first))
                 continue;
@@ -307,28 +313,26 @@ namespace tgui
             auto& properties = m_themeLoader->load(m_primary, pair.first);
 
             // Update the property-value pairs of the renderer
-            renderer->propertyValuePairs = std::map<std::string, ObjectConverter>{};
+            const RendererPropertyValues oldPropertyValuePairs = std::move(renderer->propertyValuePairs);
+            renderer->propertyValuePairs.clear();
             for (const auto& property : properties)
                 renderer->propertyValuePairs[property.first] = ObjectConverter(property.second);
 
-            // Tell the widgets that were using this renderer about all the updated properties, both new ones and old ones that were now reset to their default value
-            auto oldIt = oldData->propertyValuePairs.begin();
+            // Find all the updated properties, both new ones and old ones that were now reset to their default value
+            std::vector<RendererProperty> changedProperties;
+            changedProperties.reserve(oldPropertyValuePairs.size() + renderer->propertyValuePairs.size());
+            auto oldIt = oldPropertyValuePairs.begin();
             auto newIt = renderer->propertyValuePairs.begin();
-            while (oldIt != oldData->propertyValuePairs.end() && newIt != renderer->propertyValuePairs.end())
+            while (oldIt != oldPropertyValuePairs.end() && newIt != renderer->propertyValuePairs.end())
             {
                 if (oldIt->first < newIt->first)
                 {
-                    // Update values that no longer exist in the new renderer and are now reset to the default value
-                    for (const auto& observer : renderer->observers)
-                        observer.second(oldIt->first);
-
+                    changedProperties.push_back(oldIt->first);
                     ++oldIt;
                 }
                 else
                 {
-                    // Update changed and new properties
-                    for (const auto& observer : renderer->observers)
-                        observer.second(newIt->first);
+                    changedProperties.push_back(newIt->first);
 
                     if (newIt->first < oldIt->first)
                         ++newIt;
@@ -339,25 +343,58 @@ namespace tgui
                     }
                 }
             }
-            while (oldIt != oldData->propertyValuePairs.end())
-            {
-                for (const auto& observer : renderer->observers)
-                    observer.second(oldIt->first);
+            for (; oldIt != oldPropertyValuePairs.end(); ++oldIt)
+                changedProperties.push_back(oldIt->first);
+            for (; newIt != renderer->propertyValuePairs.end(); ++newIt)
+                changedProperties.push_back(newIt->first);
 
-                ++oldIt;
+            if (renderer->transactionDepth > 0)
+            {
+                // The changes will be sent to the widgets when the transaction is committed
+                std::vector<RendererProperty> mergedProperties;
+                std::set_union(renderer->changedProperties.begin(), renderer->changedProperties.end(),
+                               changedProperties.begin(), changedProperties.end(),
+                               std::back_inserter(mergedProperties));
+                renderer->changedProperties = std::move(mergedProperties);
             }
-            while (newIt != renderer->propertyValuePairs.end())
+            else if (!changedProperties.empty())
             {
+                // Tell the widgets that were using this renderer about all the updated properties at once
                 for (const auto& observer : renderer->observers)
-                    observer.second(newIt->first);
-
-                ++newIt;
+                    observer.second(changedProperties);
             }
         }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Theme::beginTransaction()
+    {
+        if (m_transactionDepth++ > 0)
+            return;
+
+        for (auto& pair : m_renderers)
+        {
+            WidgetRenderer{pair.second}.beginTransaction();
+            m_transactionRenderers.push_back(pair.second);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Theme::commitTransaction()
+    {
+        if ((m_transactionDepth == 0) || (--m_transactionDepth > 0))
+            return;
+
+        const auto renderers = std::move(m_transactionRenderers);
+        m_transactionRenderers.clear();
+        for (auto& renderer : renderers)
+            WidgetRenderer{renderer}.commitTransaction();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     std::shared_ptr<RendererData> Theme::getRenderer(const std::string& id)
     {
         std::string lowercaseSecondary = toLower(id);
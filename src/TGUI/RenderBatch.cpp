@@ -0,0 +1,224 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2019 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#include <TGUI/RenderBatch.hpp>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    namespace
+    {
+        // Batch that collects the triangles, nullptr when everything is drawn immediately
+        RenderBatch* activeBatch = nullptr;
+
+        // Target of the active batch
+        const sf::RenderTarget* activeTarget = nullptr;
+
+        std::size_t drawCallCount = 0;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    RenderBatch::RenderBatch(sf::RenderTarget& target, bool enabled) :
+        m_target       {target},
+        m_previousBatch{activeBatch}
+    {
+        if (enabled && activeBatch && (activeTarget == &target))
+        {
+            m_nested = true;
+            return;
+        }
+
+        // What was collected before has to be drawn before anything that is drawn while this object exists
+        if (activeBatch)
+            activeBatch->flush();
+
+        activeBatch = enabled ? this : nullptr;
+        activeTarget = enabled ? &target : nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    RenderBatch::~RenderBatch()
+    {
+        if (m_nested)
+            return;
+
+        flush();
+
+        activeBatch = m_previousBatch;
+        activeTarget = m_previousBatch ? &m_previousBatch->m_target : nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void RenderBatch::draw(sf::RenderTarget& target, const sf::Vertex* vertices, std::size_t vertexCount,
+                           sf::PrimitiveType type, const sf::RenderStates& states)
+    {
+        if ((type == sf::PrimitiveType::Triangles) || (type == sf::PrimitiveType::TrianglesStrip))
+        {
+            // Nothing would be drawn, so there is no reason to draw the collected triangles yet
+            if (vertexCount < 3)
+                return;
+
+            RenderBatch* batch = getBatch(target, states);
+            if (batch)
+            {
+                batch->addTriangles(vertices, vertexCount, type, states.transform);
+                return;
+            }
+        }
+
+        flush(target);
+
+        ++drawCallCount;
+        target.draw(vertices, vertexCount, type, states);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void RenderBatch::draw(sf::RenderTarget& target, const sf::Shape& shape, const sf::RenderStates& states)
+    {
+        const std::size_t pointCount = shape.getPointCount();
+        if (!shape.getTexture() && (shape.getOutlineThickness() == 0) && (pointCount >= 3))
+        {
+            RenderBatch* batch = getBatch(target, states);
+            if (batch)
+            {
+                // The shape is convex, so its surface can be split in triangles that all start at the first point
+                const sf::Transform transform = states.transform * shape.getTransform();
+                const sf::Vertex firstVertex{transform.transformPoint(shape.getPoint(0)), shape.getFillColor()};
+                sf::Vertex prevVertex{transform.transformPoint(shape.getPoint(1)), shape.getFillColor()};
+
+                batch->m_vertices.reserve(batch->m_vertices.size() + (pointCount - 2) * 3);
+                for (std::size_t i = 2; i < pointCount; ++i)
+                {
+                    const sf::Vertex vertex{transform.transformPoint(shape.getPoint(i)), shape.getFillColor()};
+                    batch->m_vertices.push_back(firstVertex);
+                    batch->m_vertices.push_back(prevVertex);
+                    batch->m_vertices.push_back(vertex);
+                    prevVertex = vertex;
+                }
+
+                return;
+            }
+        }
+
+        draw(target, static_cast<const sf::Drawable&>(shape), states);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void RenderBatch::draw(sf::RenderTarget& target, const sf::Drawable& drawable, const sf::RenderStates& states)
+    {
+        flush(target);
+
+        ++drawCallCount;
+        target.draw(drawable, states);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void RenderBatch::flush(sf::RenderTarget& target)
+    {
+        if (activeTarget == &target)
+            activeBatch->flush();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t RenderBatch::getDrawCallCount()
+    {
+        return drawCallCount;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    RenderBatch* RenderBatch::getBatch(const sf::RenderTarget& target, const sf::RenderStates& states)
+    {
+        // Shaders could depend on the transform or on other values that change between draw calls
+        if ((activeTarget != &target) || (states.shader != nullptr))
+            return nullptr;
+
+        if ((activeBatch->m_texture != states.texture) || (activeBatch->m_blendMode != states.blendMode))
+        {
+            activeBatch->flush();
+            activeBatch->m_texture = states.texture;
+            activeBatch->m_blendMode = states.blendMode;
+        }
+
+        return activeBatch;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void RenderBatch::flush()
+    {
+        if (m_vertices.empty())
+            return;
+
+        sf::RenderStates states;
+        states.texture = m_texture;
+        states.blendMode = m_blendMode;
+
+        ++drawCallCount;
+        m_target.draw(m_vertices.data(), m_vertices.size(), sf::PrimitiveType::Triangles, states);
+        m_vertices.clear();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void RenderBatch::addTriangles(const sf::Vertex* vertices, std::size_t vertexCount, sf::PrimitiveType type, const sf::Transform& transform)
+    {
+        // A triangle strip is split into separate triangles, so that it can be placed behind the other triangles
+        const auto addVertex = [this,&transform](const sf::Vertex& vertex)
+            {
+                m_vertices.emplace_back(transform.transformPoint(vertex.position), vertex.color, vertex.texCoords);
+            };
+
+        if (type == sf::PrimitiveType::Triangles)
+        {
+            m_vertices.reserve(m_vertices.size() + vertexCount);
+            for (std::size_t i = 0; i < vertexCount; ++i)
+                addVertex(vertices[i]);
+        }
+        else // if (type == sf::PrimitiveType::TrianglesStrip)
+        {
+            m_vertices.reserve(m_vertices.size() + (vertexCount - 2) * 3);
+            for (std::size_t i = 0; i + 2 < vertexCount; ++i)
+            {
+                addVertex(vertices[i]);
+                addVertex(vertices[i + 1]);
+                addVertex(vertices[i + 2]);
+            }
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
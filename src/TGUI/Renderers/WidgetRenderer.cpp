@@ -26,10 +26,168 @@
 #include <TGUI/Renderers/WidgetRenderer.hpp>
 #include <TGUI/RendererDefines.hpp>
 
+#include <unordered_map>
+#include <algorithm>
+#include <deque>
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
 {
+    namespace
+    {
+        struct RendererPropertyRegistry
+        {
+            RendererPropertyRegistry()
+            {
+                #define TGUI_RENDERER_PROPERTY_NAME(NAME) add(toLower(#NAME));
+                TGUI_RENDERER_PROPERTIES(TGUI_RENDERER_PROPERTY_NAME)
+                #undef TGUI_RENDERER_PROPERTY_NAME
+            }
+
+            RendererProperty add(const std::string& name)
+            {
+                const auto property = static_cast<RendererProperty>(names.size());
+                names.push_back(name);
+                ids[name] = property;
+                return property;
+            }
+
+            std::deque<std::string> names; // A deque is used so that references to the names remain valid
+            std::unordered_map<std::string, RendererProperty> ids;
+        };
+
+        RendererPropertyRegistry& getRendererPropertyRegistry()
+        {
+            static RendererPropertyRegistry registry;
+            return registry;
+        }
+
+        bool compareProperty(const std::unique_ptr<RendererPropertyValues::value_type>& pair, RendererProperty property)
+        {
+            return pair->first < property;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    RendererProperty getRendererProperty(const std::string& name)
+    {
+        auto& registry = getRendererPropertyRegistry();
+        const auto it = registry.ids.find(name);
+        if (it != registry.ids.end())
+            return it->second;
+        else
+            return registry.add(name);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool findRendererProperty(const std::string& name, RendererProperty& property)
+    {
+        const auto& registry = getRendererPropertyRegistry();
+        const auto it = registry.ids.find(name);
+        if (it == registry.ids.end())
+            return false;
+
+        property = it->second;
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const std::string& getRendererPropertyName(RendererProperty property)
+    {
+        return getRendererPropertyRegistry().names[static_cast<unsigned int>(property)];
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    RendererPropertyValues::RendererPropertyValues(const RendererPropertyValues& other)
+    {
+        m_values.reserve(other.m_values.size());
+        for (const auto& pair : other.m_values)
+            m_values.push_back(std::make_unique<value_type>(*pair));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    RendererPropertyValues& RendererPropertyValues::operator=(const RendererPropertyValues& other)
+    {
+        if (this != &other)
+        {
+            RendererPropertyValues temp(other);
+            std::swap(m_values, temp.m_values);
+        }
+
+        return *this;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    ObjectConverter& RendererPropertyValues::operator[](RendererProperty property)
+    {
+        auto it = std::lower_bound(m_values.begin(), m_values.end(), property, compareProperty);
+        if ((it == m_values.end()) || ((*it)->first != property))
+            it = m_values.insert(it, std::make_unique<value_type>(property, ObjectConverter{}));
+
+        return (*it)->second;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    ObjectConverter& RendererPropertyValues::operator[](const std::string& property)
+    {
+        return (*this)[getRendererProperty(property)];
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    RendererPropertyValues::iterator RendererPropertyValues::find(RendererProperty property)
+    {
+        const auto it = std::lower_bound(m_values.begin(), m_values.end(), property, compareProperty);
+        if ((it != m_values.end()) && ((*it)->first == property))
+            return it;
+        else
+            return m_values.end();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    RendererPropertyValues::const_iterator RendererPropertyValues::find(RendererProperty property) const
+    {
+        const auto it = std::lower_bound(m_values.begin(), m_values.end(), property, compareProperty);
+        if ((it != m_values.end()) && ((*it)->first == property))
+            return it;
+        else
+            return m_values.end();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    RendererPropertyValues::iterator RendererPropertyValues::find(const std::string& property)
+    {
+        RendererProperty id;
+        if (findRendererProperty(property, id))
+            return find(id);
+        else
+            return m_values.end();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    RendererPropertyValues::const_iterator RendererPropertyValues::find(const std::string& property) const
+    {
+        RendererProperty id;
+        if (findRendererProperty(property, id))
+            return find(id);
+        else
+            return m_values.end();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     TGUI_RENDERER_PROPERTY_BOOL(WidgetRenderer, TransparentTexture, false)
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -38,7 +196,7 @@ namespace tgui
 
     void WidgetRenderer::setOpacity(float opacity)
     {
-        setProperty("opacity", ObjectConverter{std::max(0.f, std::min(1.f, opacity))});
+        setProperty(RendererProperty::Opacity, ObjectConverter{std::max(0.f, std::min(1.f, opacity))});
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -48,23 +206,23 @@ namespace tgui
     void WidgetRenderer::setOpacityDisabled(float opacity)
     {
         if (opacity != -1.f)
-            setProperty("opacitydisabled", ObjectConverter{std::max(0.f, std::min(1.f, opacity))});
+            setProperty(RendererProperty::OpacityDisabled, ObjectConverter{std::max(0.f, std::min(1.f, opacity))});
         else
-            setProperty("opacitydisabled", ObjectConverter{-1.f});
+            setProperty(RendererProperty::OpacityDisabled, ObjectConverter{-1.f});
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void WidgetRenderer::setFont(Font font)
     {
-        setProperty("font", font);
+        setProperty(RendererProperty::Font, font);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Font WidgetRenderer::getFont() const
     {
-        auto it = m_data->propertyValuePairs.find("font");
+        auto it = m_data->propertyValuePairs.find(RendererProperty::Font);
         if (it != m_data->propertyValuePairs.end())
             return it->second.getFont();
         else
@@ -75,19 +233,59 @@ namespace tgui
 
     void WidgetRenderer::setProperty(const std::string& property, ObjectConverter&& value)
     {
-        std::string lowercaseProperty = toLower(property);
+        setProperty(getRendererProperty(toLower(property)), std::move(value));
+    }
 
-        if (m_data->propertyValuePairs[lowercaseProperty] != value)
-        {
-            m_data->propertyValuePairs[lowercaseProperty] = value;
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-            for (const auto& observer : m_data->observers)
-                observer.second(lowercaseProperty);
+    void WidgetRenderer::setProperty(RendererProperty property, ObjectConverter&& value)
+    {
+        auto& oldValue = m_data->propertyValuePairs[property];
+        if (oldValue != value)
+        {
+            oldValue = std::move(value);
+
+            if (m_data->transactionDepth > 0)
+            {
+                auto& changedProperties = m_data->changedProperties;
+                const auto it = std::lower_bound(changedProperties.begin(), changedProperties.end(), property);
+                if ((it == changedProperties.end()) || (*it != property))
+                    changedProperties.insert(it, property);
+            }
+            else
+            {
+                const std::vector<RendererProperty> properties{property};
+                for (const auto& observer : m_data->observers)
+                    observer.second(properties);
+            }
         }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void WidgetRenderer::beginTransaction()
+    {
+        ++m_data->transactionDepth;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void WidgetRenderer::commitTransaction()
+    {
+        if ((m_data->transactionDepth == 0) || (--m_data->transactionDepth > 0))
+            return;
+
+        const std::vector<RendererProperty> properties = std::move(m_data->changedProperties);
+        m_data->changedProperties.clear();
+        if (properties.empty())
+            return;
+
+        for (const auto& observer : m_data->observers)
+            observer.second(properties);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     ObjectConverter WidgetRenderer::getProperty(const std::string& property) const
     {
         auto it = m_data->propertyValuePairs.find(toLower(property));
@@ -99,14 +297,25 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    const std::map<std::string, ObjectConverter>& WidgetRenderer::getPropertyValuePairs() const
+    ObjectConverter WidgetRenderer::getProperty(RendererProperty property) const
+    {
+        auto it = m_data->propertyValuePairs.find(property);
+        if (it != m_data->propertyValuePairs.end())
+            return it->second;
+        else
+            return {};
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const RendererPropertyValues& WidgetRenderer::getPropertyValuePairs() const
     {
         return m_data->propertyValuePairs;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void WidgetRenderer::subscribe(const void* id, const std::function<void(const std::string& property)>& function)
+    void WidgetRenderer::subscribe(const void* id, const std::function<void(const std::vector<RendererProperty>& properties)>& function)
     {
         m_data->observers[id] = function;
     }
@@ -138,6 +347,8 @@ namespace tgui
     {
         auto data = std::make_shared<RendererData>(*m_data);
         data->observers = {};
+        data->transactionDepth = 0;
+        data->changedProperties.clear();
         return data;
     }
 
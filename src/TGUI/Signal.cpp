@@ -28,6 +28,8 @@
 #include <TGUI/Widgets/ChildWindow.hpp>
 #include <TGUI/SignalImpl.hpp>
 
+#include <algorithm>
+#include <cctype>
 #include <set>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -50,23 +52,22 @@ namespace
         return *type == typeid(T);
     #endif
     }
+
+    bool equalIgnoringCase(const std::string& str1, const std::string& str2)
+    {
+        return (str1.length() == str2.length())
+            && std::equal(str1.begin(), str1.end(), str2.begin(), [](char c1, char c2){ return std::tolower(static_cast<unsigned char>(c1)) == std::tolower(static_cast<unsigned char>(c2)); });
+    }
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
 {
-    namespace internal_signal
-    {
-        std::deque<const void*> parameters;
-    }
-
-    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-
     Signal::Signal(const Signal& other) :
         m_enabled {other.m_enabled},
         m_name    {other.m_name},
-        m_handlers{} // signal handlers are not copied with the widget
+        m_handlers{nullptr} // signal handlers are not copied with the widget
     {
     }
 
@@ -78,7 +79,7 @@ namespace tgui
         {
             m_enabled = other.m_enabled;
             m_name = other.m_name;
-            m_handlers.clear(); // signal handlers are not copied with the widget
+            m_handlers = nullptr; // signal handlers are not copied with the widget
         }
 
         return *this;
@@ -88,17 +89,22 @@ namespace tgui
 
     unsigned int Signal::connect(const Delegate& handler)
     {
-        const auto id = generateUniqueId();
-        m_handlers[id] = handler;
-        return id;
+        return connectInternal([handler](const void* const*){ handler(); });
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     unsigned int Signal::connect(const DelegateEx& handler)
+    {
+        return connectInternal([handler, name=m_name](const void* const* parameters){ handler(getWidget(parameters), name); });
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    unsigned int Signal::connectInternal(internal_signal::Handler handler)
     {
         const auto id = generateUniqueId();
-        m_handlers[id] = [handler, name=m_name](){ handler(getWidget(), name); };
+        getHandlersForWriting().emplace_back(id, std::move(handler));
         return id;
     }
 
@@ -106,21 +112,46 @@ namespace tgui
 
     bool Signal::disconnect(unsigned int id)
     {
-        return m_handlers.erase(id) == 0;
+        if (!m_handlers)
+            return false;
+
+        const auto isConnection = [id](const std::pair<unsigned int, internal_signal::Handler>& handler){ return handler.first == id; };
+        if (std::none_of(m_handlers->begin(), m_handlers->end(), isConnection))
+            return false;
+
+        auto& handlers = getHandlersForWriting();
+        handlers.erase(std::find_if(handlers.begin(), handlers.end(), isConnection));
+        return true;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void Signal::disconnectAll()
     {
-        m_handlers.clear();
+        // Only clear the list when no emit is iterating over it
+        if (m_handlers && (m_handlers.use_count() == 1))
+            m_handlers->clear();
+        else
+            m_handlers = nullptr;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    Widget::Ptr Signal::getWidget()
+    Widget::Ptr Signal::getWidget(const void* const* parameters)
     {
-        return internal_signal::dereference<Widget*>(internal_signal::parameters[0])->shared_from_this();
+        return internal_signal::dereference<Widget*>(parameters[0])->shared_from_this();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::vector<std::pair<unsigned int, internal_signal::Handler>>& Signal::getHandlersForWriting()
+    {
+        if (!m_handlers)
+            m_handlers = std::make_shared<std::vector<std::pair<unsigned int, internal_signal::Handler>>>();
+        else if (m_handlers.use_count() > 1) // The handlers are being called, so the list that is being iterated can't be changed
+            m_handlers = std::make_shared<std::vector<std::pair<unsigned int, internal_signal::Handler>>>(*m_handlers);
+
+        return *m_handlers;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -139,16 +170,12 @@ namespace tgui
     #define TGUI_SIGNAL_VALUE_CONNECT_DEFINITION(TypeName, Type) \
     unsigned int Signal##TypeName::connect(const Delegate##TypeName& handler) \
     { \
-        const auto id = generateUniqueId(); \
-        m_handlers[id] = [handler](){ handler(internal_signal::dereference<Type>(internal_signal::parameters[1])); }; \
-        return id; \
+        return connectInternal([handler](const void* const* parameters){ handler(internal_signal::dereference<Type>(parameters[1])); }); \
     } \
     \
     unsigned int Signal##TypeName::connect(const Delegate##TypeName##Ex& handler) \
     { \
-        const auto id = generateUniqueId(); \
-        m_handlers[id] = [handler, name=m_name](){ handler(getWidget(), name, internal_signal::dereference<Type>(internal_signal::parameters[1])); }; \
-        return id; \
+        return connectInternal([handler, name=m_name](const void* const* parameters){ handler(getWidget(parameters), name, internal_signal::dereference<Type>(parameters[1])); }); \
     }
 
     TGUI_SIGNAL_VALUE_CONNECT_DEFINITION(Int, int)
@@ -223,30 +250,22 @@ namespace tgui
 #ifndef TGUI_REMOVE_DEPRECATED_CODE
     unsigned int SignalRange::connect(const DelegateRange& handler)
     {
-        const auto id = generateUniqueId();
-        m_handlers[id] = [handler](){ handler(internal_signal::dereference<float>(internal_signal::parameters[1]), internal_signal::dereference<float>(internal_signal::parameters[2])); };
-        return id;
+        return connectInternal([handler](const void* const* parameters){ handler(internal_signal::dereference<float>(parameters[1]), internal_signal::dereference<float>(parameters[2])); });
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     unsigned int SignalRange::connect(const DelegateRangeEx& handler)
     {
-        const auto id = generateUniqueId();
-        m_handlers[id] = [handler, name=m_name](){ handler(getWidget(), name, internal_signal::dereference<float>(internal_signal::parameters[1]), internal_signal::dereference<float>(internal_signal::parameters[2])); };
-        return id;
+        return connectInternal([handler, name=m_name](const void* const* parameters){ handler(getWidget(parameters), name, internal_signal::dereference<float>(parameters[1]), internal_signal::dereference<float>(parameters[2])); });
     }
 #endif
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     bool SignalRange::emit(const Widget* widget, float start, float end)
     {
-        if (m_handlers.empty())
-            return false;
-
-        internal_signal::parameters[1] = static_cast<const void*>(&start);
-        internal_signal::parameters[2] = static_cast<const void*>(&end);
-        return Signal::emit(widget);
+        const void* parameters[] = {static_cast<const void*>(&widget), static_cast<const void*>(&start), static_cast<const void*>(&end)};
+        return callHandlers(parameters);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -263,30 +282,27 @@ namespace tgui
 #ifndef TGUI_REMOVE_DEPRECATED_CODE
     unsigned int SignalChildWindow::connect(const DelegateChildWindow& handler)
     {
-        const auto id = generateUniqueId();
-        m_handlers[id] = [handler](){ handler(internal_signal::dereference<ChildWindow::Ptr>(internal_signal::parameters[1])); };
-        return id;
+        return connectInternal([handler](const void* const* parameters){ handler(internal_signal::dereference<ChildWindow::Ptr>(parameters[1])); });
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     unsigned int SignalChildWindow::connect(const DelegateChildWindowEx& handler)
     {
-        const auto id = generateUniqueId();
-        m_handlers[id] = [handler, name=m_name](){ handler(getWidget(), name, internal_signal::dereference<ChildWindow::Ptr>(internal_signal::parameters[1])); };
-        return id;
+        return connectInternal([handler, name=m_name](const void* const* parameters){ handler(getWidget(parameters), name, internal_signal::dereference<ChildWindow::Ptr>(parameters[1])); });
     }
 #endif
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     bool SignalChildWindow::emit(ChildWindow* childWindow)
     {
-        if (m_handlers.empty())
+        if (!m_handlers || m_handlers->empty())
             return false;
 
+        const Widget* widget = childWindow;
         ChildWindow::Ptr sharedPtr = std::static_pointer_cast<ChildWindow>(childWindow->shared_from_this());
-        internal_signal::parameters[1] = static_cast<const void*>(&sharedPtr);
-        return Signal::emit(childWindow);
+        const void* parameters[] = {static_cast<const void*>(&widget), static_cast<const void*>(&sharedPtr)};
+        return callHandlers(parameters);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -303,36 +319,28 @@ namespace tgui
 #ifndef TGUI_REMOVE_DEPRECATED_CODE
     unsigned int SignalItem::connect(const DelegateItem& handler)
     {
-        const auto id = generateUniqueId();
-        m_handlers[id] = [handler](){ handler(internal_signal::dereference<sf::String>(internal_signal::parameters[1])); };
-        return id;
+        return connectInternal([handler](const void* const* parameters){ handler(internal_signal::dereference<sf::String>(parameters[1])); });
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     unsigned int SignalItem::connect(const DelegateItemEx& handler)
     {
-        const auto id = generateUniqueId();
-        m_handlers[id] = [handler, name=m_name](){ handler(getWidget(), name, internal_signal::dereference<sf::String>(internal_signal::parameters[1])); };
-        return id;
+        return connectInternal([handler, name=m_name](const void* const* parameters){ handler(getWidget(parameters), name, internal_signal::dereference<sf::String>(parameters[1])); });
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     unsigned int SignalItem::connect(const DelegateItemAndId& handler)
     {
-        const auto id = generateUniqueId();
-        m_handlers[id] = [handler](){ handler(internal_signal::dereference<sf::String>(internal_signal::parameters[1]), internal_signal::dereference<sf::String>(internal_signal::parameters[2])); };
-        return id;
+        return connectInternal([handler](const void* const* parameters){ handler(internal_signal::dereference<sf::String>(parameters[1]), internal_signal::dereference<sf::String>(parameters[2])); });
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     unsigned int SignalItem::connect(const DelegateItemAndIdEx& handler)
     {
-        const auto id = generateUniqueId();
-        m_handlers[id] = [handler, name=m_name](){ handler(getWidget(), name, internal_signal::dereference<sf::String>(internal_signal::parameters[1]), internal_signal::dereference<sf::String>(internal_signal::parameters[2])); };
-        return id;
+        return connectInternal([handler, name=m_name](const void* const* parameters){ handler(getWidget(parameters), name, internal_signal::dereference<sf::String>(parameters[1]), internal_signal::dereference<sf::String>(parameters[2])); });
     }
 #endif
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -355,36 +363,28 @@ namespace tgui
 #ifndef TGUI_REMOVE_DEPRECATED_CODE
     unsigned int SignalItemHierarchy::connect(const DelegateMenuItem& handler)
     {
-        const auto id = generateUniqueId();
-        m_handlers[id] = [handler](){ handler(internal_signal::dereference<sf::String>(internal_signal::parameters[1])); };
-        return id;
+        return connectInternal([handler](const void* const* parameters){ handler(internal_signal::dereference<sf::String>(parameters[1])); });
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     unsigned int SignalItemHierarchy::connect(const DelegateMenuItemEx& handler)
     {
-        const auto id = generateUniqueId();
-        m_handlers[id] = [handler, name=m_name](){ handler(getWidget(), name, internal_signal::dereference<sf::String>(internal_signal::parameters[1])); };
-        return id;
+        return connectInternal([handler, name=m_name](const void* const* parameters){ handler(getWidget(parameters), name, internal_signal::dereference<sf::String>(parameters[1])); });
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     unsigned int SignalItemHierarchy::connect(const DelegateMenuItemFull& handler)
     {
-        const auto id = generateUniqueId();
-        m_handlers[id] = [handler](){ handler(internal_signal::dereference<std::vector<sf::String>>(internal_signal::parameters[2])); };
-        return id;
+        return connectInternal([handler](const void* const* parameters){ handler(internal_signal::dereference<std::vector<sf::String>>(parameters[2])); });
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     unsigned int SignalItemHierarchy::connect(const DelegateMenuItemFullEx& handler)
     {
-        const auto id = generateUniqueId();
-        m_handlers[id] = [handler, name=m_name](){ handler(getWidget(), name, internal_signal::dereference<std::vector<sf::String>>(internal_signal::parameters[2])); };
-        return id;
+        return connectInternal([handler, name=m_name](const void* const* parameters){ handler(getWidget(parameters), name, internal_signal::dereference<std::vector<sf::String>>(parameters[2])); });
     }
 #endif
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -421,7 +421,8 @@ namespace tgui
         auto it = m_connectedSignals.find(id);
         if (it != m_connectedSignals.end())
         {
-            const bool ret = getSignal(it->second).disconnect(id);
+            Signal* signal = getSignal(it->second);
+            const bool ret = signal ? signal->disconnect(id) : false;
             m_connectedSignals.erase(it);
             return ret;
         }
@@ -433,19 +434,35 @@ namespace tgui
 
     void SignalWidgetBase::disconnectAll(std::string signalName)
     {
-        return getSignal(toLower(std::move(signalName))).disconnectAll();
+        return findSignal(signalName, hashSignalName(signalName.c_str())).disconnectAll();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void SignalWidgetBase::disconnectAll()
     {
-        std::set<std::string> signalNames;
+        std::set<std::uint64_t> signalNameHashes;
         for (const auto& connection : m_connectedSignals)
-            signalNames.insert(connection.second);
+            signalNameHashes.insert(connection.second);
+
+        for (const auto signalNameHash : signalNameHashes)
+        {
+            if (Signal* signal = getSignal(signalNameHash))
+                signal->disconnectAll();
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Signal& SignalWidgetBase::findSignal(const std::string& signalName, std::uint64_t signalNameHash)
+    {
+        Signal* signal = getSignal(signalNameHash);
+
+        // Different names could have the same hash, so the name of the signal that was found is compared as well
+        if (!signal || !equalIgnoringCase(signal->getName(), signalName))
+            throw Exception{"No signal exists with name '" + signalName + "'."};
 
-        for (auto& name : signalNames)
-            getSignal(std::move(name)).disconnectAll();
+        return *signal;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -26,6 +26,8 @@
 #include <TGUI/Sprite.hpp>
 #include <TGUI/Color.hpp>
 #include <TGUI/Clipping.hpp>
+#include <TGUI/RenderBatch.hpp>
+#include <TGUI/TextureManager.hpp>
 
 #include <cassert>
 #include <cmath>
@@ -38,6 +40,16 @@
 
 namespace tgui
 {
+    namespace
+    {
+        sf::Vector2u getSvgTextureSize(Vector2f size)
+        {
+            return {static_cast<unsigned int>(std::round(size.x)), static_cast<unsigned int>(std::round(size.y))};
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     Sprite::Sprite(const Texture& texture)
     {
         setTexture(texture);
@@ -48,6 +60,7 @@ namespace tgui
     void Sprite::setTexture(const Texture& texture)
     {
         m_texture = texture;
+        m_svgTexture = nullptr;
         m_vertexColor = m_texture.getColor();
         m_shader = m_texture.getShader();
 
@@ -153,7 +166,7 @@ namespace tgui
 
     bool Sprite::isTransparentPixel(Vector2f pos) const
     {
-        if (!isSet() || !m_texture.getData()->image || (m_size.x == 0) || (m_size.y == 0))
+        if (!isSet() || (!m_texture.getData()->image && !m_texture.getData()->alphaMask) || (m_size.x == 0) || (m_size.y == 0))
             return true;
 
         if (getRotation() != 0)
@@ -183,74 +196,75 @@ namespace tgui
         // Find out on which pixel the mouse is standing
         sf::Vector2u pixel;
         sf::IntRect middleRect = m_texture.getMiddleRect();
-        const sf::Texture& texture = m_texture.getData()->texture;
+        const Vector2f imageSize = m_texture.getImageSize();
+        const sf::Vector2u textureSize{static_cast<unsigned int>(imageSize.x), static_cast<unsigned int>(imageSize.y)};
         switch (m_scalingType)
         {
             case ScalingType::Normal:
             {
-                pixel.x = static_cast<unsigned int>(pos.x / m_size.x * texture.getSize().x);
-                pixel.y = static_cast<unsigned int>(pos.y / m_size.y * texture.getSize().y);
+                pixel.x = static_cast<unsigned int>(pos.x / m_size.x * textureSize.x);
+                pixel.y = static_cast<unsigned int>(pos.y / m_size.y * textureSize.y);
                 break;
             }
             case ScalingType::Horizontal:
             {
-                if (pos.x >= m_size.x - (texture.getSize().x - middleRect.left - middleRect.width) * (m_size.y / texture.getSize().y))
+                if (pos.x >= m_size.x - (textureSize.x - middleRect.left - middleRect.width) * (m_size.y / textureSize.y))
                 {
-                    float xDiff = (pos.x - (m_size.x - (texture.getSize().x - middleRect.left - middleRect.width) * (m_size.y / texture.getSize().y)));
-                    pixel.x = static_cast<unsigned int>(middleRect.left + middleRect.width + (xDiff / m_size.y * texture.getSize().y));
+                    float xDiff = (pos.x - (m_size.x - (textureSize.x - middleRect.left - middleRect.width) * (m_size.y / textureSize.y)));
+                    pixel.x = static_cast<unsigned int>(middleRect.left + middleRect.width + (xDiff / m_size.y * textureSize.y));
                 }
-                else if (pos.x >= middleRect.left * (m_size.y / texture.getSize().y))
+                else if (pos.x >= middleRect.left * (m_size.y / textureSize.y))
                 {
-                    float xDiff = pos.x - (middleRect.left * (m_size.y / texture.getSize().y));
-                    pixel.x = static_cast<unsigned int>(middleRect.left + (xDiff / (m_size.x - ((texture.getSize().x - middleRect.width) * (m_size.y / texture.getSize().y))) * middleRect.width));
+                    float xDiff = pos.x - (middleRect.left * (m_size.y / textureSize.y));
+                    pixel.x = static_cast<unsigned int>(middleRect.left + (xDiff / (m_size.x - ((textureSize.x - middleRect.width) * (m_size.y / textureSize.y))) * middleRect.width));
                 }
                 else // Mouse on the left part
                 {
-                    pixel.x = static_cast<unsigned int>(pos.x / m_size.y * texture.getSize().y);
+                    pixel.x = static_cast<unsigned int>(pos.x / m_size.y * textureSize.y);
                 }
 
-                pixel.y = static_cast<unsigned int>(pos.y / m_size.y * texture.getSize().y);
+                pixel.y = static_cast<unsigned int>(pos.y / m_size.y * textureSize.y);
                 break;
             }
             case ScalingType::Vertical:
             {
-                if (pos.y >= m_size.y - (texture.getSize().y - middleRect.top - middleRect.height) * (m_size.x / texture.getSize().x))
+                if (pos.y >= m_size.y - (textureSize.y - middleRect.top - middleRect.height) * (m_size.x / textureSize.x))
                 {
-                    float yDiff = (pos.y - (m_size.y - (texture.getSize().y - middleRect.top - middleRect.height) * (m_size.x / texture.getSize().x)));
-                    pixel.y = static_cast<unsigned int>(middleRect.top + middleRect.height + (yDiff / m_size.x * texture.getSize().x));
+                    float yDiff = (pos.y - (m_size.y - (textureSize.y - middleRect.top - middleRect.height) * (m_size.x / textureSize.x)));
+                    pixel.y = static_cast<unsigned int>(middleRect.top + middleRect.height + (yDiff / m_size.x * textureSize.x));
                 }
-                else if (pos.y >= middleRect.top * (m_size.x / texture.getSize().x))
+                else if (pos.y >= middleRect.top * (m_size.x / textureSize.x))
                 {
-                    float yDiff = pos.y - (middleRect.top * (m_size.x / texture.getSize().x));
-                    pixel.y = static_cast<unsigned int>(middleRect.top + (yDiff / (m_size.y - ((texture.getSize().y - middleRect.height) * (m_size.x / texture.getSize().x))) * middleRect.height));
+                    float yDiff = pos.y - (middleRect.top * (m_size.x / textureSize.x));
+                    pixel.y = static_cast<unsigned int>(middleRect.top + (yDiff / (m_size.y - ((textureSize.y - middleRect.height) * (m_size.x / textureSize.x))) * middleRect.height));
                 }
                 else // Mouse on the top part
                 {
-                    pixel.y = static_cast<unsigned int>(pos.y / m_size.x * texture.getSize().x);
+                    pixel.y = static_cast<unsigned int>(pos.y / m_size.x * textureSize.x);
                 }
 
-                pixel.x = static_cast<unsigned int>(pos.x / m_size.x * texture.getSize().x);
+                pixel.x = static_cast<unsigned int>(pos.x / m_size.x * textureSize.x);
                 break;
             }
             case ScalingType::NineSlice:
             {
                 if (pos.x < middleRect.left)
                     pixel.x = static_cast<unsigned int>(pos.x);
-                else if (pos.x >= m_size.x - (texture.getSize().x - middleRect.width - middleRect.left))
-                    pixel.x = static_cast<unsigned int>(pos.x - m_size.x + texture.getSize().x);
+                else if (pos.x >= m_size.x - (textureSize.x - middleRect.width - middleRect.left))
+                    pixel.x = static_cast<unsigned int>(pos.x - m_size.x + textureSize.x);
                 else
                 {
-                    float xDiff = (pos.x - middleRect.left) / (m_size.x - (texture.getSize().x - middleRect.width)) * middleRect.width;
+                    float xDiff = (pos.x - middleRect.left) / (m_size.x - (textureSize.x - middleRect.width)) * middleRect.width;
                     pixel.x = static_cast<unsigned int>(middleRect.left + xDiff);
                 }
 
                 if (pos.y < middleRect.top)
                     pixel.y = static_cast<unsigned int>(pos.y);
-                else if (pos.y >= m_size.y - (texture.getSize().y - middleRect.height - middleRect.top))
-                    pixel.y = static_cast<unsigned int>(pos.y - m_size.y + texture.getSize().y);
+                else if (pos.y >= m_size.y - (textureSize.y - middleRect.height - middleRect.top))
+                    pixel.y = static_cast<unsigned int>(pos.y - m_size.y + textureSize.y);
                 else
                 {
-                    float yDiff = (pos.y - middleRect.top) / (m_size.y - (texture.getSize().y - middleRect.height)) * middleRect.height;
+                    float yDiff = (pos.y - middleRect.top) / (m_size.y - (textureSize.y - middleRect.height)) * middleRect.height;
                     pixel.y = static_cast<unsigned int>(middleRect.top + yDiff);
                 }
 
@@ -270,21 +284,25 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Sprite::updateVertices()
+    void Sprite::updateVertices() const
     {
+        m_textureLoading = m_texture.getData()->loading;
+
         // Figure out how the image is scaled best
         Vector2f textureSize;
         FloatRect middleRect;
         if (m_texture.getData()->svgImage)
         {
-            if (!m_svgTexture)
-                m_svgTexture = aurora::makeCopied<sf::Texture>();
-
-            const sf::Vector2u svgTextureSize{
-                static_cast<unsigned int>(std::round(getSize().x)),
-                static_cast<unsigned int>(std::round(getSize().y))};
-
-            m_texture.getData()->svgImage->rasterize(*m_svgTexture, svgTextureSize);
+            // Sprites showing the same svg at the same size share the rasterized texture.
+            // When rasterizing on a worker thread, the previous texture is kept until the new one is available.
+            if (SvgImage::isAsyncRasterizationEnabled())
+            {
+                auto svgTexture = m_texture.getData()->svgImage->requestRasterizedTexture(getSvgTextureSize(getSize()));
+                if (svgTexture)
+                    m_svgTexture = svgTexture;
+            }
+            else
+                m_svgTexture = m_texture.getData()->svgImage->getRasterizedTexture(getSvgTextureSize(getSize()));
 
             m_scalingType = ScalingType::Normal;
             textureSize = getSize();
@@ -421,6 +439,14 @@ namespace tgui
             m_vertices[21] = {{m_size.x, m_size.y}, vertexColor, {textureSize.x, textureSize.y}};
             break;
         };
+
+        // When the texture is part of an atlas, the texture coordinates have to point to the correct part of it
+        if (m_texture.getData()->atlasTexture && !m_texture.getData()->svgImage)
+        {
+            const sf::Vector2f offset{static_cast<float>(m_texture.getData()->atlasRect.left), static_cast<float>(m_texture.getData()->atlasRect.top)};
+            for (auto& vertex : m_vertices)
+                vertex.texCoords += offset;
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -452,13 +478,66 @@ namespace tgui
             clipping = std::make_unique<Clipping>(target, states, Vector2f{m_visibleRect.left, m_visibleRect.top}, Vector2f{m_visibleRect.width, m_visibleRect.height});
 #endif
 
+        if (m_texture.getData()->loading)
+        {
+            // Draw the loading color until a worker thread has finished decoding the image
+            const sf::Color color = Color::calcColorOpacity(TextureManager::getLoadingColor(), m_opacity);
+            const sf::Vertex vertices[] = {
+                {{0, 0}, color},
+                {{0, m_size.y}, color},
+                {{m_size.x, 0}, color},
+                {{m_size.x, m_size.y}, color}
+            };
+            RenderBatch::draw(target, vertices, 4, sf::PrimitiveType::TrianglesStrip, states);
+            return;
+        }
+        else if (m_textureLoading)
+            updateVertices();
+
+        states.shader = m_shader;
         if (m_texture.getData()->svgImage)
+        {
+            const sf::Vector2u svgTextureSize = getSvgTextureSize(getSize());
+            if (SvgImage::isAsyncRasterizationEnabled() && (!m_svgTexture || (m_svgTexture->getSize() != svgTextureSize)))
+            {
+                auto svgTexture = m_texture.getData()->svgImage->requestRasterizedTexture(svgTextureSize);
+                if (svgTexture)
+                {
+                    // Triangles that use the old texture may still have to be drawn
+                    RenderBatch::flush(target);
+                    m_svgTexture = svgTexture;
+                }
+            }
+
+            if (!m_svgTexture)
+                return;
+
             states.texture = m_svgTexture.get();
+
+            // Stretch the previous texture while the image is still being rasterized at the new size
+            if ((m_svgTexture->getSize() != svgTextureSize) && (getSize().x > 0) && (getSize().y > 0))
+            {
+                const float scaleX = m_svgTexture->getSize().x / getSize().x;
+                const float scaleY = m_svgTexture->getSize().y / getSize().y;
+
+                sf::Vertex vertices[4];
+                for (unsigned int i = 0; i < 4; ++i)
+                {
+                    vertices[i] = m_vertices[i];
+                    vertices[i].texCoords.x *= scaleX;
+                    vertices[i].texCoords.y *= scaleY;
+                }
+
+                RenderBatch::draw(target, vertices, 4, sf::PrimitiveType::TrianglesStrip, states);
+                return;
+            }
+        }
+        else if (m_texture.getData()->atlasTexture)
+            states.texture = m_texture.getData()->atlasTexture.get();
         else
             states.texture = &m_texture.getData()->texture;
 
-        states.shader = m_shader;
-        target.draw(m_vertices.data(), m_vertices.size(), sf::PrimitiveType::TrianglesStrip, states);
+        RenderBatch::draw(target, m_vertices.data(), m_vertices.size(), sf::PrimitiveType::TrianglesStrip, states);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
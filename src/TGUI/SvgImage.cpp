@@ -24,6 +24,7 @@
 
 
 #include <TGUI/SvgImage.hpp>
+#include <TGUI/WorkerPool.hpp>
 
 #define NANOSVG_IMPLEMENTATION
 #include "TGUI/nanosvg/nanosvg.h"
@@ -31,10 +32,113 @@
 #define NANOSVGRAST_IMPLEMENTATION
 #include "TGUI/nanosvg/nanosvgrast.h"
 
+#include <list>
+#include <map>
+#include <tuple>
+#include <vector>
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
 {
+    namespace
+    {
+        struct RasterCacheEntry
+        {
+            const SvgImage* svgImage;
+            sf::Vector2u size;
+            std::shared_ptr<sf::Texture> texture;
+
+            // Buffer that a worker thread is rasterizing the image into, the texture is nullptr until it is finished
+            std::shared_ptr<std::vector<unsigned char>> pendingPixels;
+        };
+
+        using RasterCacheKey = std::tuple<const SvgImage*, unsigned int, unsigned int>;
+
+        struct RasterCache
+        {
+            ~RasterCache()
+            {
+                destroyed = true;
+            }
+
+            // Entries are moved to the front of the list when used, so the least recently used ones are at the back
+            std::list<RasterCacheEntry> entries;
+            std::map<RasterCacheKey, std::list<RasterCacheEntry>::iterator> lookup;
+            std::size_t usedBytes = 0;
+            std::size_t budget = 16 * 1024 * 1024;
+
+            // Svg images that are destroyed after the cache (e.g. in static textures) must no longer access it
+            static bool destroyed;
+        };
+
+        bool RasterCache::destroyed = false;
+
+        RasterCache& getRasterCache()
+        {
+            static RasterCache cache;
+            return cache;
+        }
+
+        std::size_t getTextureBytes(sf::Vector2u size)
+        {
+            return static_cast<std::size_t>(size.x) * size.y * 4;
+        }
+
+        void removeCacheEntry(RasterCache& cache, std::list<RasterCacheEntry>::iterator it)
+        {
+            if (it->texture)
+                cache.usedBytes -= getTextureBytes(it->size);
+
+            cache.lookup.erase(RasterCacheKey{it->svgImage, it->size.x, it->size.y});
+            cache.entries.erase(it);
+        }
+
+        void shrinkRasterCache(RasterCache& cache)
+        {
+            while ((cache.usedBytes > cache.budget) && !cache.entries.empty())
+                removeCacheEntry(cache, std::prev(cache.entries.end()));
+        }
+
+        void rasterizeToPixels(NSVGrasterizer* rasterizer, NSVGimage* svg, sf::Vector2u size, unsigned char* pixels)
+        {
+            const float scaleX = size.x / static_cast<float>(svg->width);
+            const float scaleY = size.y / static_cast<float>(svg->height);
+            nsvgRasterizeFull(rasterizer, svg, 0, 0, static_cast<double>(scaleX), static_cast<double>(scaleY), pixels, size.x, size.y, size.x * 4);
+        }
+
+        // Called on the gui thread once a worker thread finished rasterizing the image
+        void finishRasterization(const SvgImage* svgImage, sf::Vector2u size, const std::shared_ptr<std::vector<unsigned char>>& pixels)
+        {
+            if (RasterCache::destroyed)
+                return;
+
+            // Nothing has to be done when the svg image was destroyed or the entry was removed from the cache in the meantime
+            RasterCache& cache = getRasterCache();
+            const auto lookupIt = cache.lookup.find(RasterCacheKey{svgImage, size.x, size.y});
+            if ((lookupIt == cache.lookup.end()) || (lookupIt->second->pendingPixels != pixels))
+                return;
+
+            // If the texture can't be created then the entry remains in the cache without texture, so that we don't retry
+            RasterCacheEntry& entry = *lookupIt->second;
+            entry.pendingPixels = nullptr;
+
+            auto texture = std::make_shared<sf::Texture>();
+            if (!texture->create(size.x, size.y))
+                return;
+
+            texture->update(pixels->data(), size.x, size.y, 0, 0);
+            entry.texture = texture;
+            cache.usedBytes += getTextureBytes(size);
+            shrinkRasterCache(cache);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool SvgImage::m_asyncRasterizationEnabled = false;
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     SvgImage::SvgImage(const sf::String& filename)
@@ -46,8 +150,10 @@ namespace tgui
         const std::string filenameAnsiString(filenameUtf8.begin(), filenameUtf8.end());
 #endif
 
-        m_svg = nsvgParseFromFile(filenameAnsiString.c_str(), "px", 96);
-        if (!m_svg)
+        NSVGimage* svg = nsvgParseFromFile(filenameAnsiString.c_str(), "px", 96);
+        if (svg)
+            m_svg = std::shared_ptr<NSVGimage>(svg, nsvgDelete);
+        else
             TGUI_PRINT_WARNING("Failed to load svg: " << filenameAnsiString);
     }
 
@@ -55,10 +161,21 @@ namespace tgui
 
     SvgImage::~SvgImage()
     {
+        // Remove the rasterized versions of this image from the cache
+        if (!RasterCache::destroyed)
+        {
+            RasterCache& cache = getRasterCache();
+            for (auto it = cache.entries.begin(); it != cache.entries.end();)
+            {
+                if (it->svgImage == this)
+                    removeCacheEntry(cache, it++);
+                else
+                    ++it;
+            }
+        }
+
         if (m_rasterizer)
             nsvgDeleteRasterizer(m_rasterizer);
-        if (m_svg)
-            nsvgDelete(m_svg);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -94,16 +211,118 @@ namespace tgui
                 return;
         }
 
-        const float scaleX = size.x / static_cast<float>(m_svg->width);
-        const float scaleY = size.y / static_cast<float>(m_svg->height);
-
         auto pixels = std::make_unique<unsigned char[]>(size.x * size.y * 4);
-        nsvgRasterizeFull(m_rasterizer, m_svg, 0, 0, static_cast<double>(scaleX), static_cast<double>(scaleY), pixels.get(), size.x, size.y, size.x * 4);
+        rasterizeToPixels(m_rasterizer, m_svg.get(), size, pixels.get());
 
         texture.update(pixels.get(), size.x, size.y, 0, 0);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::shared_ptr<sf::Texture> SvgImage::getRasterizedTexture(sf::Vector2u size)
+    {
+        if (!m_svg || (size.x == 0) || (size.y == 0))
+            return nullptr;
+
+        RasterCache& cache = getRasterCache();
+        const auto lookupIt = cache.lookup.find(RasterCacheKey{this, size.x, size.y});
+        if (lookupIt != cache.lookup.end())
+        {
+            // If a worker thread is still rasterizing the image then we don't wait for it and rasterize it here instead
+            if (lookupIt->second->pendingPixels)
+                removeCacheEntry(cache, lookupIt->second);
+            else
+            {
+                // Mark the entry as the most recently used one
+                cache.entries.splice(cache.entries.begin(), cache.entries, lookupIt->second);
+                return lookupIt->second->texture;
+            }
+        }
+
+        auto texture = std::make_shared<sf::Texture>();
+        rasterize(*texture, size);
+        if (texture->getSize() != size)
+            return nullptr;
+
+        cache.entries.push_front({this, size, texture, nullptr});
+        cache.lookup[RasterCacheKey{this, size.x, size.y}] = cache.entries.begin();
+        cache.usedBytes += getTextureBytes(size);
+        shrinkRasterCache(cache);
+        return texture;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::shared_ptr<sf::Texture> SvgImage::requestRasterizedTexture(sf::Vector2u size)
+    {
+        if (!m_svg || (size.x == 0) || (size.y == 0))
+            return nullptr;
+
+        RasterCache& cache = getRasterCache();
+        const auto lookupIt = cache.lookup.find(RasterCacheKey{this, size.x, size.y});
+        if (lookupIt != cache.lookup.end())
+        {
+            // Mark the entry as the most recently used one. The texture is still nullptr while the image is being rasterized.
+            cache.entries.splice(cache.entries.begin(), cache.entries, lookupIt->second);
+            return lookupIt->second->texture;
+        }
+
+        auto pixels = std::make_shared<std::vector<unsigned char>>(static_cast<std::size_t>(size.x) * size.y * 4);
+        cache.entries.push_front({this, size, nullptr, pixels});
+        cache.lookup[RasterCacheKey{this, size.x, size.y}] = cache.entries.begin();
+
+        // The nanosvg rasterizer isn't thread-safe, so the worker uses its own one. The parsed image is only read from.
+        std::shared_ptr<NSVGimage> svg = m_svg;
+        const SvgImage* svgImage = this;
+        WorkerPool::addTask(
+            [svg,size,pixels]{
+                NSVGrasterizer* rasterizer = nsvgCreateRasterizer();
+                rasterizeToPixels(rasterizer, svg.get(), size, pixels->data());
+                nsvgDeleteRasterizer(rasterizer);
+            },
+            [svgImage,size,pixels]{ finishRasterization(svgImage, size, pixels); });
+
+        return nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void SvgImage::setAsyncRasterizationEnabled(bool enabled)
+    {
+        m_asyncRasterizationEnabled = enabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool SvgImage::isAsyncRasterizationEnabled()
+    {
+        return m_asyncRasterizationEnabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void SvgImage::setRasterCacheBudget(std::size_t bytes)
+    {
+        RasterCache& cache = getRasterCache();
+        cache.budget = bytes;
+        shrinkRasterCache(cache);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t SvgImage::getRasterCacheBudget()
+    {
+        return getRasterCache().budget;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t SvgImage::getRasterCacheUsage()
+    {
+        return getRasterCache().usedBytes;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
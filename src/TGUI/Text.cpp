@@ -25,13 +25,216 @@
 
 #include <TGUI/Text.hpp>
 #include <TGUI/Global.hpp>
+#include <TGUI/RenderBatch.hpp>
 #include <SFML/Graphics/RenderTarget.hpp>
 #include <cmath>
+#include <list>
+#include <map>
+#include <tuple>
+#include <vector>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
 {
+    namespace
+    {
+        // Key of a measured line width (maxWidth is negative) or of a word wrapped text
+        using LayoutCacheKey = std::tuple<std::basic_string<sf::Uint32>, unsigned int, bool, float, bool>;
+
+        struct LayoutCacheEntry
+        {
+            LayoutCacheKey key;
+            float width;
+            std::vector<std::size_t> lineBreaks; // Positions in the text where wordWrap inserts a newline
+        };
+
+        struct FontLayoutCache
+        {
+            // The address of a destroyed font can be reused by a new font, in which case the cached values are no longer valid
+            std::weak_ptr<sf::Font> font;
+
+            // Entries are moved to the front of the list when used, so the least recently used ones are at the back
+            std::list<LayoutCacheEntry> entries;
+            std::map<LayoutCacheKey, std::list<LayoutCacheEntry>::iterator> lookup;
+
+            std::map<std::pair<unsigned int, bool>, float> extraVerticalSpaces;
+
+            // Line spacing and line height (line spacing plus extra vertical space) per character size, used to find the best
+            // text size for a height. Values are negative until they are calculated.
+            std::vector<float> lineSpacings;
+            std::vector<float> lineHeights;
+        };
+
+        const std::size_t maxLayoutCacheEntriesPerFont = 256;
+
+        // Long texts (e.g. the contents of a text box) would only push the short ones out of the cache
+        const std::size_t maxLayoutCacheTextLength = 1024;
+
+        std::map<const sf::Font*, FontLayoutCache> layoutCaches;
+        std::size_t layoutCacheHits = 0;
+        std::size_t layoutCacheMisses = 0;
+
+        FontLayoutCache& getLayoutCache(const Font& font)
+        {
+            const std::shared_ptr<sf::Font> sfFont = font.getFont();
+            FontLayoutCache& cache = layoutCaches[sfFont.get()];
+            if (cache.font.expired())
+            {
+                // Either the font wasn't cached yet or this is a new font with the address of a destroyed one.
+                // Remove the caches of all destroyed fonts while we are at it.
+                for (auto it = layoutCaches.begin(); it != layoutCaches.end();)
+                {
+                    if ((it->first != sfFont.get()) && it->second.font.expired())
+                        it = layoutCaches.erase(it);
+                    else
+                        ++it;
+                }
+
+                cache = FontLayoutCache{};
+                cache.font = sfFont;
+            }
+
+            return cache;
+        }
+
+        const LayoutCacheEntry* findLayoutCacheEntry(FontLayoutCache& cache, const LayoutCacheKey& key)
+        {
+            const auto lookupIt = cache.lookup.find(key);
+            if (lookupIt == cache.lookup.end())
+            {
+                ++layoutCacheMisses;
+                return nullptr;
+            }
+
+            ++layoutCacheHits;
+            cache.entries.splice(cache.entries.begin(), cache.entries, lookupIt->second);
+            return &*lookupIt->second;
+        }
+
+        void addLayoutCacheEntry(FontLayoutCache& cache, LayoutCacheEntry&& entry)
+        {
+            cache.entries.push_front(std::move(entry));
+            cache.lookup[cache.entries.front().key] = cache.entries.begin();
+
+            if (cache.entries.size() > maxLayoutCacheEntriesPerFont)
+            {
+                cache.lookup.erase(cache.entries.back().key);
+                cache.entries.pop_back();
+            }
+        }
+
+        float getCachedLineSpacing(FontLayoutCache& cache, const Font& font, unsigned int characterSize)
+        {
+            if (cache.lineSpacings.size() <= characterSize)
+                cache.lineSpacings.resize(characterSize + 1, -1);
+
+            if (cache.lineSpacings[characterSize] < 0)
+                cache.lineSpacings[characterSize] = font.getLineSpacing(characterSize);
+
+            return cache.lineSpacings[characterSize];
+        }
+
+        float getCachedLineHeight(FontLayoutCache& cache, const Font& font, unsigned int characterSize)
+        {
+            if (cache.lineHeights.size() <= characterSize)
+                cache.lineHeights.resize(characterSize + 1, -1);
+
+            if (cache.lineHeights[characterSize] < 0)
+            {
+                cache.lineHeights[characterSize] = getCachedLineSpacing(cache, font, characterSize)
+                                                   + Text::calculateExtraVerticalSpace(font, characterSize);
+            }
+
+            return cache.lineHeights[characterSize];
+        }
+
+        // Finds the positions in the text where wordWrap has to insert a newline
+        std::vector<std::size_t> findLineBreaks(float maxWidth, const sf::String& text, const Font& font, unsigned int textSize, bool bold, bool dropLeadingSpace)
+        {
+            const GlyphAdvanceTable& glyphAdvances = font.getGlyphAdvanceTable(textSize, bold);
+
+            std::vector<std::size_t> lineBreaks;
+            std::size_t index = 0;
+            while (index < text.getSize())
+            {
+                const std::size_t oldIndex = index;
+
+                // Find out how many characters we can get on this line
+                float width = 0;
+                std::uint32_t prevChar = 0;
+                for (std::size_t i = index; i < text.getSize(); ++i)
+                {
+                    float charWidth;
+                    const std::uint32_t curChar = text[i];
+                    if (curChar == '\n')
+                    {
+                        index++;
+                        break;
+                    }
+                    else if (curChar == '\t')
+                        charWidth = glyphAdvances.getAdvance(' ') * 4;
+                    else
+                        charWidth = glyphAdvances.getAdvance(curChar);
+
+                    const float kerning = glyphAdvances.getKerning(prevChar, curChar);
+                    if ((maxWidth == 0) || (width + charWidth + kerning <= maxWidth))
+                    {
+                        width += kerning + charWidth;
+                        index++;
+                    }
+                    else
+                        break;
+
+                    prevChar = curChar;
+                }
+
+                // Every line contains at least one character
+                if (index == oldIndex)
+                    index++;
+
+                // Implement the word-wrap by removing the last few characters from the line
+                if (text[index-1] != '\n')
+                {
+                    const std::size_t indexWithoutWordWrap = index;
+                    if ((index < text.getSize()) && (!isWhitespace(text[index])))
+                    {
+                        std::size_t wordWrapCorrection = 0;
+                        while ((index > oldIndex) && (!isWhitespace(text[index - 1])))
+                        {
+                            wordWrapCorrection++;
+                            index--;
+                        }
+
+                        // The word can't be split but there is no other choice, it does not fit on the line
+                        if ((index - oldIndex) <= wordWrapCorrection)
+                            index = indexWithoutWordWrap;
+                    }
+                }
+
+                // If the next line starts with just a space, then the space need not be visible
+                if (dropLeadingSpace)
+                {
+                    if ((index < text.getSize()) && (text[index] == ' '))
+                    {
+                        if ((index == 0) || (!isWhitespace(text[index-1])))
+                        {
+                            // But two or more spaces indicate that it is not a normal text and the spaces should not be ignored
+                            if (((index + 1 < text.getSize()) && (!isWhitespace(text[index + 1]))) || (index + 1 == text.getSize()))
+                                index++;
+                        }
+                    }
+                }
+
+                if ((index < text.getSize()) && (text[index-1] != '\n'))
+                    lineBreaks.push_back(index);
+            }
+
+            return lineBreaks;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     Vector2f Text::getSize() const
@@ -44,6 +247,7 @@ namespace tgui
     void Text::setString(const sf::String& string)
     {
         m_text.setString(string);
+        m_verticesOutdated = true;
         recalculateSize();
     }
 
@@ -59,6 +263,7 @@ namespace tgui
     void Text::setCharacterSize(unsigned int size)
     {
         m_text.setCharacterSize(size);
+        m_verticesOutdated = true;
         recalculateSize();
     }
 
@@ -74,6 +279,7 @@ namespace tgui
     void Text::setColor(Color color)
     {
         m_color = color;
+        m_verticesOutdated = true;
 
     #if SFML_VERSION_MAJOR > 2 || (SFML_VERSION_MAJOR == 2 && SFML_VERSION_MINOR >= 4)
         m_text.setFillColor(Color::calcColorOpacity(color, m_opacity));
@@ -94,6 +300,7 @@ namespace tgui
     void Text::setOpacity(float opacity)
     {
         m_opacity = opacity;
+        m_verticesOutdated = true;
 
     #if SFML_VERSION_MAJOR > 2 || (SFML_VERSION_MAJOR == 2 && SFML_VERSION_MINOR >= 4)
         m_text.setFillColor(Color::calcColorOpacity(m_color, opacity));
@@ -114,6 +321,7 @@ namespace tgui
     void Text::setFont(Font font)
     {
         m_font = font;
+        m_verticesOutdated = true;
 
         if (font)
             m_text.setFont(*font.getFont());
@@ -152,6 +360,7 @@ namespace tgui
         if (style != m_text.getStyle())
         {
             m_text.setStyle(style);
+            m_verticesOutdated = true;
             recalculateSize();
         }
     }
@@ -182,7 +391,97 @@ namespace tgui
                                          matrix[1], matrix[5], std::floor(matrix[13]),
                                          matrix[3], matrix[7], matrix[15]};
 
-        target.draw(m_text, states);
+        // Underlined and struck through texts are left to SFML, the glyphs of other texts are added to the render batch
+        const sf::Font* font = m_text.getFont();
+        if (!font || (m_text.getStyle() & (sf::Text::Underlined | sf::Text::StrikeThrough)))
+        {
+            RenderBatch::draw(target, m_text, states);
+            return;
+        }
+
+        if (m_verticesOutdated)
+            updateVertices();
+
+        states.texture = &font->getTexture(getCharacterSize());
+        RenderBatch::draw(target, m_vertices.data(), m_vertices.size(), sf::PrimitiveType::Triangles, states);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Text::updateVertices() const
+    {
+        m_verticesOutdated = false;
+        m_vertices.clear();
+
+        const sf::Font* font = m_text.getFont();
+        if (!font)
+            return;
+
+        // The glyphs are placed in the same way as sf::Text does it
+    #if SFML_VERSION_MAJOR > 2 || (SFML_VERSION_MAJOR == 2 && SFML_VERSION_MINOR >= 5)
+        const float italicShear = (m_text.getStyle() & sf::Text::Italic) ? 0.209f : 0.f;
+        const float padding = 1;
+    #else
+        const float italicShear = (m_text.getStyle() & sf::Text::Italic) ? 0.208f : 0.f;
+        const float padding = 0;
+    #endif
+
+        const unsigned int characterSize = getCharacterSize();
+        const bool bold = (m_text.getStyle() & sf::Text::Bold) != 0;
+        const float whitespaceWidth = font->getGlyph(' ', characterSize, bold).advance;
+        const float lineSpacing = font->getLineSpacing(characterSize);
+        const sf::Color color = Color::calcColorOpacity(m_color, m_opacity);
+
+        float x = 0;
+        float y = static_cast<float>(characterSize);
+        sf::Uint32 prevChar = 0;
+        m_vertices.reserve(getString().getSize() * 6);
+        for (const sf::Uint32 curChar : getString())
+        {
+            if (curChar == '\r')
+                continue;
+
+            x += font->getKerning(prevChar, curChar, characterSize);
+            prevChar = curChar;
+
+            if (curChar == ' ')
+            {
+                x += whitespaceWidth;
+                continue;
+            }
+            else if (curChar == '\t')
+            {
+                x += whitespaceWidth * 4;
+                continue;
+            }
+            else if (curChar == '\n')
+            {
+                y += lineSpacing;
+                x = 0;
+                continue;
+            }
+
+            const sf::Glyph& glyph = font->getGlyph(curChar, characterSize, bold);
+
+            const float left = glyph.bounds.left - padding;
+            const float top = glyph.bounds.top - padding;
+            const float right = glyph.bounds.left + glyph.bounds.width + padding;
+            const float bottom = glyph.bounds.top + glyph.bounds.height + padding;
+
+            const float u1 = static_cast<float>(glyph.textureRect.left) - padding;
+            const float v1 = static_cast<float>(glyph.textureRect.top) - padding;
+            const float u2 = static_cast<float>(glyph.textureRect.left + glyph.textureRect.width) + padding;
+            const float v2 = static_cast<float>(glyph.textureRect.top + glyph.textureRect.height) + padding;
+
+            m_vertices.emplace_back(sf::Vector2f{x + left - italicShear * top, y + top}, color, sf::Vector2f{u1, v1});
+            m_vertices.emplace_back(sf::Vector2f{x + right - italicShear * top, y + top}, color, sf::Vector2f{u2, v1});
+            m_vertices.emplace_back(sf::Vector2f{x + left - italicShear * bottom, y + bottom}, color, sf::Vector2f{u1, v2});
+            m_vertices.emplace_back(sf::Vector2f{x + left - italicShear * bottom, y + bottom}, color, sf::Vector2f{u1, v2});
+            m_vertices.emplace_back(sf::Vector2f{x + right - italicShear * top, y + top}, color, sf::Vector2f{u2, v1});
+            m_vertices.emplace_back(sf::Vector2f{x + right - italicShear * bottom, y + bottom}, color, sf::Vector2f{u2, v2});
+
+            x += glyph.advance;
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -317,6 +616,18 @@ namespace tgui
 
         bool bold = (textStyle & sf::Text::Bold) != 0;
 
+        FontLayoutCache* cache = nullptr;
+        LayoutCacheKey key;
+        if (text.getSize() <= maxLayoutCacheTextLength)
+        {
+            cache = &getLayoutCache(font);
+            key = LayoutCacheKey{{text.getData(), text.getSize()}, characterSize, bold, -1.f, false};
+            if (const LayoutCacheEntry* entry = findLayoutCacheEntry(*cache, key))
+                return entry->width;
+        }
+
+        const GlyphAdvanceTable& glyphAdvances = font.getGlyphAdvanceTable(characterSize, bold);
+
         float width = 0.0f;
         std::uint32_t prevChar = 0;
         for (std::size_t i = 0; i < text.getSize(); ++i)
@@ -326,16 +637,19 @@ namespace tgui
             if (curChar == '\n')
                 break;
             else if (curChar == '\t')
-                charWidth = font.getGlyph(' ', characterSize, bold).advance * 4.0f;
+                charWidth = glyphAdvances.getAdvance(' ') * 4.0f;
             else
-                charWidth = font.getGlyph(curChar, characterSize, bold).advance;
+                charWidth = glyphAdvances.getAdvance(curChar);
 
-            const float kerning = font.getKerning(prevChar, curChar, characterSize);
+            const float kerning = glyphAdvances.getKerning(prevChar, curChar);
 
             width = width + charWidth + kerning;
             prevChar = curChar;
         }
 
+        if (cache)
+            addLayoutCacheEntry(*cache, {std::move(key), width, {}});
+
         return width;
     }
 
@@ -349,32 +663,44 @@ namespace tgui
         if (height < 2)
             return 1;
 
-        std::vector<unsigned int> textSizes(static_cast<std::size_t>(height));
-        for (unsigned int i = 0; i < static_cast<unsigned int>(height); ++i)
-            textSizes[i] = i + 1;
+        // Search the smallest size in the range [1, height] for which the line height isn't smaller than the requested height.
+        // The line heights are remembered per font, so that resizing widgets doesn't have to query the font again.
+        FontLayoutCache& cache = getLayoutCache(font);
+        const unsigned int maxSize = static_cast<unsigned int>(height);
+        unsigned int high = 1;
+        unsigned int count = maxSize;
+        while (count > 0)
+        {
+            const unsigned int step = count / 2;
+            if (getCachedLineHeight(cache, font, high + step) < height)
+            {
+                high += step + 1;
+                count -= step + 1;
+            }
+            else
+                count = step;
+        }
 
-        const auto high = std::lower_bound(textSizes.begin(), textSizes.end(), height,
-                                           [&](unsigned int charSize, float h) { return font.getLineSpacing(charSize) + Text::calculateExtraVerticalSpace(font, charSize) < h; });
-        if (high == textSizes.end())
-            return static_cast<unsigned int>(height);
+        if (high > maxSize)
+            return maxSize;
 
-        const float highLineSpacing = font.getLineSpacing(*high);
-        if (highLineSpacing == height)
-            return *high;
+        const float highLineSpacing = getCachedLineSpacing(cache, font, high);
+        if ((highLineSpacing == height) || (high == 1))
+            return high;
 
-        const auto low = high - 1;
-        const float lowLineSpacing = font.getLineSpacing(*low);
+        const unsigned int low = high - 1;
+        const float lowLineSpacing = getCachedLineSpacing(cache, font, low);
 
         if (fit < 0)
-            return *low;
+            return low;
         else if (fit > 0)
-            return *high;
+            return high;
         else
         {
             if (std::abs(height - lowLineSpacing) < std::abs(height - highLineSpacing))
-                return *low;
+                return low;
             else
-                return *high;
+                return high;
         }
     }
 
@@ -387,6 +713,16 @@ namespace tgui
 
         const bool bold = (style & sf::Text::Bold) != 0;
 
+        FontLayoutCache& cache = getLayoutCache(font);
+        const auto cacheIt = cache.extraVerticalSpaces.find({characterSize, bold});
+        if (cacheIt != cache.extraVerticalSpaces.end())
+        {
+            ++layoutCacheHits;
+            return cacheIt->second;
+        }
+
+        ++layoutCacheMisses;
+
         // Calculate the height of the first line (char size = everything above baseline, height + top = part below baseline)
         const float lineHeight = characterSize
                                  + font.getGlyph('g', characterSize, bold).bounds.height
@@ -396,7 +732,9 @@ namespace tgui
         const float lineSpacing = font.getLineSpacing(characterSize);
 
         // Calculate the offset of the text
-        return lineHeight - lineSpacing;
+        const float extraVerticalSpace = lineHeight - lineSpacing;
+        cache.extraVerticalSpaces[{characterSize, bold}] = extraVerticalSpace;
+        return extraVerticalSpace;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -406,84 +744,47 @@ namespace tgui
         if (font == nullptr)
             return "";
 
-        sf::String result;
-        std::size_t index = 0;
-        while (index < text.getSize())
+        FontLayoutCache* cache = nullptr;
+        LayoutCacheKey key;
+        const LayoutCacheEntry* cachedEntry = nullptr;
+        if (text.getSize() <= maxLayoutCacheTextLength)
         {
-            const std::size_t oldIndex = index;
-
-            // Find out how many characters we can get on this line
-            float width = 0;
-            std::uint32_t prevChar = 0;
-            for (std::size_t i = index; i < text.getSize(); ++i)
-            {
-                float charWidth;
-                const std::uint32_t curChar = text[i];
-                if (curChar == '\n')
-                {
-                    index++;
-                    break;
-                }
-                else if (curChar == '\t')
-                    charWidth = font.getGlyph(' ', textSize, bold).advance * 4;
-                else
-                    charWidth = font.getGlyph(curChar, textSize, bold).advance;
+            cache = &getLayoutCache(font);
+            key = LayoutCacheKey{{text.getData(), text.getSize()}, textSize, bold, maxWidth, dropLeadingSpace};
+            cachedEntry = findLayoutCacheEntry(*cache, key);
+        }
 
-                const float kerning = font.getKerning(prevChar, curChar, textSize);
-                if ((maxWidth == 0) || (width + charWidth + kerning <= maxWidth))
-                {
-                    width += kerning + charWidth;
-                    index++;
-                }
-                else
-                    break;
+        const std::vector<std::size_t> lineBreaks = cachedEntry ? cachedEntry->lineBreaks
+                                                                 : findLineBreaks(maxWidth, text, font, textSize, bold, dropLeadingSpace);
 
-                prevChar = curChar;
-            }
+        sf::String result;
+        std::size_t lineStart = 0;
+        for (const std::size_t lineBreak : lineBreaks)
+        {
+            result += text.substring(lineStart, lineBreak - lineStart);
+            result += "\n";
+            lineStart = lineBreak;
+        }
+        result += text.substring(lineStart);
 
-            // Every line contains at least one character
-            if (index == oldIndex)
-                index++;
+        if (cache && !cachedEntry)
+            addLayoutCacheEntry(*cache, {std::move(key), 0, lineBreaks});
 
-            // Implement the word-wrap by removing the last few characters from the line
-            if (text[index-1] != '\n')
-            {
-                const std::size_t indexWithoutWordWrap = index;
-                if ((index < text.getSize()) && (!isWhitespace(text[index])))
-                {
-                    std::size_t wordWrapCorrection = 0;
-                    while ((index > oldIndex) && (!isWhitespace(text[index - 1])))
-                    {
-                        wordWrapCorrection++;
-                        index--;
-                    }
+        return result;
+    }
 
-                    // The word can't be split but there is no other choice, it does not fit on the line
-                    if ((index - oldIndex) <= wordWrapCorrection)
-                        index = indexWithoutWordWrap;
-                }
-            }
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-            // If the next line starts with just a space, then the space need not be visible
-            if (dropLeadingSpace)
-            {
-                if ((index < text.getSize()) && (text[index] == ' '))
-                {
-                    if ((index == 0) || (!isWhitespace(text[index-1])))
-                    {
-                        // But two or more spaces indicate that it is not a normal text and the spaces should not be ignored
-                        if (((index + 1 < text.getSize()) && (!isWhitespace(text[index + 1]))) || (index + 1 == text.getSize()))
-                            index++;
-                    }
-                }
-            }
+    std::size_t Text::getLayoutCacheHits()
+    {
+        return layoutCacheHits;
+    }
 
-            result += text.substring(oldIndex, index - oldIndex);
-            if ((index < text.getSize()) && (text[index-1] != '\n'))
-                result += "\n";
-        }
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        return result;
+    std::size_t Text::getLayoutCacheMisses()
+    {
+        return layoutCacheMisses;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
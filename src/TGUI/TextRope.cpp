@@ -0,0 +1,410 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2019 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include <TGUI/TextRope.hpp>
+#include <algorithm>
+#include <vector>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    namespace
+    {
+        // Characters are inserted in an existing chunk as long as it doesn't become larger than this.
+        // New chunks are only filled half, so that typing in the middle of a long text doesn't immediately split them.
+        const std::size_t maxChunkSize = 512;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    // Node of a treap (a binary tree that is balanced by giving each node a random priority), ordered by text position
+    struct TextRope::Node
+    {
+        Node(std::vector<sf::Uint32>&& characters, unsigned int nodePriority) :
+            chars   (std::move(characters)),
+            size    (chars.size()),
+            priority(nodePriority)
+        {
+        }
+
+        static std::size_t getSize(const std::unique_ptr<Node>& node)
+        {
+            return node ? node->size : 0;
+        }
+
+        void updateSize()
+        {
+            size = getSize(left) + chars.size() + getSize(right);
+        }
+
+        std::unique_ptr<Node> clone() const
+        {
+            auto node = std::make_unique<Node>(std::vector<sf::Uint32>(chars), priority);
+            if (left)
+                node->left = left->clone();
+            if (right)
+                node->right = right->clone();
+
+            node->size = size;
+            return node;
+        }
+
+        // Inserts the text in the chunk that contains the position, but only if the chunk has room for it
+        bool insertInPlace(std::size_t index, const sf::String& text)
+        {
+            const std::size_t leftSize = getSize(left);
+
+            bool inserted;
+            if (index < leftSize)
+                inserted = left->insertInPlace(index, text);
+            else if (index <= leftSize + chars.size())
+            {
+                inserted = (chars.size() + text.getSize() <= maxChunkSize);
+                if (inserted)
+                    chars.insert(chars.begin() + (index - leftSize), text.begin(), text.end());
+            }
+            else
+                inserted = right->insertInPlace(index - leftSize - chars.size(), text);
+
+            if (inserted)
+                size += text.getSize();
+
+            return inserted;
+        }
+
+        // Erases the characters from the chunk that contains them, but only if they are all in the same chunk and if the chunk
+        // doesn't become empty
+        bool eraseInPlace(std::size_t index, std::size_t count)
+        {
+            const std::size_t leftSize = getSize(left);
+
+            bool erased;
+            if (index < leftSize)
+                erased = left->eraseInPlace(index, count);
+            else if (index < leftSize + chars.size())
+            {
+                const std::size_t offset = index - leftSize;
+                erased = (offset + count <= chars.size()) && (count < chars.size());
+                if (erased)
+                    chars.erase(chars.begin() + offset, chars.begin() + offset + count);
+            }
+            else
+                erased = right->eraseInPlace(index - leftSize - chars.size(), count);
+
+            if (erased)
+                size -= count;
+
+            return erased;
+        }
+
+        // Adds count characters, starting at the given position, to the output. The range must lie within this subtree.
+        void copyCharacters(std::size_t index, std::size_t count, std::vector<sf::Uint32>& output) const
+        {
+            const std::size_t leftSize = getSize(left);
+            if (index < leftSize)
+            {
+                const std::size_t countInLeft = std::min(count, leftSize - index);
+                left->copyCharacters(index, countInLeft, output);
+
+                index += countInLeft;
+                count -= countInLeft;
+            }
+
+            if (count == 0)
+                return;
+
+            const std::size_t offset = index - leftSize;
+            if (offset < chars.size())
+            {
+                const std::size_t countInChunk = std::min(count, chars.size() - offset);
+                output.insert(output.end(), chars.begin() + offset, chars.begin() + offset + countInChunk);
+
+                index += countInChunk;
+                count -= countInChunk;
+            }
+
+            if (count > 0)
+                right->copyCharacters(index - leftSize - chars.size(), count, output);
+        }
+
+        std::vector<sf::Uint32> chars;
+        std::unique_ptr<Node> left;
+        std::unique_ptr<Node> right;
+        std::size_t size; // Amount of characters in this node and its children
+        unsigned int priority;
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    TextRope::TextRope() = default;
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    TextRope::TextRope(const sf::String& text)
+    {
+        *this = text;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    TextRope::TextRope(const TextRope& other) :
+        m_root          {other.m_root ? other.m_root->clone() : nullptr},
+        m_random        {other.m_random},
+        m_string        {other.m_string},
+        m_stringOutdated{other.m_stringOutdated}
+    {
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    TextRope::TextRope(TextRope&& other) = default;
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    TextRope::~TextRope() = default;
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    TextRope& TextRope::operator=(const TextRope& other)
+    {
+        if (this != &other)
+        {
+            TextRope temp(other);
+            std::swap(m_root, temp.m_root);
+            std::swap(m_random, temp.m_random);
+            std::swap(m_string, temp.m_string);
+            std::swap(m_stringOutdated, temp.m_stringOutdated);
+        }
+
+        return *this;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    TextRope& TextRope::operator=(TextRope&& other) = default;
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    TextRope& TextRope::operator=(const sf::String& text)
+    {
+        m_root = createTree(text, 0, text.getSize());
+
+        // The contiguous string is already available, so keep it for when toString is called
+        m_string = text;
+        m_stringOutdated = false;
+        return *this;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t TextRope::getSize() const
+    {
+        return Node::getSize(m_root);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool TextRope::isEmpty() const
+    {
+        return !m_root;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    sf::Uint32 TextRope::operator[](std::size_t index) const
+    {
+        const Node* node = m_root.get();
+        while (true)
+        {
+            const std::size_t leftSize = Node::getSize(node->left);
+            if (index < leftSize)
+                node = node->left.get();
+            else if (index < leftSize + node->chars.size())
+                return node->chars[index - leftSize];
+            else
+            {
+                index -= leftSize + node->chars.size();
+                node = node->right.get();
+            }
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextRope::insert(std::size_t index, const sf::String& text)
+    {
+        if (text.isEmpty())
+            return;
+
+        m_stringOutdated = true;
+        if (m_root && m_root->insertInPlace(index, text))
+            return;
+
+        std::unique_ptr<Node> left;
+        std::unique_ptr<Node> right;
+        split(std::move(m_root), index, left, right);
+        m_root = merge(merge(std::move(left), createTree(text, 0, text.getSize())), std::move(right));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextRope::erase(std::size_t index, std::size_t count)
+    {
+        if (index >= getSize())
+            return;
+
+        count = std::min(count, getSize() - index);
+        if (count == 0)
+            return;
+
+        m_stringOutdated = true;
+        if (m_root->eraseInPlace(index, count))
+            return;
+
+        std::unique_ptr<Node> left;
+        std::unique_ptr<Node> middle;
+        std::unique_ptr<Node> right;
+        split(std::move(m_root), index, left, right);
+        split(std::move(right), count, middle, right);
+        m_root = merge(std::move(left), std::move(right));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextRope::clear()
+    {
+        m_root = nullptr;
+        m_string.clear();
+        m_stringOutdated = false;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    sf::String TextRope::substring(std::size_t index, std::size_t count) const
+    {
+        if (index >= getSize())
+            return "";
+
+        count = std::min(count, getSize() - index);
+
+        std::vector<sf::Uint32> characters;
+        characters.reserve(count);
+        m_root->copyCharacters(index, count, characters);
+        return sf::String::fromUtf32(characters.begin(), characters.end());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const sf::String& TextRope::toString() const
+    {
+        if (m_stringOutdated)
+        {
+            m_string = substring(0);
+            m_stringOutdated = false;
+        }
+
+        return m_string;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextRope::split(std::unique_ptr<Node> node, std::size_t index, std::unique_ptr<Node>& left, std::unique_ptr<Node>& right)
+    {
+        if (!node)
+        {
+            left = nullptr;
+            right = nullptr;
+            return;
+        }
+
+        const std::size_t leftSize = Node::getSize(node->left);
+        if (index <= leftSize)
+        {
+            split(std::move(node->left), index, left, node->left);
+            node->updateSize();
+            right = std::move(node);
+        }
+        else if (index >= leftSize + node->chars.size())
+        {
+            split(std::move(node->right), index - leftSize - node->chars.size(), node->right, right);
+            node->updateSize();
+            left = std::move(node);
+        }
+        else // The position lies inside the chunk of this node, so the chunk has to be split in two
+        {
+            const auto splitPos = node->chars.begin() + (index - leftSize);
+            auto tail = std::make_unique<Node>(std::vector<sf::Uint32>(splitPos, node->chars.end()), static_cast<unsigned int>(m_random()));
+            node->chars.erase(splitPos, node->chars.end());
+
+            right = merge(std::move(tail), std::move(node->right));
+            node->updateSize();
+            left = std::move(node);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::unique_ptr<TextRope::Node> TextRope::merge(std::unique_ptr<Node> left, std::unique_ptr<Node> right)
+    {
+        if (!left)
+            return right;
+        if (!right)
+            return left;
+
+        if (left->priority > right->priority)
+        {
+            left->right = merge(std::move(left->right), std::move(right));
+            left->updateSize();
+            return left;
+        }
+        else
+        {
+            right->left = merge(std::move(left), std::move(right->left));
+            right->updateSize();
+            return right;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::unique_ptr<TextRope::Node> TextRope::createTree(const sf::String& text, std::size_t index, std::size_t count)
+    {
+        std::unique_ptr<Node> tree;
+        const auto end = text.begin() + index + count;
+        for (auto it = text.begin() + index; it != end;)
+        {
+            const auto chunkEnd = it + std::min<std::ptrdiff_t>(end - it, maxChunkSize / 2);
+            tree = merge(std::move(tree), std::make_unique<Node>(std::vector<sf::Uint32>(it, chunkEnd), static_cast<unsigned int>(m_random())));
+            it = chunkEnd;
+        }
+
+        return tree;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -227,6 +227,8 @@ namespace tgui
 
         if (m_data->svgImage)
             return m_data->svgImage->getSize();
+        else if (m_data->atlasTexture)
+            return {static_cast<float>(m_data->atlasRect.width), static_cast<float>(m_data->atlasRect.height)};
         else
             return {sf::Vector2f{m_data->texture.getSize()}};
     }
@@ -236,7 +238,12 @@ namespace tgui
     void Texture::setSmooth(bool smooth)
     {
         if (m_data)
-            m_data->texture.setSmooth(smooth);
+        {
+            if (m_data->atlasTexture)
+                m_data->atlasTexture->setSmooth(smooth);
+            else
+                m_data->texture.setSmooth(smooth);
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -244,7 +251,7 @@ namespace tgui
     bool Texture::isSmooth() const
     {
         if (m_data)
-            return m_data->texture.isSmooth();
+            return m_data->atlasTexture ? m_data->atlasTexture->isSmooth() : m_data->texture.isSmooth();
         else
             return false;
     }
@@ -293,6 +300,13 @@ namespace tgui
 
     sf::IntRect Texture::getMiddleRect() const
     {
+        // The size of an image that was still being loaded asynchronously when setting the texture data wasn't known yet
+        if ((m_middleRect == sf::IntRect{}) && m_data && !m_data->loading)
+        {
+            const Vector2f imageSize = getImageSize();
+            return {0, 0, static_cast<int>(imageSize.x), static_cast<int>(imageSize.y)};
+        }
+
         return m_middleRect;
     }
 
@@ -300,12 +314,16 @@ namespace tgui
 
     bool Texture::isTransparentPixel(sf::Vector2u pixel) const
     {
-        if (!m_data || !m_data->image)
+        if (!m_data || (!m_data->image && !m_data->alphaMask))
             return false;
 
-        assert(pixel.x < m_data->texture.getSize().x && pixel.y < m_data->texture.getSize().y);
+        assert(pixel.x < getImageSize().x && pixel.y < getImageSize().y);
 
-        if (m_data->image->getPixel(pixel.x + m_data->rect.left, pixel.y + m_data->rect.top).a == 0)
+        const sf::IntRect& rect = m_data->atlasTexture ? m_data->atlasRect : m_data->rect;
+        if (!m_data->image)
+            return (*m_data->alphaMask)[(pixel.y + rect.top) * m_data->imageSize.x + pixel.x + rect.left];
+
+        if (m_data->image->getPixel(pixel.x + rect.left, pixel.y + rect.top).a == 0)
             return true;
         else
             return false;
@@ -384,10 +402,8 @@ namespace tgui
 
         if (middleRect == sf::IntRect{})
         {
-            if (m_data->svgImage)
-                m_middleRect = {0, 0, static_cast<int>(m_data->svgImage->getSize().x), static_cast<int>(m_data->svgImage->getSize().y)};
-            else
-                m_middleRect = {0, 0, static_cast<int>(m_data->texture.getSize().x), static_cast<int>(m_data->texture.getSize().y)};
+            const Vector2f imageSize = getImageSize();
+            m_middleRect = {0, 0, static_cast<int>(imageSize.x), static_cast<int>(imageSize.y)};
         }
         else
             m_middleRect = middleRect;
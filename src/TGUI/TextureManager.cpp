@@ -26,12 +26,21 @@
 #include <TGUI/Texture.hpp>
 #include <TGUI/TextureManager.hpp>
 #include <TGUI/Exception.hpp>
+#include <TGUI/WorkerPool.hpp>
+
+#include <algorithm>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
 {
     std::map<sf::String, std::list<TextureDataHolder>> TextureManager::m_imageMap;
+    bool TextureManager::m_textureAtlasEnabled = false;
+    bool TextureManager::m_keepImagesInMemory = true;
+    bool TextureManager::m_asyncLoadingEnabled = false;
+    Color TextureManager::m_loadingColor{200, 200, 200};
+    unsigned int TextureManager::m_loadingImageCount = 0;
+    std::vector<std::function<void()>> TextureManager::m_loadingFinishedCallbacks;
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -83,25 +92,41 @@ namespace tgui
             if (data->svgImage->isSet())
                 return data;
         }
+        else if (m_textureAtlasEnabled) // Not an svg, but the texture is shared with other parts of the image
+        {
+            if (loadAtlasPart(texture, filename, imageIt->second, *data))
+            {
+                releaseImage(*data, imageIt->second);
+                return data;
+            }
+        }
+        else if (m_asyncLoadingEnabled) // Not an svg, but the image is decoded on a worker thread
+        {
+            data->loading = true;
+
+            // When another part of the same image is already being loaded then it will finish this part as well
+            const bool alreadyLoading = std::any_of(imageIt->second.begin(), std::prev(imageIt->second.end()),
+                [](const TextureDataHolder& dataHolder){ return dataHolder.data->loading; });
+            if (!alreadyLoading)
+            {
+                ++m_loadingImageCount;
+
+                auto loadedImage = std::make_shared<std::shared_ptr<sf::Image>>();
+                const Texture::ImageLoaderFunc imageLoader = texture.getImageLoader();
+                WorkerPool::addTask(
+                    [imageLoader,filename,loadedImage]{ *loadedImage = imageLoader(filename); },
+                    [filename,loadedImage]{ finishAsyncLoad(filename, *loadedImage); });
+            }
+
+            return data;
+        }
         else // Not an svg
         {
             data->image = texture.getImageLoader()(filename);
-            if (data->image != nullptr)
+            if ((data->image != nullptr) && loadTextureFromImage(*data))
             {
-                // Create a texture from the image
-                bool loadFromImageSuccess;
-                if (partRect == sf::IntRect{})
-                    loadFromImageSuccess = data->texture.loadFromImage(*data->image);
-                else
-                {
-                    if ((partRect.left < static_cast<int>(data->image->getSize().x)) && (partRect.top < static_cast<int>(data->image->getSize().y)))
-                        loadFromImageSuccess = data->texture.loadFromImage(*data->image, partRect);
-                    else
-                        loadFromImageSuccess = false;
-                }
-
-                if (loadFromImageSuccess)
-                    return data;
+                releaseImage(*data, imageIt->second);
+                return data;
             }
         }
 
@@ -165,6 +190,249 @@ namespace tgui
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextureManager::setTextureAtlasEnabled(bool enabled)
+    {
+        m_textureAtlasEnabled = enabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool TextureManager::isTextureAtlasEnabled()
+    {
+        return m_textureAtlasEnabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextureManager::setKeepImagesInMemory(bool keep)
+    {
+        m_keepImagesInMemory = keep;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool TextureManager::getKeepImagesInMemory()
+    {
+        return m_keepImagesInMemory;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextureManager::setAsyncLoadingEnabled(bool enabled)
+    {
+        m_asyncLoadingEnabled = enabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool TextureManager::isAsyncLoadingEnabled()
+    {
+        return m_asyncLoadingEnabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextureManager::setLoadingColor(const Color& color)
+    {
+        m_loadingColor = color;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const Color& TextureManager::getLoadingColor()
+    {
+        return m_loadingColor;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    unsigned int TextureManager::getLoadingImageCount()
+    {
+        return m_loadingImageCount;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextureManager::addLoadingFinishedCallback(std::function<void()> func)
+    {
+        if (m_loadingImageCount == 0)
+            func();
+        else
+            m_loadingFinishedCallbacks.push_back(std::move(func));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextureManager::waitUntilLoaded()
+    {
+        while (m_loadingImageCount > 0)
+        {
+            WorkerPool::waitForTasks();
+            WorkerPool::processFinishedTasks();
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool TextureManager::loadTextureFromImage(TextureData& data)
+    {
+        const sf::Vector2u imageSize = data.image->getSize();
+
+        bool loadFromImageSuccess;
+        if (data.rect == sf::IntRect{})
+            loadFromImageSuccess = data.texture.loadFromImage(*data.image);
+        else
+        {
+            if ((data.rect.left < static_cast<int>(imageSize.x)) && (data.rect.top < static_cast<int>(imageSize.y)))
+                loadFromImageSuccess = data.texture.loadFromImage(*data.image, data.rect);
+            else
+                loadFromImageSuccess = false;
+        }
+
+        if (loadFromImageSuccess)
+            data.imageSize = imageSize;
+
+        return loadFromImageSuccess;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextureManager::finishAsyncLoad(const sf::String& filename, const std::shared_ptr<sf::Image>& image)
+    {
+        // The textures may have been removed while the image was being decoded
+        std::vector<std::shared_ptr<TextureData>> finishedData;
+        auto imageIt = m_imageMap.find(filename);
+        if (imageIt != m_imageMap.end())
+        {
+            for (auto& dataHolder : imageIt->second)
+            {
+                TextureData& data = *dataHolder.data;
+                if (!data.loading)
+                    continue;
+
+                data.loading = false;
+                finishedData.push_back(dataHolder.data);
+                if (!image)
+                {
+                    TGUI_PRINT_WARNING("Failed to load '" << filename.toAnsiString() << "'");
+                    continue;
+                }
+
+                data.image = std::make_unique<sf::Image>(*image);
+                if (loadTextureFromImage(data))
+                    releaseImage(data, imageIt->second);
+                else
+                {
+                    TGUI_PRINT_WARNING("Failed to create texture for '" << filename.toAnsiString() << "'");
+                    data.image = nullptr;
+                }
+            }
+        }
+
+        // The observers are only called once all textures of the image exist. An observer may destroy another one, which
+        // removes it from the map, so the map is checked again after each call.
+        for (const auto& data : finishedData)
+        {
+            while (!data->loadingFinishedObservers.empty())
+            {
+                const auto observer = data->loadingFinishedObservers.begin()->second;
+                data->loadingFinishedObservers.erase(data->loadingFinishedObservers.begin());
+                observer();
+            }
+        }
+
+        if (--m_loadingImageCount == 0)
+        {
+            // The callbacks may add new callbacks or start loading new images
+            std::vector<std::function<void()>> callbacks;
+            callbacks.swap(m_loadingFinishedCallbacks);
+            for (auto& callback : callbacks)
+                callback();
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool TextureManager::loadAtlasPart(Texture& texture, const sf::String& filename, const std::list<TextureDataHolder>& loadedParts, TextureData& data)
+    {
+        // Reuse the texture of another part of the same image if there is one
+        for (const auto& dataHolder : loadedParts)
+        {
+            if (dataHolder.data->atlasTexture)
+            {
+                data.atlasTexture = dataHolder.data->atlasTexture;
+                data.alphaMask = dataHolder.data->alphaMask;
+                data.imageSize = dataHolder.data->imageSize;
+                if (dataHolder.data->image)
+                    data.image = std::make_unique<sf::Image>(*dataHolder.data->image);
+                break;
+            }
+        }
+
+        if (!data.atlasTexture)
+        {
+            data.image = texture.getImageLoader()(filename);
+            if (data.image == nullptr)
+                return false;
+
+            data.imageSize = data.image->getSize();
+
+            data.atlasTexture = std::make_shared<sf::Texture>();
+            if (!data.atlasTexture->loadFromImage(*data.image))
+            {
+                data.atlasTexture = nullptr;
+                return false;
+            }
+        }
+
+        // Limit the part to the size of the image, in the same way as sf::Texture::loadFromImage does it
+        const sf::Vector2i imageSize{data.atlasTexture->getSize()};
+        sf::IntRect rect = data.rect;
+        if ((rect.width == 0) || (rect.height == 0))
+            rect = {0, 0, imageSize.x, imageSize.y};
+
+        rect.left = std::max(rect.left, 0);
+        rect.top = std::max(rect.top, 0);
+        rect.width = std::min(rect.width, imageSize.x - rect.left);
+        rect.height = std::min(rect.height, imageSize.y - rect.top);
+        if ((rect.width <= 0) || (rect.height <= 0))
+            return false;
+
+        data.atlasRect = rect;
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextureManager::releaseImage(TextureData& data, const std::list<TextureDataHolder>& loadedParts)
+    {
+        if (m_keepImagesInMemory || !data.image)
+            return;
+
+        // Other parts of the same image can share the mask
+        for (const auto& dataHolder : loadedParts)
+        {
+            if (dataHolder.data->alphaMask)
+            {
+                data.alphaMask = dataHolder.data->alphaMask;
+                data.image = nullptr;
+                return;
+            }
+        }
+
+        const std::size_t pixelCount = static_cast<std::size_t>(data.imageSize.x) * data.imageSize.y;
+        const sf::Uint8* pixels = data.image->getPixelsPtr();
+
+        auto alphaMask = std::make_shared<std::vector<bool>>(pixelCount);
+        for (std::size_t i = 0; i < pixelCount; ++i)
+            (*alphaMask)[i] = (pixels[4*i + 3] == 0);
+
+        data.alphaMask = std::move(alphaMask);
+        data.image = nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
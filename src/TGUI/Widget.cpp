@@ -29,7 +29,8 @@
 #include <TGUI/Vector2f.hpp>
 #include <TGUI/Loading/WidgetFactory.hpp>
 #include <SFML/System/Err.hpp>
-#include <SFML/Graphics/RectangleShape.hpp>
+
+#include <algorithm>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -125,11 +126,13 @@ namespace tgui
         if (m_renderer)
             m_renderer->unsubscribe(this);
 
+        unsubscribeFromLoadingTextures();
+
         for (auto& layout : m_boundPositionLayouts)
-            layout->unbindWidget();
+            layout->unbindWidget(this);
 
         for (auto& layout : m_boundSizeLayouts)
-            layout->unbindWidget();
+            layout->unbindWidget(this);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -147,11 +150,13 @@ namespace tgui
         m_parent                       {nullptr},
         m_draggableWidget              {other.m_draggableWidget},
         m_containerWidget              {other.m_containerWidget},
+        m_renderBatchType              {other.m_renderBatchType},
         m_toolTip                      {other.m_toolTip ? other.m_toolTip->clone() : nullptr},
         m_renderer                     {other.m_renderer},
         m_showAnimations               {other.m_showAnimations},
         m_fontCached                   {other.m_fontCached},
-        m_opacityCached                {other.m_opacityCached}
+        m_opacityCached                {other.m_opacityCached},
+        m_loadingTextures              {other.m_loadingTextures}
     {
         m_position.x.connectWidget(this, true, [this]{ setPosition(getPositionLayout()); });
         m_position.y.connectWidget(this, false, [this]{ setPosition(getPositionLayout()); });
@@ -159,6 +164,7 @@ namespace tgui
         m_size.y.connectWidget(this, false, [this]{ setSize(getSizeLayout()); });
 
         m_renderer->subscribe(this, m_rendererChangedCallback);
+        subscribeToLoadingTextures();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -186,11 +192,13 @@ namespace tgui
         m_animationTimeElapsed         {std::move(other.m_animationTimeElapsed)},
         m_draggableWidget              {std::move(other.m_draggableWidget)},
         m_containerWidget              {std::move(other.m_containerWidget)},
+        m_renderBatchType              {std::move(other.m_renderBatchType)},
         m_toolTip                      {std::move(other.m_toolTip)},
         m_renderer                     {other.m_renderer},
         m_showAnimations               {std::move(other.m_showAnimations)},
         m_fontCached                   {std::move(other.m_fontCached)},
-        m_opacityCached                {std::move(other.m_opacityCached)}
+        m_opacityCached                {std::move(other.m_opacityCached)},
+        m_loadingTextures              {other.m_loadingTextures}
     {
         m_position.x.connectWidget(this, true, [this]{ setPosition(getPositionLayout()); });
         m_position.y.connectWidget(this, false, [this]{ setPosition(getPositionLayout()); });
@@ -200,6 +208,9 @@ namespace tgui
         other.m_renderer->unsubscribe(&other);
         m_renderer->subscribe(this, m_rendererChangedCallback);
 
+        other.unsubscribeFromLoadingTextures();
+        subscribeToLoadingTextures();
+
         other.m_renderer = nullptr;
     }
 
@@ -210,6 +221,7 @@ namespace tgui
         if (this != &other)
         {
             m_renderer->unsubscribe(this);
+            unsubscribeFromLoadingTextures();
 
             SignalWidgetBase::operator=(other);
             enable_shared_from_this::operator=(other);
@@ -235,11 +247,13 @@ namespace tgui
             m_animationTimeElapsed = {};
             m_draggableWidget      = other.m_draggableWidget;
             m_containerWidget      = other.m_containerWidget;
+            m_renderBatchType      = other.m_renderBatchType;
             m_toolTip              = other.m_toolTip ? other.m_toolTip->clone() : nullptr;
             m_renderer             = other.m_renderer;
             m_showAnimations       = {};
             m_fontCached           = other.m_fontCached;
             m_opacityCached        = other.m_opacityCached;
+            m_loadingTextures      = other.m_loadingTextures;
 
             m_position.x.connectWidget(this, true, [this]{ setPosition(getPositionLayout()); });
             m_position.y.connectWidget(this, false, [this]{ setPosition(getPositionLayout()); });
@@ -247,6 +261,7 @@ namespace tgui
             m_size.y.connectWidget(this, false, [this]{ setSize(getSizeLayout()); });
 
             m_renderer->subscribe(this, m_rendererChangedCallback);
+            subscribeToLoadingTextures();
         }
 
         return *this;
@@ -260,6 +275,8 @@ namespace tgui
         {
             m_renderer->unsubscribe(this);
             other.m_renderer->unsubscribe(&other);
+            unsubscribeFromLoadingTextures();
+            other.unsubscribeFromLoadingTextures();
 
             SignalWidgetBase::operator=(std::move(other));
             enable_shared_from_this::operator=(std::move(other));
@@ -284,11 +301,13 @@ namespace tgui
             m_animationTimeElapsed = std::move(other.m_animationTimeElapsed);
             m_draggableWidget      = std::move(other.m_draggableWidget);
             m_containerWidget      = std::move(other.m_containerWidget);
+            m_renderBatchType      = std::move(other.m_renderBatchType);
             m_toolTip              = std::move(other.m_toolTip);
             m_renderer             = std::move(other.m_renderer);
             m_showAnimations       = std::move(other.m_showAnimations);
             m_fontCached           = std::move(other.m_fontCached);
             m_opacityCached        = std::move(other.m_opacityCached);
+            m_loadingTextures      = std::move(other.m_loadingTextures);
 
             m_position.x.connectWidget(this, true, [this]{ setPosition(getPositionLayout()); });
             m_position.y.connectWidget(this, false, [this]{ setPosition(getPositionLayout()); });
@@ -296,6 +315,7 @@ namespace tgui
             m_size.y.connectWidget(this, false, [this]{ setSize(getSizeLayout()); });
 
             m_renderer->subscribe(this, m_rendererChangedCallback);
+            subscribeToLoadingTextures();
 
             other.m_renderer = nullptr;
         }
@@ -319,6 +339,8 @@ namespace tgui
         rendererData->shared = true;
 
         // Tell the widget about all the updated properties, both new ones and old ones that were now reset to their default value
+        std::vector<RendererProperty> changedProperties;
+        changedProperties.reserve(oldData->propertyValuePairs.size() + rendererData->propertyValuePairs.size());
         auto oldIt = oldData->propertyValuePairs.begin();
         auto newIt = rendererData->propertyValuePairs.begin();
         while (oldIt != oldData->propertyValuePairs.end() && newIt != rendererData->propertyValuePairs.end())
@@ -326,13 +348,13 @@ namespace tgui
             if (oldIt->first < newIt->first)
             {
                 // Update values that no longer exist in the new renderer and are now reset to the default value
-                rendererChanged(oldIt->first);
+                changedProperties.push_back(oldIt->first);
                 ++oldIt;
             }
             else
             {
                 // Update changed and new properties
-                rendererChanged(newIt->first);
+                changedProperties.push_back(newIt->first);
 
                 if (newIt->first < oldIt->first)
                     ++newIt;
@@ -345,14 +367,16 @@ namespace tgui
         }
         while (oldIt != oldData->propertyValuePairs.end())
         {
-            rendererChanged(oldIt->first);
+            changedProperties.push_back(oldIt->first);
             ++oldIt;
         }
         while (newIt != rendererData->propertyValuePairs.end())
         {
-            rendererChanged(newIt->first);
+            changedProperties.push_back(newIt->first);
             ++newIt;
         }
+
+        rendererChangedCallback(changedProperties);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -412,10 +436,14 @@ namespace tgui
         if (getPosition() != m_prevPosition)
         {
             m_prevPosition = getPosition();
+            invalidate();
             onPositionChange.emit(this, getPosition());
 
+            if (m_parent)
+                m_parent->childWidgetBoundsChanged(this);
+
             for (auto& layout : m_boundPositionLayouts)
-                layout->recalculateValue();
+                layout->boundWidgetChanged();
         }
     }
 
@@ -430,11 +458,16 @@ namespace tgui
         if (getSize() != m_prevSize)
         {
             m_prevSize = getSize();
+            invalidate();
             onSizeChange.emit(this, getSize());
 
             for (auto& layout : m_boundSizeLayouts)
-                layout->recalculateValue();
+                layout->boundWidgetChanged();
         }
+
+        // The full size or widget offset may have changed even when the size itself didn't
+        if (m_parent)
+            m_parent->childWidgetBoundsChanged(this);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -596,6 +629,9 @@ namespace tgui
 
     void Widget::setVisible(bool visible)
     {
+        if (m_visible != visible)
+            invalidate();
+
         m_visible = visible;
 
         // If the widget is hiden while still focused then it must be unfocused
@@ -607,6 +643,9 @@ namespace tgui
 
     void Widget::setEnabled(bool enabled)
     {
+        if (m_enabled != enabled)
+            invalidate();
+
         m_enabled = enabled;
 
         if (!enabled)
@@ -618,7 +657,7 @@ namespace tgui
 
         // Refresh widget opacity if there is a different value set for enabled and disabled widgets
         if (getSharedRenderer()->getOpacityDisabled() != -1)
-            rendererChanged("opacitydisabled");
+            rendererChanged(RendererProperty::OpacityDisabled);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -628,6 +667,8 @@ namespace tgui
         if (m_focused == focused)
             return;
 
+        invalidate();
+
         if (focused)
         {
             if (canGainFocus())
@@ -675,7 +716,8 @@ namespace tgui
     void Widget::setInheritedFont(const Font& font)
     {
         m_inheritedFont = font;
-        rendererChanged("font");
+        rendererChanged(RendererProperty::Font);
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -690,7 +732,8 @@ namespace tgui
     void Widget::setInheritedOpacity(float opacity)
     {
         m_inheritedOpacity = opacity;
-        rendererChanged("opacity");
+        rendererChanged(RendererProperty::Opacity);
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -730,10 +773,27 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Widget::invalidate()
+    {
+        if (m_parent)
+            m_parent->invalidate();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Widget::setParent(Container* parent)
     {
+        // Both the old and the new parent have to be redrawn
+        invalidate();
+        if (m_parent)
+            m_parent->invalidateSpatialIndex();
+
         m_parent = parent;
 
+        invalidate();
+        if (m_parent)
+            m_parent->invalidateSpatialIndex();
+
         // Give the layouts another chance to find widgets to which it refers
         m_position.x.connectWidget(this, true, [this]{ setPosition(getPositionLayout()); });
         m_position.y.connectWidget(this, false, [this]{ setPosition(getPositionLayout()); });
@@ -747,6 +807,9 @@ namespace tgui
     {
         m_animationTimeElapsed += elapsedTime;
 
+        if (!m_showAnimations.empty())
+            invalidate();
+
         for (unsigned int i = 0; i < m_showAnimations.size();)
         {
             if (m_showAnimations[i]->update(elapsedTime))
@@ -758,6 +821,13 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    FloatRect Widget::getDrawBounds() const
+    {
+        return {getPosition() + getWidgetOffset(), getFullSize()};
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Widget::leftMousePressed(Vector2f)
     {
     }
@@ -862,38 +932,41 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    Signal& Widget::getSignal(std::string signalName)
+    Signal* Widget::getSignal(std::uint64_t signalNameHash)
     {
-        if (signalName == toLower(onPositionChange.getName()))
-            return onPositionChange;
-        else if (signalName == toLower(onSizeChange.getName()))
-            return onSizeChange;
-        else if (signalName == toLower(onFocus.getName()))
-            return onFocus;
-        else if (signalName == toLower(onUnfocus.getName()))
-            return onUnfocus;
-        else if (signalName == toLower(onMouseEnter.getName()))
-            return onMouseEnter;
-        else if (signalName == toLower(onMouseLeave.getName()))
-            return onMouseLeave;
-        else if (signalName == toLower(onAnimationFinished.getName()))
-            return onAnimationFinished;
-
-        throw Exception{"No signal exists with name '" + std::move(signalName) + "'."};
+        switch (signalNameHash)
+        {
+            case hashSignalName("PositionChanged"):
+                return &onPositionChange;
+            case hashSignalName("SizeChanged"):
+                return &onSizeChange;
+            case hashSignalName("Focused"):
+                return &onFocus;
+            case hashSignalName("Unfocused"):
+                return &onUnfocus;
+            case hashSignalName("MouseEntered"):
+                return &onMouseEnter;
+            case hashSignalName("MouseLeft"):
+                return &onMouseLeave;
+            case hashSignalName("AnimationFinished"):
+                return &onAnimationFinished;
+            default:
+                return nullptr;
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Widget::rendererChanged(const std::string& property)
+    void Widget::rendererChanged(RendererProperty property)
     {
-        if ((property == "opacity") || (property == "opacitydisabled"))
+        if ((property == RendererProperty::Opacity) || (property == RendererProperty::OpacityDisabled))
         {
             if (!m_enabled && (getSharedRenderer()->getOpacityDisabled() != -1))
                 m_opacityCached = getSharedRenderer()->getOpacityDisabled() * m_inheritedOpacity;
             else
                 m_opacityCached = getSharedRenderer()->getOpacity() * m_inheritedOpacity;
         }
-        else if (property == "font")
+        else if (property == RendererProperty::Font)
         {
             if (getSharedRenderer()->getFont())
                 m_fontCached = getSharedRenderer()->getFont();
@@ -902,12 +975,12 @@ namespace tgui
             else
                 m_fontCached = getGlobalFont();
         }
-        else if (property == "transparenttexture")
+        else if (property == RendererProperty::TransparentTexture)
         {
             m_transparentTextureCached = getSharedRenderer()->getTransparentTexture();
         }
         else
-            throw Exception{"Could not set property '" + property + "', widget of type '" + getWidgetType() + "' does not has this property."};
+            throw Exception{"Could not set property '" + getRendererPropertyName(property) + "', widget of type '" + getWidgetType() + "' does not has this property."};
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1039,9 +1112,39 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Widget::rendererChangedCallback(const std::string& property)
+    void Widget::requestSizeUpdate()
     {
-        rendererChanged(property);
+        if (m_processingRendererChanges)
+            m_sizeUpdateRequested = true;
+        else
+            setSize(m_size);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Widget::rendererChangedCallback(const std::vector<RendererProperty>& properties)
+    {
+        m_processingRendererChanges = true;
+        try
+        {
+            for (const auto property : properties)
+                rendererChanged(property);
+        }
+        catch (...)
+        {
+            m_processingRendererChanges = false;
+            m_sizeUpdateRequested = false;
+            throw;
+        }
+        m_processingRendererChanges = false;
+
+        if (m_sizeUpdateRequested)
+        {
+            m_sizeUpdateRequested = false;
+            setSize(m_size);
+        }
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1051,14 +1154,18 @@ namespace tgui
                                     Vector2f size,
                                     Color color) const
     {
-        sf::RectangleShape shape{size};
-
         if (m_opacityCached < 1)
-            shape.setFillColor(Color::calcColorOpacity(color, m_opacityCached));
-        else
-            shape.setFillColor(color);
+            color = Color::calcColorOpacity(color, m_opacityCached);
+
+        // The vertices are added to the render batch, so that the rectangles of all widgets can be drawn at once
+        const sf::Vertex vertices[] = {
+            {{0, 0}, color},
+            {{0, size.y}, color},
+            {{size.x, 0}, color},
+            {{size.x, size.y}, color}
+        };
 
-        target.draw(shape, states);
+        RenderBatch::draw(target, vertices, 4, sf::PrimitiveType::TrianglesStrip, states);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1074,10 +1181,14 @@ namespace tgui
         // If size is too small then draw entire size as border
         if ((size.x <= borders.getLeft() + borders.getRight()) || (size.y <= borders.getTop() + borders.getBottom()))
         {
-            sf::RectangleShape border;
-            border.setFillColor(color);
-            border.setSize({size.x, size.y});
-            target.draw(border, states);
+            const sf::Vertex vertices[] = {
+                {{0, 0}, color},
+                {{0, size.y}, color},
+                {{size.x, 0}, color},
+                {{size.x, size.y}, color}
+            };
+
+            RenderBatch::draw(target, vertices, 4, sf::PrimitiveType::TrianglesStrip, states);
         }
         else // Draw borders in the normal way
         {
@@ -1091,7 +1202,7 @@ namespace tgui
             // |              | //
             // 2--------------4 //
             //////////////////////
-            const std::vector<sf::Vertex> vertices = {
+            const sf::Vertex vertices[] = {
                 {{0, 0}, color},
                 {{borders.getLeft(), 0}, color},
                 {{0, size.y}, color},
@@ -1104,7 +1215,56 @@ namespace tgui
                 {{borders.getLeft(), borders.getTop()}, color}
             };
 
-            target.draw(vertices.data(), vertices.size(), sf::PrimitiveType::TrianglesStrip, states);
+            RenderBatch::draw(target, vertices, 10, sf::PrimitiveType::TrianglesStrip, states);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Widget::callWhenTextureLoaded(const Texture& texture)
+    {
+        const std::shared_ptr<TextureData>& data = texture.getData();
+        if (!data || !data->loading)
+            return;
+
+        // Forget about textures that have finished loading or no longer exist, and about an earlier call with the same texture
+        m_loadingTextures.erase(std::remove_if(m_loadingTextures.begin(), m_loadingTextures.end(),
+            [&data](const std::weak_ptr<TextureData>& loadingData){
+                const auto lockedData = loadingData.lock();
+                return !lockedData || !lockedData->loading || (lockedData == data);
+            }), m_loadingTextures.end());
+
+        m_loadingTextures.push_back(data);
+        data->loadingFinishedObservers[this] = [this]{ textureLoaded(); invalidate(); };
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Widget::textureLoaded()
+    {
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Widget::subscribeToLoadingTextures()
+    {
+        for (const auto& loadingData : m_loadingTextures)
+        {
+            const auto data = loadingData.lock();
+            if (data && data->loading)
+                data->loadingFinishedObservers[this] = [this]{ textureLoaded(); invalidate(); };
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Widget::unsubscribeFromLoadingTextures()
+    {
+        for (const auto& loadingData : m_loadingTextures)
+        {
+            const auto data = loadingData.lock();
+            if (data)
+                data->loadingFinishedObservers.erase(this);
         }
     }
 
@@ -35,6 +35,7 @@ namespace tgui
     BitmapButton::BitmapButton()
     {
         m_type = "BitmapButton";
+        m_renderBatchType = &typeid(BitmapButton);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -87,6 +88,11 @@ namespace tgui
         m_glyphTexture = image;
         m_glyphSprite.setTexture(m_glyphTexture);
         updateSize();
+
+        // The size of an image that is loaded asynchronously is only known once it has been loaded
+        callWhenTextureLoaded(m_glyphTexture);
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -102,6 +108,8 @@ namespace tgui
     {
         m_relativeGlyphHeight = relativeHeight;
         updateSize();
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -239,12 +247,22 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void BitmapButton::textureLoaded()
+    {
+        updateSize();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void BitmapButton::recalculateGlyphSize()
     {
         if (!m_glyphSprite.isSet())
             return;
 
-        if (m_relativeGlyphHeight == 0)
+        // The image has no size while it is still being loaded asynchronously
+        if (m_glyphTexture.getImageSize().y == 0)
+            m_glyphSprite.setSize({0, 0});
+        else if (m_relativeGlyphHeight == 0)
             m_glyphSprite.setSize(m_glyphTexture.getImageSize());
         else
             m_glyphSprite.setSize({m_relativeGlyphHeight * getInnerSize().y,
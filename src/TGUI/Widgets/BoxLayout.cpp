@@ -140,14 +140,14 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void BoxLayout::rendererChanged(const std::string& property)
+    void BoxLayout::rendererChanged(RendererProperty property)
     {
-        if (property == "spacebetweenwidgets")
+        if (property == RendererProperty::SpaceBetweenWidgets)
         {
             m_spaceBetweenWidgetsCached = getSharedRenderer()->getSpaceBetweenWidgets();
             updateWidgets();
         }
-        else if (property == "padding")
+        else if (property == RendererProperty::Padding)
         {
             Group::rendererChanged(property);
 
@@ -34,6 +34,7 @@ namespace tgui
     Button::Button()
     {
         m_type = "Button";
+        m_renderBatchType = &typeid(Button);
         m_text.setFont(m_fontCached);
 
         m_renderer = aurora::makeCopied<ButtonRenderer>();
@@ -114,6 +115,8 @@ namespace tgui
 
     void Button::setText(const sf::String& text)
     {
+        invalidate();
+
         m_string = text;
         m_text.setString(text);
 
@@ -183,6 +186,8 @@ namespace tgui
             // Call setText to reposition the text
             setText(getText());
         }
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -252,89 +257,92 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    Signal& Button::getSignal(std::string signalName)
+    Signal* Button::getSignal(std::uint64_t signalNameHash)
     {
-        if (signalName == toLower(onPress.getName()))
-            return onPress;
-        else
-            return ClickableWidget::getSignal(std::move(signalName));
+        switch (signalNameHash)
+        {
+            case hashSignalName("Pressed"):
+                return &onPress;
+            default:
+                return ClickableWidget::getSignal(signalNameHash);
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Button::rendererChanged(const std::string& property)
+    void Button::rendererChanged(RendererProperty property)
     {
-        if (property == "borders")
+        if (property == RendererProperty::Borders)
         {
             m_bordersCached = getSharedRenderer()->getBorders();
             updateSize();
         }
-        else if ((property == "textcolor") || (property == "textcolorhover") || (property == "textcolordown") || (property == "textcolordisabled") || (property == "textcolorfocused")
-              || (property == "textstyle") || (property == "textstylehover") || (property == "textstyledown") || (property == "textstyledisabled") || (property == "textstylefocused"))
+        else if ((property == RendererProperty::TextColor) || (property == RendererProperty::TextColorHover) || (property == RendererProperty::TextColorDown) || (property == RendererProperty::TextColorDisabled) || (property == RendererProperty::TextColorFocused)
+              || (property == RendererProperty::TextStyle) || (property == RendererProperty::TextStyleHover) || (property == RendererProperty::TextStyleDown) || (property == RendererProperty::TextStyleDisabled) || (property == RendererProperty::TextStyleFocused))
         {
             updateTextColorAndStyle();
         }
-        else if (property == "texture")
+        else if (property == RendererProperty::Texture)
         {
             m_sprite.setTexture(getSharedRenderer()->getTexture());
         }
-        else if (property == "texturehover")
+        else if (property == RendererProperty::TextureHover)
         {
             m_spriteHover.setTexture(getSharedRenderer()->getTextureHover());
         }
-        else if (property == "texturedown")
+        else if (property == RendererProperty::TextureDown)
         {
             m_spriteDown.setTexture(getSharedRenderer()->getTextureDown());
         }
-        else if (property == "texturedisabled")
+        else if (property == RendererProperty::TextureDisabled)
         {
             m_spriteDisabled.setTexture(getSharedRenderer()->getTextureDisabled());
         }
-        else if (property == "texturefocused")
+        else if (property == RendererProperty::TextureFocused)
         {
             m_spriteFocused.setTexture(getSharedRenderer()->getTextureFocused());
         }
-        else if (property == "bordercolor")
+        else if (property == RendererProperty::BorderColor)
         {
             m_borderColorCached = getSharedRenderer()->getBorderColor();
         }
-        else if (property == "bordercolorhover")
+        else if (property == RendererProperty::BorderColorHover)
         {
             m_borderColorHoverCached = getSharedRenderer()->getBorderColorHover();
         }
-        else if (property == "bordercolordown")
+        else if (property == RendererProperty::BorderColorDown)
         {
             m_borderColorDownCached = getSharedRenderer()->getBorderColorDown();
         }
-        else if (property == "bordercolordisabled")
+        else if (property == RendererProperty::BorderColorDisabled)
         {
             m_borderColorDisabledCached = getSharedRenderer()->getBorderColorDisabled();
         }
-        else if (property == "bordercolorfocused")
+        else if (property == RendererProperty::BorderColorFocused)
         {
             m_borderColorFocusedCached = getSharedRenderer()->getBorderColorFocused();
         }
-        else if (property == "backgroundcolor")
+        else if (property == RendererProperty::BackgroundColor)
         {
             m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
         }
-        else if (property == "backgroundcolorhover")
+        else if (property == RendererProperty::BackgroundColorHover)
         {
             m_backgroundColorHoverCached = getSharedRenderer()->getBackgroundColorHover();
         }
-        else if (property == "backgroundcolordown")
+        else if (property == RendererProperty::BackgroundColorDown)
         {
             m_backgroundColorDownCached = getSharedRenderer()->getBackgroundColorDown();
         }
-        else if (property == "backgroundcolordisabled")
+        else if (property == RendererProperty::BackgroundColorDisabled)
         {
             m_backgroundColorDisabledCached = getSharedRenderer()->getBackgroundColorDisabled();
         }
-        else if (property == "backgroundcolorfocused")
+        else if (property == RendererProperty::BackgroundColorFocused)
         {
             m_backgroundColorFocusedCached = getSharedRenderer()->getBackgroundColorFocused();
         }
-        else if ((property == "opacity") || (property == "opacitydisabled"))
+        else if ((property == RendererProperty::Opacity) || (property == RendererProperty::OpacityDisabled))
         {
             Widget::rendererChanged(property);
 
@@ -346,7 +354,7 @@ namespace tgui
 
             m_text.setOpacity(m_opacityCached);
         }
-        else if (property == "font")
+        else if (property == RendererProperty::Font)
         {
             Widget::rendererChanged(property);
 
@@ -34,6 +34,7 @@ namespace tgui
     Canvas::Canvas(const Layout2d& size)
     {
         m_type = "Canvas";
+        m_renderBatchType = &typeid(Canvas);
 
         setSize(size);
     }
@@ -154,15 +155,16 @@ namespace tgui
     void Canvas::display()
     {
         m_renderTexture.display();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Canvas::rendererChanged(const std::string& property)
+    void Canvas::rendererChanged(RendererProperty property)
     {
         Widget::rendererChanged(property);
 
-        if ((property == "opacity") || (property == "opacitydisabled"))
+        if ((property == RendererProperty::Opacity) || (property == RendererProperty::OpacityDisabled))
             m_sprite.setColor(Color::calcColorOpacity(Color::White, m_opacityCached));
     }
 
@@ -174,7 +176,7 @@ namespace tgui
             return;
 
         states.transform.translate(getPosition());
-        target.draw(m_sprite, states);
+        RenderBatch::draw(target, m_sprite, states);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
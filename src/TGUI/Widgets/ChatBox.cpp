@@ -35,6 +35,7 @@ namespace tgui
     ChatBox::ChatBox()
     {
         m_type = "ChatBox";
+        m_renderBatchType = &typeid(ChatBox);
         m_draggableWidget = true;
 
         m_renderer = aurora::makeCopied<ChatBoxRenderer>();
@@ -133,28 +134,30 @@ namespace tgui
         if ((m_maxLines > 0) && (m_maxLines == m_lines.size()))
         {
             if (m_newLinesBelowOthers)
-                removeLine(0);
+                eraseLine(0);
             else
-                removeLine(m_maxLines-1);
+                eraseLine(m_maxLines-1);
         }
 
         Line line;
         line.string = text;
-        line.text.setColor(color);
-        line.text.setStyle(style);
-        line.text.setOpacity(m_opacityCached);
-        line.text.setCharacterSize(m_textSize);
-        line.text.setString(text);
-        line.text.setFont(m_fontCached);
+        line.color = color;
+        line.style = style;
 
-        recalculateLineText(line);
+        recalculateLineHeight(line);
 
         if (m_newLinesBelowOthers)
             m_lines.push_back(std::move(line));
         else
+        {
             m_lines.push_front(std::move(line));
 
-        recalculateFullTextHeight();
+            ++m_firstVisibleLine;
+            m_firstVisibleLineTop += m_lines.front().height;
+        }
+
+        updateScrollbarMaximum();
+        updateDisplayedText();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -175,7 +178,7 @@ namespace tgui
     {
         if (lineIndex < m_lines.size())
         {
-            return m_lines[lineIndex].text.getColor();
+            return m_lines[lineIndex].color;
         }
         else // Index too high
             return m_textColor;
@@ -186,7 +189,7 @@ namespace tgui
     TextStyle ChatBox::getLineTextStyle(std::size_t lineIndex) const
     {
         if (lineIndex < m_lines.size())
-            return m_lines[lineIndex].text.getStyle();
+            return m_lines[lineIndex].style;
         else // Index too high
             return m_textStyle;
     }
@@ -197,9 +200,10 @@ namespace tgui
     {
         if (lineIndex < m_lines.size())
         {
-            m_lines.erase(m_lines.begin() + lineIndex);
+            eraseLine(lineIndex);
 
-            recalculateFullTextHeight();
+            updateScrollbarMaximum();
+            updateDisplayedText();
             return true;
         }
         else // Index too high
@@ -211,8 +215,14 @@ namespace tgui
     void ChatBox::removeAllLines()
     {
         m_lines.clear();
+        m_outdatedLineCount = 0;
+        m_nextOutdatedLine = 0;
+        m_fullTextHeight = 0;
+        m_firstVisibleLine = 0;
+        m_firstVisibleLineTop = 0;
 
-        recalculateFullTextHeight();
+        updateScrollbarMaximum();
+        updateDisplayedText();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -231,12 +241,16 @@ namespace tgui
         // Remove the oldest lines if there are too many lines
         if ((m_maxLines > 0) && (m_maxLines < m_lines.size()))
         {
-            if (m_newLinesBelowOthers)
-                m_lines.erase(m_lines.begin(), m_lines.begin() + m_lines.size() - m_maxLines);
-            else
-                m_lines.erase(m_lines.begin() + m_maxLines, m_lines.end());
+            while (m_lines.size() > m_maxLines)
+            {
+                if (m_newLinesBelowOthers)
+                    eraseLine(0);
+                else
+                    eraseLine(m_lines.size() - 1);
+            }
 
-            recalculateFullTextHeight();
+            updateScrollbarMaximum();
+            updateDisplayedText();
         }
     }
 
@@ -254,9 +268,6 @@ namespace tgui
         m_textSize = size;
         m_scroll->setScrollAmount(size);
 
-        for (auto& line : m_lines)
-            line.text.setCharacterSize(size);
-
         recalculateAllLines();
     }
 
@@ -301,6 +312,8 @@ namespace tgui
     {
         if (m_linesStartFromTop != startFromTop)
             m_linesStartFromTop = startFromTop;
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -346,7 +359,12 @@ namespace tgui
 
         // Pass the event to the scrollbar
         if (m_scroll->mouseOnWidget(pos - getPosition()))
+        {
+            const unsigned int oldScrollValue = m_scroll->getValue();
             m_scroll->leftMousePressed(pos - getPosition());
+            if (oldScrollValue != m_scroll->getValue())
+                updateDisplayedText();
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -354,7 +372,12 @@ namespace tgui
     void ChatBox::leftMouseReleased(Vector2f pos)
     {
         if (m_scroll->isMouseDown())
+        {
+            const unsigned int oldScrollValue = m_scroll->getValue();
             m_scroll->leftMouseReleased(pos - getPosition());
+            if (oldScrollValue != m_scroll->getValue())
+                updateDisplayedText();
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -366,7 +389,12 @@ namespace tgui
 
         // Pass the event to the scrollbar when the mouse is on top of it or when we are dragging its thumb
         if (((m_scroll->isMouseDown()) && (m_scroll->isMouseDownOnThumb())) || m_scroll->mouseOnWidget(pos - getPosition()))
+        {
+            const unsigned int oldScrollValue = m_scroll->getValue();
             m_scroll->mouseMoved(pos - getPosition());
+            if (oldScrollValue != m_scroll->getValue())
+                updateDisplayedText();
+        }
         else
             m_scroll->mouseNoLongerOnWidget();
     }
@@ -393,7 +421,11 @@ namespace tgui
     {
         if (m_scroll->getViewportSize() < m_scroll->getMaximum())
         {
+            const unsigned int oldScrollValue = m_scroll->getValue();
             m_scroll->mouseWheelScrolled(delta, pos - getPosition());
+            if (oldScrollValue != m_scroll->getValue())
+                updateDisplayedText();
+
             return true;
         }
 
@@ -402,36 +434,99 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void ChatBox::recalculateLineText(Line& line)
+    sf::String ChatBox::wordWrapLine(const Line& line) const
     {
-        line.text.setString("");
-
         // Find the maximum width of one line
         const float maxWidth = getInnerSize().x - m_scroll->getSize().x - m_paddingCached.getLeft() - m_paddingCached.getRight();
         if (maxWidth < 0)
-            return;
+            return "";
 
-        line.text.setString(Text::wordWrap(maxWidth, line.string, m_fontCached, line.text.getCharacterSize(), false));
+        return Text::wordWrap(maxWidth, line.string, m_fontCached, m_textSize, false);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void ChatBox::recalculateAllLines()
+    float ChatBox::recalculateLineHeight(Line& line)
     {
-        for (auto& line : m_lines)
-            recalculateLineText(line);
+        if (line.heightOutdated)
+        {
+            line.heightOutdated = false;
+            m_outdatedLineCount--;
+        }
+
+        const float oldHeight = line.height;
+        if (m_fontCached != nullptr)
+        {
+            // The wrapped string is kept so that the text object can be created without word-wrapping the line again.
+            // The height is calculated in the same way as Text::getSize would do it, without having to create the text.
+            line.wrappedString = wordWrapLine(line);
+            const auto lineCount = 1 + std::count(line.wrappedString.begin(), line.wrappedString.end(), '\n');
+            line.height = lineCount * m_fontCached.getLineSpacing(m_textSize) + Text::calculateExtraVerticalSpace(m_fontCached, m_textSize, line.style);
+        }
+        else
+        {
+            line.wrappedString.clear();
+            line.height = 0;
+        }
 
-        recalculateFullTextHeight();
+        m_fullTextHeight += line.height - oldHeight;
+        return line.height - oldHeight;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void ChatBox::recalculateFullTextHeight()
+    void ChatBox::recalculateAllLines()
     {
+        // The old heights are kept as an estimate until the line is word-wrapped again. Since all lines are visited anyway,
+        // the heights that were updated incrementally are summed again here to get rid of accumulated rounding errors.
         m_fullTextHeight = 0;
-        for (const auto& line : m_lines)
-            m_fullTextHeight += line.text.getSize().y;
+        for (std::size_t i = 0; i < m_lines.size(); ++i)
+        {
+            if (i == m_firstVisibleLine)
+                m_firstVisibleLineTop = m_fullTextHeight;
+
+            m_lines[i].heightOutdated = true;
+            m_fullTextHeight += m_lines[i].height;
+        }
+
+        if (m_firstVisibleLine >= m_lines.size())
+        {
+            m_firstVisibleLine = m_lines.size();
+            m_firstVisibleLineTop = m_fullTextHeight;
+        }
+
+        m_outdatedLineCount = m_lines.size();
+        m_nextOutdatedLine = 0;
+
+        updateScrollbarMaximum();
+        updateDisplayedText();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ChatBox::eraseLine(std::size_t lineIndex)
+    {
+        if (m_lines[lineIndex].heightOutdated)
+            m_outdatedLineCount--;
+
+        if ((m_nextOutdatedLine > lineIndex) && (m_nextOutdatedLine > 0))
+            m_nextOutdatedLine--;
+
+        // The line below the removed one takes its place, so the first visible line only moves when a line above it is removed
+        if (lineIndex < m_firstVisibleLine)
+        {
+            m_firstVisibleLine--;
+            m_firstVisibleLineTop -= m_lines[lineIndex].height;
+        }
 
+        m_fullTextHeight -= m_lines[lineIndex].height;
+        m_lines.erase(m_lines.begin() + lineIndex);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ChatBox::updateScrollbarMaximum()
+    {
         // Update the maximum of the scrollbar
         const unsigned int oldMaximum = m_scroll->getMaximum();
         m_scroll->setMaximum(static_cast<unsigned int>(m_fullTextHeight + Text::getExtraVerticalPadding(m_textSize)));
@@ -449,23 +544,92 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void ChatBox::rendererChanged(const std::string& property)
+    void ChatBox::updateDisplayedText()
+    {
+        const float visibleHeight = getInnerSize().y - m_paddingCached.getTop() - m_paddingCached.getBottom();
+
+        // Word-wrapping the visible lines can change their height, which can in turn change which lines are visible.
+        // Every pass recalculates at least one outdated line, so this ends once all visible lines are up-to-date.
+        bool visibleLinesUpToDate = false;
+        while (!visibleLinesUpToDate)
+        {
+            visibleLinesUpToDate = true;
+
+            // Move the first visible line from where it was before, instead of searching it from the top of the text
+            const float viewTop = static_cast<float>(m_scroll->getValue());
+            while ((m_firstVisibleLine > 0) && (m_firstVisibleLineTop > viewTop))
+            {
+                m_firstVisibleLine--;
+                m_firstVisibleLineTop -= m_lines[m_firstVisibleLine].height;
+            }
+
+            if (m_firstVisibleLine == 0)
+                m_firstVisibleLineTop = 0;
+
+            while ((m_firstVisibleLine < m_lines.size()) && (m_firstVisibleLineTop + m_lines[m_firstVisibleLine].height <= viewTop))
+            {
+                m_firstVisibleLineTop += m_lines[m_firstVisibleLine].height;
+                m_firstVisibleLine++;
+            }
+
+            float lineTop = m_firstVisibleLineTop;
+            for (std::size_t i = m_firstVisibleLine; (i < m_lines.size()) && (lineTop < viewTop + visibleHeight); ++i)
+            {
+                if (m_lines[i].heightOutdated)
+                {
+                    recalculateLineHeight(m_lines[i]);
+                    visibleLinesUpToDate = false;
+                }
+
+                lineTop += m_lines[i].height;
+            }
+
+            if (!visibleLinesUpToDate)
+                updateScrollbarMaximum();
+        }
+
+        m_visibleLineTexts.clear();
+
+        const float viewBottom = static_cast<float>(m_scroll->getValue()) + visibleHeight;
+        float lineTop = m_firstVisibleLineTop;
+        for (std::size_t i = m_firstVisibleLine; (i < m_lines.size()) && (lineTop < viewBottom); ++i)
+        {
+            const Line& line = m_lines[i];
+
+            Text text;
+            text.setColor(line.color);
+            text.setStyle(line.style);
+            text.setOpacity(m_opacityCached);
+            text.setCharacterSize(m_textSize);
+            text.setFont(m_fontCached);
+            text.setString(line.wrappedString);
+            m_visibleLineTexts.push_back(std::move(text));
+
+            lineTop += line.height;
+        }
+
+        invalidate();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ChatBox::rendererChanged(RendererProperty property)
     {
-        if (property == "borders")
+        if (property == RendererProperty::Borders)
         {
             m_bordersCached = getSharedRenderer()->getBorders();
-            setSize(m_size);
+            requestSizeUpdate();
         }
-        else if (property == "padding")
+        else if (property == RendererProperty::Padding)
         {
             m_paddingCached = getSharedRenderer()->getPadding();
-            setSize(m_size);
+            requestSizeUpdate();
         }
-        else if (property == "texturebackground")
+        else if (property == RendererProperty::TextureBackground)
         {
             m_spriteBackground.setTexture(getSharedRenderer()->getTextureBackground());
         }
-        else if (property == "scrollbar")
+        else if (property == RendererProperty::Scrollbar)
         {
             m_scroll->setRenderer(getSharedRenderer()->getScrollbar());
 
@@ -473,40 +637,36 @@ namespace tgui
             if (!getSharedRenderer()->getScrollbarWidth())
             {
                 m_scroll->setSize({m_scroll->getDefaultWidth(), m_scroll->getSize().y});
-                setSize(m_size);
+                requestSizeUpdate();
             }
         }
-        else if (property == "scrollbarwidth")
+        else if (property == RendererProperty::ScrollbarWidth)
         {
             const float width = getSharedRenderer()->getScrollbarWidth() ? getSharedRenderer()->getScrollbarWidth() : m_scroll->getDefaultWidth();
             m_scroll->setSize({width, m_scroll->getSize().y});
-            setSize(m_size);
+            requestSizeUpdate();
         }
-        else if (property == "bordercolor")
+        else if (property == RendererProperty::BorderColor)
         {
             m_borderColorCached = getSharedRenderer()->getBorderColor();
         }
-        else if (property == "backgroundcolor")
+        else if (property == RendererProperty::BackgroundColor)
         {
             m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
         }
-        else if ((property == "opacity") || (property == "opacitydisabled"))
+        else if ((property == RendererProperty::Opacity) || (property == RendererProperty::OpacityDisabled))
         {
             Widget::rendererChanged(property);
 
             m_spriteBackground.setOpacity(m_opacityCached);
             m_scroll->setInheritedOpacity(m_opacityCached);
 
-            for (auto& line : m_lines)
-                line.text.setOpacity(m_opacityCached);
+            for (auto& text : m_visibleLineTexts)
+                text.setOpacity(m_opacityCached);
         }
-        else if (property == "font")
+        else if (property == RendererProperty::Font)
         {
             Widget::rendererChanged(property);
-
-            for (auto& line : m_lines)
-                line.text.setFont(m_fontCached);
-
             recalculateAllLines();
         }
         else
@@ -603,6 +763,48 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void ChatBox::update(sf::Time elapsedTime)
+    {
+        Widget::update(elapsedTime);
+
+        if (m_outdatedLineCount == 0)
+            return;
+
+        // Only word-wrap a limited amount of lines per frame, so that resizing a chat box with many lines doesn't block the gui
+        const std::size_t maxLinesPerUpdate = 200;
+        const unsigned int oldScrollValue = m_scroll->getValue();
+        bool linesAboveViewChanged = false;
+        std::size_t linesRecalculated = 0;
+        while ((m_outdatedLineCount > 0) && (linesRecalculated < maxLinesPerUpdate))
+        {
+            if (m_nextOutdatedLine >= m_lines.size())
+                m_nextOutdatedLine = 0;
+
+            if (m_lines[m_nextOutdatedLine].heightOutdated)
+            {
+                const float heightDiff = recalculateLineHeight(m_lines[m_nextOutdatedLine]);
+                if ((m_nextOutdatedLine < m_firstVisibleLine) && (heightDiff != 0))
+                {
+                    m_firstVisibleLineTop += heightDiff;
+                    linesAboveViewChanged = true;
+                }
+
+                linesRecalculated++;
+            }
+
+            m_nextOutdatedLine++;
+        }
+
+        // The visible lines were already up-to-date, they only have to be recreated when they moved
+        updateScrollbarMaximum();
+        if (linesAboveViewChanged || (m_scroll->getValue() != oldScrollValue))
+            updateDisplayedText();
+        else
+            invalidate();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     Vector2f ChatBox::getInnerSize() const
     {
         return {getSize().x - m_bordersCached.getLeft() - m_bordersCached.getRight(),
@@ -645,10 +847,12 @@ namespace tgui
         if (!m_linesStartFromTop && (m_fullTextHeight + Text::getExtraVerticalPadding(m_textSize) < getInnerSize().y - m_paddingCached.getTop() - m_paddingCached.getBottom()))
             states.transform.translate(0, getInnerSize().y - m_paddingCached.getTop() - m_paddingCached.getBottom() - m_fullTextHeight - Text::getExtraVerticalPadding(m_textSize));
 
-        for (const auto& line : m_lines)
+        // Only the visible lines have a text object
+        states.transform.translate(0, m_firstVisibleLineTop);
+        for (const auto& text : m_visibleLineTexts)
         {
-            line.text.draw(target, states);
-            states.transform.translate(0, line.text.getSize().y);
+            text.draw(target, states);
+            states.transform.translate(0, text.getSize().y);
         }
     }
 
@@ -37,6 +37,7 @@ namespace tgui
     CheckBox::CheckBox()
     {
         m_type = "CheckBox";
+        m_renderBatchType = &typeid(CheckBox);
 
         setRenderer(Theme::getDefault()->getRendererNoThrow(m_type));
 
@@ -121,6 +122,8 @@ namespace tgui
             else
                 m_text.setStyle(m_textStyleCached);
 
+            invalidate();
+
             onCheck.emit(this, true);
             onChange.emit(this, true);
         }
@@ -152,11 +155,11 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void CheckBox::rendererChanged(const std::string& property)
+    void CheckBox::rendererChanged(RendererProperty property)
     {
-        if (property == "textureunchecked")
+        if (property == RendererProperty::TextureUnchecked)
             m_textureUncheckedCached = getSharedRenderer()->getTextureUnchecked();
-        else if (property == "texturechecked")
+        else if (property == RendererProperty::TextureChecked)
             m_textureCheckedCached = getSharedRenderer()->getTextureChecked();
 
         RadioButton::rendererChanged(property);
@@ -258,7 +261,7 @@ namespace tgui
                     {{rightPoint.x - x, rightPoint.y - y}, checkColor}
                 };
 
-                target.draw(vertices.data(), vertices.size(), sf::PrimitiveType::TrianglesStrip, states);
+                RenderBatch::draw(target, vertices.data(), vertices.size(), sf::PrimitiveType::TrianglesStrip, states);
             }
         }
         states.transform.translate({-m_bordersCached.getLeft(), -m_bordersCached.getTop()});
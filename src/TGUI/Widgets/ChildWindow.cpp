@@ -51,6 +51,7 @@ namespace tgui
     ChildWindow::ChildWindow(const sf::String& title, unsigned int titleButtons)
     {
         m_type = "ChildWindow";
+        m_renderBatchType = &typeid(ChildWindow);
         m_isolatedFocus = true;
         m_titleText.setFont(m_fontCached);
 
@@ -249,6 +250,8 @@ namespace tgui
 
         // Reposition the images and text
         setPosition(m_position);
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -268,6 +271,8 @@ namespace tgui
             m_titleText.setCharacterSize(m_titleTextSize);
         else
             m_titleText.setCharacterSize(Text::findBestTextSize(m_fontCached, m_titleBarHeightCached * 0.8f));
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -285,6 +290,8 @@ namespace tgui
 
         // Reposition the images and text
         setPosition(m_position);
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -343,6 +350,8 @@ namespace tgui
             m_minimizeButton->setVisible(false);
 
         updateTitleBarHeight();
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -731,36 +740,39 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    Signal& ChildWindow::getSignal(std::string signalName)
+    Signal* ChildWindow::getSignal(std::uint64_t signalNameHash)
     {
-        if (signalName == toLower(onMousePress.getName()))
-            return onMousePress;
-        else if (signalName == toLower(onClose.getName()))
-            return onClose;
-        else if (signalName == toLower(onMinimize.getName()))
-            return onMinimize;
-        else if (signalName == toLower(onMaximize.getName()))
-            return onMaximize;
-        else if (signalName == toLower(onEscapeKeyPressed.getName()))
-            return onEscapeKeyPressed;
-        else
-            return Container::getSignal(std::move(signalName));
+        switch (signalNameHash)
+        {
+            case hashSignalName("MousePressed"):
+                return &onMousePress;
+            case hashSignalName("Closed"):
+                return &onClose;
+            case hashSignalName("Minimized"):
+                return &onMinimize;
+            case hashSignalName("Maximized"):
+                return &onMaximize;
+            case hashSignalName("EscapeKeyPressed"):
+                return &onEscapeKeyPressed;
+            default:
+                return Container::getSignal(signalNameHash);
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void ChildWindow::rendererChanged(const std::string& property)
+    void ChildWindow::rendererChanged(RendererProperty property)
     {
-        if (property == "borders")
+        if (property == RendererProperty::Borders)
         {
             m_bordersCached = getSharedRenderer()->getBorders();
-            setSize(m_size);
+            requestSizeUpdate();
         }
-        else if (property == "titlecolor")
+        else if (property == RendererProperty::TitleColor)
         {
             m_titleText.setColor(getSharedRenderer()->getTitleColor());
         }
-        else if (property == "texturetitlebar")
+        else if (property == RendererProperty::TextureTitleBar)
         {
             m_spriteTitleBar.setTexture(getSharedRenderer()->getTextureTitleBar());
 
@@ -769,35 +781,35 @@ namespace tgui
             if (m_titleBarHeightCached == m_spriteTitleBar.getTexture().getImageSize().y)
                 updateTitleBarHeight();
         }
-        else if (property == "titlebarheight")
+        else if (property == RendererProperty::TitleBarHeight)
         {
             m_titleBarHeightCached = getSharedRenderer()->getTitleBarHeight();
             updateTitleBarHeight();
         }
-        else if (property == "borderbelowtitlebar")
+        else if (property == RendererProperty::BorderBelowTitleBar)
         {
             m_borderBelowTitleBarCached = getSharedRenderer()->getBorderBelowTitleBar();
         }
-        else if (property == "distancetoside")
+        else if (property == RendererProperty::DistanceToSide)
         {
             m_distanceToSideCached = getSharedRenderer()->getDistanceToSide();
             setPosition(m_position);
         }
-        else if (property == "paddingbetweenbuttons")
+        else if (property == RendererProperty::PaddingBetweenButtons)
         {
             m_paddingBetweenButtonsCached = getSharedRenderer()->getPaddingBetweenButtons();
             setPosition(m_position);
         }
-        else if (property == "minimumresizableborderwidth")
+        else if (property == RendererProperty::MinimumResizableBorderWidth)
         {
             m_minimumResizableBorderWidthCached = getSharedRenderer()->getMinimumResizableBorderWidth();
         }
-        else if (property == "showtextontitlebuttons")
+        else if (property == RendererProperty::ShowTextOnTitleButtons)
         {
             m_showTextOnTitleButtonsCached = getSharedRenderer()->getShowTextOnTitleButtons();
             setTitleButtons(m_titleButtons);
         }
-        else if (property == "closebutton")
+        else if (property == RendererProperty::CloseButton)
         {
             if (m_closeButton->isVisible())
             {
@@ -807,7 +819,7 @@ namespace tgui
 
             updateTitleBarHeight();
         }
-        else if (property == "maximizebutton")
+        else if (property == RendererProperty::MaximizeButton)
         {
             if (m_maximizeButton->isVisible())
             {
@@ -817,7 +829,7 @@ namespace tgui
 
             updateTitleBarHeight();
         }
-        else if (property == "minimizebutton")
+        else if (property == RendererProperty::MinimizeButton)
         {
             if (m_minimizeButton->isVisible())
             {
@@ -827,23 +839,23 @@ namespace tgui
 
             updateTitleBarHeight();
         }
-        else if (property == "backgroundcolor")
+        else if (property == RendererProperty::BackgroundColor)
         {
             m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
         }
-        else if (property == "titlebarcolor")
+        else if (property == RendererProperty::TitleBarColor)
         {
             m_titleBarColorCached = getSharedRenderer()->getTitleBarColor();
         }
-        else if (property == "bordercolor")
+        else if (property == RendererProperty::BorderColor)
         {
             m_borderColorCached = getSharedRenderer()->getBorderColor();
         }
-        else if (property == "bordercolorfocused")
+        else if (property == RendererProperty::BorderColorFocused)
         {
             m_borderColorFocusedCached = getSharedRenderer()->getBorderColorFocused();
         }
-        else if ((property == "opacity") || (property == "opacitydisabled"))
+        else if ((property == RendererProperty::Opacity) || (property == RendererProperty::OpacityDisabled))
         {
             Container::rendererChanged(property);
 
@@ -856,7 +868,7 @@ namespace tgui
             m_titleText.setOpacity(m_opacityCached);
             m_spriteTitleBar.setOpacity(m_opacityCached);
         }
-        else if (property == "font")
+        else if (property == RendererProperty::Font)
         {
             Container::rendererChanged(property);
 
@@ -34,6 +34,7 @@ namespace tgui
     ClickableWidget::ClickableWidget()
     {
         m_type = "ClickableWidget";
+        m_renderBatchType = &typeid(ClickableWidget);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -90,16 +91,19 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    Signal& ClickableWidget::getSignal(std::string signalName)
+    Signal* ClickableWidget::getSignal(std::uint64_t signalNameHash)
     {
-        if (signalName == toLower(onMousePress.getName()))
-            return onMousePress;
-        else if (signalName == toLower(onMouseRelease.getName()))
-            return onMouseRelease;
-        else if (signalName == toLower(onClick.getName()))
-            return onClick;
-        else
-            return Widget::getSignal(std::move(signalName));
+        switch (signalNameHash)
+        {
+            case hashSignalName("MousePressed"):
+                return &onMousePress;
+            case hashSignalName("MouseReleased"):
+                return &onMouseRelease;
+            case hashSignalName("Clicked"):
+                return &onClick;
+            default:
+                return Widget::getSignal(signalNameHash);
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -38,6 +38,7 @@ namespace tgui
     ComboBox::ComboBox()
     {
         m_type = "ComboBox";
+        m_renderBatchType = &typeid(ComboBox);
         m_draggableWidget = true;
         m_text.setFont(m_fontCached);
         m_defaultText.setFont(m_fontCached);
@@ -268,6 +269,8 @@ namespace tgui
 
     bool ComboBox::addItem(const sf::String& item, const sf::String& id)
     {
+        invalidate();
+
         const bool ret = m_listBox->addItem(item, id);
         updateListBoxHeight();
         return ret;
@@ -307,6 +310,8 @@ namespace tgui
 
     bool ComboBox::setSelectedItemByIndex(std::size_t index)
     {
+        invalidate();
+
         const int previousSelectedItemIndex = m_listBox->getSelectedItemIndex();
 
         const bool ret = m_listBox->setSelectedItemByIndex(index);
@@ -324,6 +329,8 @@ namespace tgui
     {
         m_text.setString("");
         m_listBox->deselectItem();
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -361,6 +368,8 @@ namespace tgui
 
     bool ComboBox::removeItemByIndex(std::size_t index)
     {
+        invalidate();
+
         const bool ret = m_listBox->removeItemByIndex(index);
 
         m_text.setString(m_listBox->getSelectedItem());
@@ -380,6 +389,8 @@ namespace tgui
         m_listBox->removeAllItems();
 
         updateListBoxHeight();
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -414,6 +425,8 @@ namespace tgui
 
     bool ComboBox::changeItem(const sf::String& originalValue, const sf::String& newValue)
     {
+        invalidate();
+
         const bool ret = m_listBox->changeItem(originalValue, newValue);
         m_text.setString(m_listBox->getSelectedItem());
         return ret;
@@ -423,6 +436,8 @@ namespace tgui
 
     bool ComboBox::changeItemById(const sf::String& id, const sf::String& newValue)
     {
+        invalidate();
+
         const bool ret = m_listBox->changeItemById(id, newValue);
         m_text.setString(m_listBox->getSelectedItem());
         return ret;
@@ -432,6 +447,8 @@ namespace tgui
 
     bool ComboBox::changeItemByIndex(std::size_t index, const sf::String& newValue)
     {
+        invalidate();
+
         const bool ret = m_listBox->changeItemByIndex(index, newValue);
         m_text.setString(m_listBox->getSelectedItem());
         return ret;
@@ -472,6 +489,8 @@ namespace tgui
         m_listBox->setTextSize(textSize);
         m_text.setCharacterSize(m_listBox->getTextSize());
         m_defaultText.setCharacterSize(m_listBox->getTextSize());
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -486,6 +505,7 @@ namespace tgui
     void ComboBox::setDefaultText(const sf::String& defaultText)
     {
         m_defaultText.setString(defaultText);
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -619,96 +639,99 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    Signal& ComboBox::getSignal(std::string signalName)
+    Signal* ComboBox::getSignal(std::uint64_t signalNameHash)
     {
-        if (signalName == toLower(onItemSelect.getName()))
-            return onItemSelect;
-        else
-            return Widget::getSignal(std::move(signalName));
+        switch (signalNameHash)
+        {
+            case hashSignalName("ItemSelected"):
+                return &onItemSelect;
+            default:
+                return Widget::getSignal(signalNameHash);
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void ComboBox::rendererChanged(const std::string& property)
+    void ComboBox::rendererChanged(RendererProperty property)
     {
-        if (property == "borders")
+        if (property == RendererProperty::Borders)
         {
             m_bordersCached = getSharedRenderer()->getBorders();
-            setSize(m_size);
+            requestSizeUpdate();
         }
-        else if (property == "padding")
+        else if (property == RendererProperty::Padding)
         {
             m_paddingCached = getSharedRenderer()->getPadding();
-            setSize(m_size);
+            requestSizeUpdate();
         }
-        else if (property == "textcolor")
+        else if (property == RendererProperty::TextColor)
         {
             m_text.setColor(getSharedRenderer()->getTextColor());
             if (!getSharedRenderer()->getDefaultTextColor().isSet())
                 m_defaultText.setColor(getSharedRenderer()->getTextColor());
         }
-        else if (property == "textstyle")
+        else if (property == RendererProperty::TextStyle)
         {
             m_text.setStyle(getSharedRenderer()->getTextStyle());
             if (!getSharedRenderer()->getDefaultTextStyle().isSet())
                 m_defaultText.setStyle(getSharedRenderer()->getTextStyle());
         }
-        else if (property == "defaulttextcolor")
+        else if (property == RendererProperty::DefaultTextColor)
         {
             if (getSharedRenderer()->getDefaultTextColor().isSet())
                 m_defaultText.setColor(getSharedRenderer()->getDefaultTextColor());
             else
                 m_defaultText.setColor(getSharedRenderer()->getTextColor());
         }
-        else if (property == "defaulttextstyle")
+        else if (property == RendererProperty::DefaultTextStyle)
         {
             if (getSharedRenderer()->getDefaultTextStyle().isSet())
                 m_defaultText.setStyle(getSharedRenderer()->getDefaultTextStyle());
             else
                 m_defaultText.setStyle(getSharedRenderer()->getTextStyle());
         }
-        else if (property == "texturebackground")
+        else if (property == RendererProperty::TextureBackground)
         {
             m_spriteBackground.setTexture(getSharedRenderer()->getTextureBackground());
         }
-        else if (property == "texturearrow")
+        else if (property == RendererProperty::TextureArrow)
         {
             m_spriteArrow.setTexture(getSharedRenderer()->getTextureArrow());
-            setSize(m_size);
+            requestSizeUpdate();
         }
-        else if (property == "texturearrowhover")
+        else if (property == RendererProperty::TextureArrowHover)
         {
             m_spriteArrowHover.setTexture(getSharedRenderer()->getTextureArrowHover());
         }
-        else if (property == "listbox")
+        else if (property == RendererProperty::ListBox)
         {
             m_listBox->setRenderer(getSharedRenderer()->getListBox());
         }
-        else if (property == "bordercolor")
+        else if (property == RendererProperty::BorderColor)
         {
             m_borderColorCached = getSharedRenderer()->getBorderColor();
         }
-        else if (property == "backgroundcolor")
+        else if (property == RendererProperty::BackgroundColor)
         {
             m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
         }
-        else if (property == "arrowbackgroundcolor")
+        else if (property == RendererProperty::ArrowBackgroundColor)
         {
             m_arrowBackgroundColorCached = getSharedRenderer()->getArrowBackgroundColor();
         }
-        else if (property == "arrowbackgroundcolorhover")
+        else if (property == RendererProperty::ArrowBackgroundColorHover)
         {
             m_arrowBackgroundColorHoverCached = getSharedRenderer()->getArrowBackgroundColorHover();
         }
-        else if (property == "arrowcolor")
+        else if (property == RendererProperty::ArrowColor)
         {
             m_arrowColorCached = getSharedRenderer()->getArrowColor();
         }
-        else if (property == "arrowcolorhover")
+        else if (property == RendererProperty::ArrowColorHover)
         {
             m_arrowColorHoverCached = getSharedRenderer()->getArrowColorHover();
         }
-        else if ((property == "opacity") || (property == "opacitydisabled"))
+        else if ((property == RendererProperty::Opacity) || (property == RendererProperty::OpacityDisabled))
         {
             Widget::rendererChanged(property);
 
@@ -719,7 +742,7 @@ namespace tgui
             m_text.setOpacity(m_opacityCached);
             m_defaultText.setOpacity(m_opacityCached);
         }
-        else if (property == "font")
+        else if (property == RendererProperty::Font)
         {
             Widget::rendererChanged(property);
 
@@ -727,7 +750,7 @@ namespace tgui
             m_defaultText.setFont(m_fontCached);
             m_listBox->setInheritedFont(m_fontCached);
 
-            setSize(m_size);
+            requestSizeUpdate();
         }
         else
             Widget::rendererChanged(property);
@@ -995,7 +1018,7 @@ namespace tgui
             else
                 arrow.setFillColor(m_arrowColorCached);
 
-            target.draw(arrow, states);
+            RenderBatch::draw(target, arrow, states);
         }
 
         // Draw the selected item
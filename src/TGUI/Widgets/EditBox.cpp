@@ -48,6 +48,7 @@ namespace tgui
     EditBox::EditBox()
     {
         m_type = "EditBox";
+        m_renderBatchType = &typeid(EditBox);
         m_textBeforeSelection.setFont(m_fontCached);
         m_textSelection.setFont(m_fontCached);
         m_textAfterSelection.setFont(m_fontCached);
@@ -147,6 +148,8 @@ namespace tgui
 
     void EditBox::setText(const sf::String& text)
     {
+        invalidate();
+
         // Check if the text is auto sized
         if (m_textSize == 0)
         {
@@ -245,6 +248,7 @@ namespace tgui
     void EditBox::setDefaultText(const sf::String& text)
     {
         m_defaultText.setString(text);
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -968,26 +972,29 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    Signal& EditBox::getSignal(std::string signalName)
+    Signal* EditBox::getSignal(std::uint64_t signalNameHash)
     {
-        if (signalName == toLower(onTextChange.getName()))
-            return onTextChange;
-        else if (signalName == toLower(onReturnKeyPress.getName()))
-            return onReturnKeyPress;
-        else
-            return ClickableWidget::getSignal(std::move(signalName));
+        switch (signalNameHash)
+        {
+            case hashSignalName("TextChanged"):
+                return &onTextChange;
+            case hashSignalName("ReturnKeyPressed"):
+                return &onReturnKeyPress;
+            default:
+                return ClickableWidget::getSignal(signalNameHash);
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void EditBox::rendererChanged(const std::string& property)
+    void EditBox::rendererChanged(RendererProperty property)
     {
-        if (property == "borders")
+        if (property == RendererProperty::Borders)
         {
             m_bordersCached = getSharedRenderer()->getBorders();
-            setSize(m_size);
+            requestSizeUpdate();
         }
-        else if (property == "padding")
+        else if (property == RendererProperty::Padding)
         {
             m_paddingCached = getSharedRenderer()->getPadding();
             m_paddingCached.updateParentSize(getSize());
@@ -996,40 +1003,40 @@ namespace tgui
 
             m_caret.setSize({m_caret.getSize().x, getInnerSize().y - m_paddingCached.getBottom() - m_paddingCached.getTop()});
         }
-        else if (property == "caretwidth")
+        else if (property == RendererProperty::CaretWidth)
         {
             m_caret.setPosition({m_caret.getPosition().x + ((m_caret.getSize().x - getSharedRenderer()->getCaretWidth()) / 2.0f), m_caret.getPosition().y});
             m_caret.setSize({getSharedRenderer()->getCaretWidth(), getInnerSize().y - m_paddingCached.getBottom() - m_paddingCached.getTop()});
         }
-        else if ((property == "textcolor") || (property == "textcolordisabled") || (property == "textcolorfocused"))
+        else if ((property == RendererProperty::TextColor) || (property == RendererProperty::TextColorDisabled) || (property == RendererProperty::TextColorFocused))
         {
             updateTextColor();
         }
-        else if (property == "selectedtextcolor")
+        else if (property == RendererProperty::SelectedTextColor)
         {
             m_textSelection.setColor(getSharedRenderer()->getSelectedTextColor());
         }
-        else if (property == "defaulttextcolor")
+        else if (property == RendererProperty::DefaultTextColor)
         {
             m_defaultText.setColor(getSharedRenderer()->getDefaultTextColor());
         }
-        else if (property == "texture")
+        else if (property == RendererProperty::Texture)
         {
             m_sprite.setTexture(getSharedRenderer()->getTexture());
         }
-        else if (property == "texturehover")
+        else if (property == RendererProperty::TextureHover)
         {
             m_spriteHover.setTexture(getSharedRenderer()->getTextureHover());
         }
-        else if (property == "texturedisabled")
+        else if (property == RendererProperty::TextureDisabled)
         {
             m_spriteDisabled.setTexture(getSharedRenderer()->getTextureDisabled());
         }
-        else if (property == "texturefocused")
+        else if (property == RendererProperty::TextureFocused)
         {
             m_spriteFocused.setTexture(getSharedRenderer()->getTextureFocused());
         }
-        else if (property == "textstyle")
+        else if (property == RendererProperty::TextStyle)
         {
             const TextStyle style = getSharedRenderer()->getTextStyle();
             m_textBeforeSelection.setStyle(style);
@@ -1038,59 +1045,59 @@ namespace tgui
             m_textSuffix.setStyle(style);
             m_textFull.setStyle(style);
         }
-        else if (property == "defaulttextstyle")
+        else if (property == RendererProperty::DefaultTextStyle)
         {
             m_defaultText.setStyle(getSharedRenderer()->getDefaultTextStyle());
         }
-        else if (property == "bordercolor")
+        else if (property == RendererProperty::BorderColor)
         {
             m_borderColorCached = getSharedRenderer()->getBorderColor();
         }
-        else if (property == "bordercolorhover")
+        else if (property == RendererProperty::BorderColorHover)
         {
             m_borderColorHoverCached = getSharedRenderer()->getBorderColorHover();
         }
-        else if (property == "bordercolordisabled")
+        else if (property == RendererProperty::BorderColorDisabled)
         {
             m_borderColorDisabledCached = getSharedRenderer()->getBorderColorDisabled();
         }
-        else if (property == "bordercolorfocused")
+        else if (property == RendererProperty::BorderColorFocused)
         {
             m_borderColorFocusedCached = getSharedRenderer()->getBorderColorFocused();
         }
-        else if (property == "backgroundcolor")
+        else if (property == RendererProperty::BackgroundColor)
         {
             m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
         }
-        else if (property == "backgroundcolorhover")
+        else if (property == RendererProperty::BackgroundColorHover)
         {
             m_backgroundColorHoverCached = getSharedRenderer()->getBackgroundColorHover();
         }
-        else if (property == "backgroundcolordisabled")
+        else if (property == RendererProperty::BackgroundColorDisabled)
         {
             m_backgroundColorDisabledCached = getSharedRenderer()->getBackgroundColorDisabled();
         }
-        else if (property == "backgroundcolorfocused")
+        else if (property == RendererProperty::BackgroundColorFocused)
         {
             m_backgroundColorFocusedCached = getSharedRenderer()->getBackgroundColorFocused();
         }
-        else if (property == "caretcolor")
+        else if (property == RendererProperty::CaretColor)
         {
             m_caretColorCached = getSharedRenderer()->getCaretColor();
         }
-        else if (property == "caretcolorhover")
+        else if (property == RendererProperty::CaretColorHover)
         {
             m_caretColorHoverCached = getSharedRenderer()->getCaretColorHover();
         }
-        else if (property == "caretcolorfocused")
+        else if (property == RendererProperty::CaretColorFocused)
         {
             m_caretColorFocusedCached = getSharedRenderer()->getCaretColorFocused();
         }
-        else if (property == "selectedtextbackgroundcolor")
+        else if (property == RendererProperty::SelectedTextBackgroundColor)
         {
             m_selectedTextBackgroundColorCached = getSharedRenderer()->getSelectedTextBackgroundColor();
         }
-        else if ((property == "opacity") || (property == "opacitydisabled"))
+        else if ((property == RendererProperty::Opacity) || (property == RendererProperty::OpacityDisabled))
         {
             Widget::rendererChanged(property);
 
@@ -1105,7 +1112,7 @@ namespace tgui
             m_spriteDisabled.setOpacity(m_opacityCached);
             m_spriteFocused.setOpacity(m_opacityCached);
         }
-        else if (property == "font")
+        else if (property == RendererProperty::Font)
         {
             Widget::rendererChanged(property);
 
@@ -1403,6 +1410,8 @@ namespace tgui
         // Set the position of the caret
         caretLeft += m_textFull.findCharacterPos(m_selEnd).x - (m_caret.getSize().x * 0.5f);
         m_caret.setPosition({caretLeft, m_paddingCached.getTop()});
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1500,6 +1509,8 @@ namespace tgui
 
             // Switch the value of the visible flag
             m_caretVisible = !m_caretVisible;
+            if (m_focused)
+                invalidate();
 
             // Too slow for double clicking
             m_possibleDoubleClick = false;
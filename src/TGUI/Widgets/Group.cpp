@@ -35,6 +35,7 @@ namespace tgui
     Group::Group(const Layout2d& size)
     {
         m_type = "Group";
+        m_renderBatchType = &typeid(Group);
 
         m_renderer = aurora::makeCopied<GroupRenderer>();
         setRenderer(Theme::getDefault()->getRendererNoThrow(m_type));
@@ -143,12 +144,12 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Group::rendererChanged(const std::string& property)
+    void Group::rendererChanged(RendererProperty property)
     {
-        if (property == "padding")
+        if (property == RendererProperty::Padding)
         {
             m_paddingCached = getSharedRenderer()->getPadding();
-            setSize(m_size);
+            requestSizeUpdate();
         }
         else
             Container::rendererChanged(property);
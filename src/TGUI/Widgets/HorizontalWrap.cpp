@@ -35,6 +35,7 @@ namespace tgui
         BoxLayout{size}
     {
         m_type = "HorizontalWrap";
+        m_renderBatchType = &typeid(HorizontalWrap);
 
         m_renderer = aurora::makeCopied<BoxLayoutRenderer>();
         setRenderer(Theme::getDefault()->getRendererNoThrow(m_type));
@@ -43,6 +43,7 @@ namespace tgui
     Knob::Knob()
     {
         m_type = "Knob";
+        m_renderBatchType = &typeid(Knob);
         m_draggableWidget = true;
 
         m_renderer = aurora::makeCopied<KnobRenderer>();
@@ -457,54 +458,59 @@ namespace tgui
         {
             m_angle = (((m_value - m_minimum) / static_cast<float>(m_maximum - m_minimum)) * allowedAngle) + m_startRotation;
         }
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    Signal& Knob::getSignal(std::string signalName)
+    Signal* Knob::getSignal(std::uint64_t signalNameHash)
     {
-        if (signalName == toLower(onValueChange.getName()))
-            return onValueChange;
-        else
-            return Widget::getSignal(std::move(signalName));
+        switch (signalNameHash)
+        {
+            case hashSignalName("ValueChanged"):
+                return &onValueChange;
+            default:
+                return Widget::getSignal(signalNameHash);
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Knob::rendererChanged(const std::string& property)
+    void Knob::rendererChanged(RendererProperty property)
     {
-        if (property == "borders")
+        if (property == RendererProperty::Borders)
         {
             m_bordersCached = getSharedRenderer()->getBorders();
-            setSize(m_size);
+            requestSizeUpdate();
         }
-        else if (property == "texturebackground")
+        else if (property == RendererProperty::TextureBackground)
         {
             m_spriteBackground.setTexture(getSharedRenderer()->getTextureBackground());
-            setSize(m_size);
+            requestSizeUpdate();
         }
-        else if (property == "textureforeground")
+        else if (property == RendererProperty::TextureForeground)
         {
             m_spriteForeground.setTexture(getSharedRenderer()->getTextureForeground());
-            setSize(m_size);
+            requestSizeUpdate();
         }
-        else if (property == "bordercolor")
+        else if (property == RendererProperty::BorderColor)
         {
             m_borderColorCached = getSharedRenderer()->getBorderColor();
         }
-        else if (property == "backgroundcolor")
+        else if (property == RendererProperty::BackgroundColor)
         {
             m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
         }
-        else if (property == "thumbcolor")
+        else if (property == RendererProperty::ThumbColor)
         {
             m_thumbColorCached = getSharedRenderer()->getThumbColor();
         }
-        else if (property == "imagerotation")
+        else if (property == RendererProperty::ImageRotation)
         {
             m_imageRotationCached = getSharedRenderer()->getImageRotation();
         }
-        else if ((property == "opacity") || (property == "opacitydisabled"))
+        else if ((property == RendererProperty::Opacity) || (property == RendererProperty::OpacityDisabled))
         {
             Widget::rendererChanged(property);
 
@@ -576,7 +582,7 @@ namespace tgui
             bordersShape.setFillColor(Color::Transparent);
             bordersShape.setOutlineColor(Color::calcColorOpacity(m_borderColorCached, m_opacityCached));
             bordersShape.setOutlineThickness(borderThickness);
-            target.draw(bordersShape, states);
+            RenderBatch::draw(target, bordersShape, states);
         }
 
         // Draw the background
@@ -586,7 +592,7 @@ namespace tgui
         {
             sf::CircleShape background{size / 2};
             background.setFillColor(Color::calcColorOpacity(m_backgroundColorCached, m_opacityCached));
-            target.draw(background, states);
+            RenderBatch::draw(target, background, states);
         }
 
         // Draw the foreground
@@ -608,7 +614,7 @@ namespace tgui
             thumb.setFillColor(Color::calcColorOpacity(m_thumbColorCached, m_opacityCached));
             thumb.setPosition({(size / 2.0f) - thumb.getRadius() + (std::cos(m_angle / 180 * pi) * (size / 2) * 3/5),
                                (size / 2.0f) - thumb.getRadius() + (-std::sin(m_angle / 180 * pi) * (size / 2) * 3/5)});
-            target.draw(thumb, states);
+            RenderBatch::draw(target, thumb, states);
         }
     }
 
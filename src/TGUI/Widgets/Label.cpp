@@ -37,6 +37,7 @@ namespace tgui
     Label::Label()
     {
         m_type = "Label";
+        m_renderBatchType = &typeid(Label);
         m_draggableWidget = true;
 
         m_renderer = aurora::makeCopied<LabelRenderer>();
@@ -363,50 +364,53 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    Signal& Label::getSignal(std::string signalName)
+    Signal* Label::getSignal(std::uint64_t signalNameHash)
     {
-        if (signalName == toLower(onDoubleClick.getName()))
-            return onDoubleClick;
-        else
-            return ClickableWidget::getSignal(std::move(signalName));
+        switch (signalNameHash)
+        {
+            case hashSignalName("DoubleClicked"):
+                return &onDoubleClick;
+            default:
+                return ClickableWidget::getSignal(signalNameHash);
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Label::rendererChanged(const std::string& property)
+    void Label::rendererChanged(RendererProperty property)
     {
-        if (property == "borders")
+        if (property == RendererProperty::Borders)
         {
             m_bordersCached = getSharedRenderer()->getBorders();
             m_bordersCached.updateParentSize(getSize());
             rearrangeText();
         }
-        else if (property == "padding")
+        else if (property == RendererProperty::Padding)
         {
             m_paddingCached = getSharedRenderer()->getPadding();
             m_paddingCached.updateParentSize(getSize());
             rearrangeText();
         }
-        else if (property == "textstyle")
+        else if (property == RendererProperty::TextStyle)
         {
             m_textStyleCached = getSharedRenderer()->getTextStyle();
             rearrangeText();
         }
-        else if (property == "textcolor")
+        else if (property == RendererProperty::TextColor)
         {
             m_textColorCached = getSharedRenderer()->getTextColor();
             for (auto& line : m_lines)
                 line.setColor(m_textColorCached);
         }
-        else if (property == "bordercolor")
+        else if (property == RendererProperty::BorderColor)
         {
             m_borderColorCached = getSharedRenderer()->getBorderColor();
         }
-        else if (property == "backgroundcolor")
+        else if (property == RendererProperty::BackgroundColor)
         {
             m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
         }
-        else if (property == "scrollbar")
+        else if (property == RendererProperty::Scrollbar)
         {
             m_scrollbar->setRenderer(getSharedRenderer()->getScrollbar());
 
@@ -417,18 +421,18 @@ namespace tgui
                 rearrangeText();
             }
         }
-        else if (property == "scrollbarwidth")
+        else if (property == RendererProperty::ScrollbarWidth)
         {
             const float width = getSharedRenderer()->getScrollbarWidth() ? getSharedRenderer()->getScrollbarWidth() : m_scrollbar->getDefaultWidth();
             m_scrollbar->setSize({width, m_scrollbar->getSize().y});
             rearrangeText();
         }
-        else if (property == "font")
+        else if (property == RendererProperty::Font)
         {
             Widget::rendererChanged(property);
             rearrangeText();
         }
-        else if ((property == "opacity") || (property == "opacitydisabled"))
+        else if ((property == RendererProperty::Opacity) || (property == RendererProperty::OpacityDisabled))
         {
             Widget::rendererChanged(property);
 
@@ -547,6 +551,8 @@ namespace tgui
 
     void Label::rearrangeText()
     {
+        invalidate();
+
         m_lines.clear();
 
         if (m_fontCached == nullptr)
@@ -35,6 +35,7 @@ namespace tgui
     ListBox::ListBox()
     {
         m_type = "ListBox";
+        m_renderBatchType = &typeid(ListBox);
 
         m_draggableWidget = true;
 
@@ -125,6 +126,12 @@ namespace tgui
 
     bool ListBox::addItem(const sf::String& itemName, const sf::String& id)
     {
+        if (m_dataProvider)
+        {
+            TGUI_PRINT_WARNING("addItem can't be used while the list box has a data provider.");
+            return false;
+        }
+
         // Check if the item limit is reached (if there is one)
         if ((m_maxItems == 0) || (m_items.size() < m_maxItems))
         {
@@ -147,6 +154,7 @@ namespace tgui
             // Add the new item to the list
             m_items.push_back(std::move(newItem));
             m_itemIds.push_back(id);
+            invalidate();
             return true;
         }
         else // The item limit was reached
@@ -157,6 +165,16 @@ namespace tgui
 
     bool ListBox::setSelectedItem(const sf::String& itemName)
     {
+        if (m_dataProvider)
+        {
+            const std::size_t rowCount = m_dataProvider->getRowCount();
+            for (std::size_t i = 0; i < rowCount; ++i)
+            {
+                if (m_dataProvider->getCellText(i, 0) == itemName)
+                    return setSelectedItemByIndex(i);
+            }
+        }
+
         for (std::size_t i = 0; i < m_items.size(); ++i)
         {
             if (m_items[i].getString() == itemName)
@@ -172,6 +190,16 @@ namespace tgui
 
     bool ListBox::setSelectedItemById(const sf::String& id)
     {
+        if (m_dataProvider)
+        {
+            const std::size_t rowCount = m_dataProvider->getRowCount();
+            for (std::size_t i = 0; i < rowCount; ++i)
+            {
+                if (m_dataProvider->getRowId(i) == id)
+                    return setSelectedItemByIndex(i);
+            }
+        }
+
         for (std::size_t i = 0; i < m_itemIds.size(); ++i)
         {
             if (m_itemIds[i] == id)
@@ -187,7 +215,7 @@ namespace tgui
 
     bool ListBox::setSelectedItemByIndex(std::size_t index)
     {
-        if (index >= m_items.size())
+        if (index >= getItemCount())
         {
             deselectItem();
             return false;
@@ -215,6 +243,12 @@ namespace tgui
 
     bool ListBox::removeItem(const sf::String& itemName)
     {
+        if (m_dataProvider)
+        {
+            TGUI_PRINT_WARNING("removeItem can't be used while the list box has a data provider.");
+            return false;
+        }
+
         for (std::size_t i = 0; i < m_items.size(); ++i)
         {
             if (m_items[i].getString() == itemName)
@@ -228,6 +262,12 @@ namespace tgui
 
     bool ListBox::removeItemById(const sf::String& id)
     {
+        if (m_dataProvider)
+        {
+            TGUI_PRINT_WARNING("removeItemById can't be used while the list box has a data provider.");
+            return false;
+        }
+
         for (std::size_t i = 0; i < m_itemIds.size(); ++i)
         {
             if (m_itemIds[i] == id)
@@ -241,6 +281,12 @@ namespace tgui
 
     bool ListBox::removeItemByIndex(std::size_t index)
     {
+        if (m_dataProvider)
+        {
+            TGUI_PRINT_WARNING("removeItemByIndex can't be used while the list box has a data provider.");
+            return false;
+        }
+
         if (index >= m_items.size())
             return false;
 
@@ -263,6 +309,7 @@ namespace tgui
         m_scroll->setMaximum(static_cast<unsigned int>(m_items.size() * m_itemHeight));
         setPosition(m_position);
 
+        invalidate();
         return true;
     }
 
@@ -270,6 +317,12 @@ namespace tgui
 
     void ListBox::removeAllItems()
     {
+        if (m_dataProvider)
+        {
+            TGUI_PRINT_WARNING("removeAllItems can't be used while the list box has a data provider.");
+            return;
+        }
+
         // Unselect any selected item
         updateSelectedItem(-1);
         updateHoveringItem(-1);
@@ -279,12 +332,24 @@ namespace tgui
         m_itemIds.clear();
 
         m_scroll->setMaximum(0);
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     sf::String ListBox::getItemById(const sf::String& id) const
     {
+        if (m_dataProvider)
+        {
+            const std::size_t rowCount = m_dataProvider->getRowCount();
+            for (std::size_t i = 0; i < rowCount; ++i)
+            {
+                if (m_dataProvider->getRowId(i) == id)
+                    return m_dataProvider->getCellText(i, 0);
+            }
+        }
+
         for (std::size_t i = 0; i < m_itemIds.size(); ++i)
         {
             if (m_itemIds[i] == id)
@@ -298,9 +363,12 @@ namespace tgui
 
     sf::String ListBox::getItemByIndex(std::size_t index) const
     {
-        if (index >= m_items.size())
+        if (index >= getItemCount())
             return "";
 
+        if (m_dataProvider)
+            return m_dataProvider->getCellText(index, 0);
+
         return m_items[index].getString();
     }
 
@@ -308,14 +376,14 @@ namespace tgui
 
     sf::String ListBox::getSelectedItem() const
     {
-        return (m_selectedItem >= 0) ? m_items[m_selectedItem].getString() : "";
+        return (m_selectedItem >= 0) ? getItemByIndex(m_selectedItem) : "";
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     sf::String ListBox::getSelectedItemId() const
     {
-        return (m_selectedItem >= 0) ? m_itemIds[m_selectedItem] : "";
+        return (m_selectedItem >= 0) ? getIdOfItem(m_selectedItem) : "";
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -329,6 +397,12 @@ namespace tgui
 
     bool ListBox::changeItem(const sf::String& originalValue, const sf::String& newValue)
     {
+        if (m_dataProvider)
+        {
+            TGUI_PRINT_WARNING("changeItem can't be used while the list box has a data provider.");
+            return false;
+        }
+
         for (std::size_t i = 0; i < m_items.size(); ++i)
         {
             if (m_items[i].getString() == originalValue)
@@ -342,6 +416,12 @@ namespace tgui
 
     bool ListBox::changeItemById(const sf::String& id, const sf::String& newValue)
     {
+        if (m_dataProvider)
+        {
+            TGUI_PRINT_WARNING("changeItemById can't be used while the list box has a data provider.");
+            return false;
+        }
+
         for (std::size_t i = 0; i < m_items.size(); ++i)
         {
             if (m_itemIds[i] == id)
@@ -355,10 +435,17 @@ namespace tgui
 
     bool ListBox::changeItemByIndex(std::size_t index, const sf::String& newValue)
     {
+        if (m_dataProvider)
+        {
+            TGUI_PRINT_WARNING("changeItemByIndex can't be used while the list box has a data provider.");
+            return false;
+        }
+
         if (index >= m_items.size())
             return false;
 
         m_items[index].setString(newValue);
+        invalidate();
         return true;
     }
 
@@ -366,6 +453,9 @@ namespace tgui
 
     std::size_t ListBox::getItemCount() const
     {
+        if (m_dataProvider)
+            return m_dataProvider->getRowCount();
+
         return m_items.size();
     }
 
@@ -374,6 +464,14 @@ namespace tgui
     std::vector<sf::String> ListBox::getItems() const
     {
         std::vector<sf::String> items;
+        if (m_dataProvider)
+        {
+            const std::size_t rowCount = m_dataProvider->getRowCount();
+            items.reserve(rowCount);
+            for (std::size_t i = 0; i < rowCount; ++i)
+                items.push_back(m_dataProvider->getCellText(i, 0));
+        }
+
         for (const auto& item : m_items)
             items.push_back(item.getString());
 
@@ -389,6 +487,94 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void ListBox::setDataProvider(ItemDataProvider::Ptr provider)
+    {
+        // The selection has to be cleared while the rows of the old provider can still be accessed
+        updateSelectedItem(-1);
+        updateHoveringItem(-1);
+
+        m_dataProvider = nullptr;
+        removeAllItems();
+
+        m_dataProvider = std::move(provider);
+        m_visibleItemTexts.clear();
+        m_scroll->setMaximum(static_cast<unsigned int>(getItemCount() * m_itemHeight));
+
+        invalidate();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    ItemDataProvider::Ptr ListBox::getDataProvider() const
+    {
+        return m_dataProvider;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListBox::notifyItemsInserted(std::size_t index, std::size_t count)
+    {
+        if (count == 0)
+            return;
+
+        // Shift the indices of the selected and hovered items without triggering callbacks, they still refer to the same rows
+        if (m_selectedItem >= static_cast<int>(index))
+            m_selectedItem += static_cast<int>(count);
+        if (m_hoveringItem >= static_cast<int>(index))
+            m_hoveringItem += static_cast<int>(count);
+
+        // Texts of visible rows are only recreated when the visible rows have moved
+        if (index < m_firstVisibleItem + m_visibleItemTexts.size())
+            m_visibleItemTexts.clear();
+
+        m_scroll->setMaximum(static_cast<unsigned int>(getItemCount() * m_itemHeight));
+
+        // Scroll down when auto-scrolling is enabled
+        if (m_autoScroll && (m_scroll->getViewportSize() < m_scroll->getMaximum()))
+            m_scroll->setValue(m_scroll->getMaximum() - m_scroll->getViewportSize());
+
+        invalidate();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListBox::notifyItemsRemoved(std::size_t index, std::size_t count)
+    {
+        if (count == 0)
+            return;
+
+        // Keep it simple and forget hover when an item is removed
+        updateHoveringItem(-1);
+
+        if (m_selectedItem >= static_cast<int>(index + count))
+            m_selectedItem -= static_cast<int>(count);
+        else if (m_selectedItem >= static_cast<int>(index))
+        {
+            // The item no longer exists in the data provider, so it can't be passed to the callback
+            m_selectedItem = -1;
+            onItemSelect.emit(this, "", "");
+        }
+
+        if (index < m_firstVisibleItem + m_visibleItemTexts.size())
+            m_visibleItemTexts.clear();
+
+        m_scroll->setMaximum(static_cast<unsigned int>(getItemCount() * m_itemHeight));
+        invalidate();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListBox::notifyItemsChanged(std::size_t index, std::size_t count)
+    {
+        // Only the texts of the changed rows that are currently visible have to be recreated
+        if ((index < m_firstVisibleItem + m_visibleItemTexts.size()) && (index + count > m_firstVisibleItem))
+            m_visibleItemTexts.clear();
+
+        invalidate();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void ListBox::setItemHeight(unsigned int itemHeight)
     {
         // Set the new heights
@@ -400,9 +586,12 @@ namespace tgui
                 item.setCharacterSize(m_textSize);
         }
 
+        m_visibleItemTexts.clear();
         m_scroll->setScrollAmount(m_itemHeight);
-        m_scroll->setMaximum(static_cast<unsigned int>(m_items.size() * m_itemHeight));
+        m_scroll->setMaximum(static_cast<unsigned int>(getItemCount() * m_itemHeight));
         setPosition(m_position);
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -426,7 +615,10 @@ namespace tgui
         for (auto& item : m_items)
             item.setCharacterSize(m_textSize);
 
+        m_visibleItemTexts.clear();
         setPosition(m_position);
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -453,6 +645,8 @@ namespace tgui
             m_scroll->setMaximum(static_cast<unsigned int>(m_items.size() * m_itemHeight));
             setPosition(m_position);
         }
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -480,6 +674,18 @@ namespace tgui
 
     bool ListBox::contains(const sf::String& item) const
     {
+        if (m_dataProvider)
+        {
+            const std::size_t rowCount = m_dataProvider->getRowCount();
+            for (std::size_t i = 0; i < rowCount; ++i)
+            {
+                if (m_dataProvider->getCellText(i, 0) == item)
+                    return true;
+            }
+
+            return false;
+        }
+
         return std::find_if(m_items.begin(), m_items.end(), [item](const Text& text){ return text.getString() == item; }) != m_items.end();
     }
 
@@ -487,6 +693,18 @@ namespace tgui
 
     bool ListBox::containsId(const sf::String& id) const
     {
+        if (m_dataProvider)
+        {
+            const std::size_t rowCount = m_dataProvider->getRowCount();
+            for (std::size_t i = 0; i < rowCount; ++i)
+            {
+                if (m_dataProvider->getRowId(i) == id)
+                    return true;
+            }
+
+            return false;
+        }
+
         return std::find(m_itemIds.begin(), m_itemIds.end(), id) != m_itemIds.end();
     }
 
@@ -523,13 +741,13 @@ namespace tgui
                 pos.y -= m_bordersCached.getTop() + m_paddingCached.getTop();
 
                 int hoveringItem = static_cast<int>(((pos.y - (m_itemHeight - (m_scroll->getValue() % m_itemHeight))) / m_itemHeight) + (m_scroll->getValue() / m_itemHeight) + 1);
-                if (hoveringItem < static_cast<int>(m_items.size()))
+                if (hoveringItem < static_cast<int>(getItemCount()))
                     updateHoveringItem(hoveringItem);
                 else
                     updateHoveringItem(-1);
 
                 if (m_hoveringItem >= 0)
-                    onMousePress.emit(this, m_items[m_hoveringItem].getString(), m_itemIds[m_hoveringItem]);
+                    onMousePress.emit(this, getItemByIndex(m_hoveringItem), getIdOfItem(m_hoveringItem));
 
                 if (m_selectedItem != m_hoveringItem)
                 {
@@ -548,7 +766,7 @@ namespace tgui
         if (m_mouseDown && !m_scroll->isMouseDown())
         {
             if (m_selectedItem >= 0)
-                onMouseRelease.emit(this, m_items[m_selectedItem].getString(), m_itemIds[m_selectedItem]);
+                onMouseRelease.emit(this, getItemByIndex(m_selectedItem), getIdOfItem(m_selectedItem));
 
             // Check if you double-clicked
             if (m_possibleDoubleClick)
@@ -556,7 +774,7 @@ namespace tgui
                 m_possibleDoubleClick = false;
 
                 if (m_selectedItem >= 0)
-                    onDoubleClick.emit(this, m_items[m_selectedItem].getString(), m_itemIds[m_selectedItem]);
+                    onDoubleClick.emit(this, getItemByIndex(m_selectedItem), getIdOfItem(m_selectedItem));
             }
             else // This is the first click
             {
@@ -595,7 +813,7 @@ namespace tgui
                 pos.y -= m_bordersCached.getTop() + m_paddingCached.getTop();
 
                 int hoveringItem = static_cast<int>(((pos.y - (m_itemHeight - (m_scroll->getValue() % m_itemHeight))) / m_itemHeight) + (m_scroll->getValue() / m_itemHeight) + 1);
-                if (hoveringItem < static_cast<int>(m_items.size()))
+                if (hoveringItem < static_cast<int>(getItemCount()))
                     updateHoveringItem(hoveringItem);
                 else
                     updateHoveringItem(-1);
@@ -652,81 +870,86 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    Signal& ListBox::getSignal(std::string signalName)
+    Signal* ListBox::getSignal(std::uint64_t signalNameHash)
     {
-        if (signalName == toLower(onItemSelect.getName()))
-            return onItemSelect;
-        else if (signalName == toLower(onMousePress.getName()))
-            return onMousePress;
-        else if (signalName == toLower(onMouseRelease.getName()))
-            return onMouseRelease;
-        else if (signalName == toLower(onDoubleClick.getName()))
-            return onDoubleClick;
-        else
-            return Widget::getSignal(std::move(signalName));
+        switch (signalNameHash)
+        {
+            case hashSignalName("ItemSelected"):
+                return &onItemSelect;
+            case hashSignalName("MousePressed"):
+                return &onMousePress;
+            case hashSignalName("MouseReleased"):
+                return &onMouseRelease;
+            case hashSignalName("DoubleClicked"):
+                return &onDoubleClick;
+            default:
+                return Widget::getSignal(signalNameHash);
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void ListBox::rendererChanged(const std::string& property)
+    void ListBox::rendererChanged(RendererProperty property)
     {
-        if (property == "borders")
+        if (property == RendererProperty::Borders)
         {
             m_bordersCached = getSharedRenderer()->getBorders();
-            setSize(m_size);
+            requestSizeUpdate();
         }
-        else if (property == "padding")
+        else if (property == RendererProperty::Padding)
         {
             m_paddingCached = getSharedRenderer()->getPadding();
-            setSize(m_size);
+            requestSizeUpdate();
         }
-        else if (property == "textcolor")
+        else if (property == RendererProperty::TextColor)
         {
             m_textColorCached = getSharedRenderer()->getTextColor();
             updateItemColorsAndStyle();
         }
-        else if (property == "textcolorhover")
+        else if (property == RendererProperty::TextColorHover)
         {
             m_textColorHoverCached = getSharedRenderer()->getTextColorHover();
             updateItemColorsAndStyle();
         }
-        else if (property == "selectedtextcolor")
+        else if (property == RendererProperty::SelectedTextColor)
         {
             m_selectedTextColorCached = getSharedRenderer()->getSelectedTextColor();
             updateItemColorsAndStyle();
         }
-        else if (property == "selectedtextcolorhover")
+        else if (property == RendererProperty::SelectedTextColorHover)
         {
             m_selectedTextColorHoverCached = getSharedRenderer()->getSelectedTextColorHover();
             updateItemColorsAndStyle();
         }
-        else if (property == "texturebackground")
+        else if (property == RendererProperty::TextureBackground)
         {
             m_spriteBackground.setTexture(getSharedRenderer()->getTextureBackground());
         }
-        else if (property == "textstyle")
+        else if (property == RendererProperty::TextStyle)
         {
             m_textStyleCached = getSharedRenderer()->getTextStyle();
 
             for (auto& item : m_items)
                 item.setStyle(m_textStyleCached);
 
+            m_visibleItemTexts.clear();
+
             if ((m_selectedItem >= 0) && m_selectedTextStyleCached.isSet())
-                m_items[m_selectedItem].setStyle(m_selectedTextStyleCached);
+                setItemStyle(m_selectedItem, m_selectedTextStyleCached);
         }
-        else if (property == "selectedtextstyle")
+        else if (property == RendererProperty::SelectedTextStyle)
         {
             m_selectedTextStyleCached = getSharedRenderer()->getSelectedTextStyle();
 
             if (m_selectedItem >= 0)
             {
                 if (m_selectedTextStyleCached.isSet())
-                    m_items[m_selectedItem].setStyle(m_selectedTextStyleCached);
+                    setItemStyle(m_selectedItem, m_selectedTextStyleCached);
                 else
-                    m_items[m_selectedItem].setStyle(m_textStyleCached);
+                    setItemStyle(m_selectedItem, m_textStyleCached);
             }
         }
-        else if (property == "scrollbar")
+        else if (property == RendererProperty::Scrollbar)
         {
             m_scroll->setRenderer(getSharedRenderer()->getScrollbar());
 
@@ -734,36 +957,36 @@ namespace tgui
             if (!getSharedRenderer()->getScrollbarWidth())
             {
                 m_scroll->setSize({m_scroll->getDefaultWidth(), m_scroll->getSize().y});
-                setSize(m_size);
+                requestSizeUpdate();
             }
         }
-        else if (property == "scrollbarwidth")
+        else if (property == RendererProperty::ScrollbarWidth)
         {
             const float width = getSharedRenderer()->getScrollbarWidth() ? getSharedRenderer()->getScrollbarWidth() : m_scroll->getDefaultWidth();
             m_scroll->setSize({width, m_scroll->getSize().y});
-            setSize(m_size);
+            requestSizeUpdate();
         }
-        else if (property == "bordercolor")
+        else if (property == RendererProperty::BorderColor)
         {
             m_borderColorCached = getSharedRenderer()->getBorderColor();
         }
-        else if (property == "backgroundcolor")
+        else if (property == RendererProperty::BackgroundColor)
         {
             m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
         }
-        else if (property == "backgroundcolorhover")
+        else if (property == RendererProperty::BackgroundColorHover)
         {
             m_backgroundColorHoverCached = getSharedRenderer()->getBackgroundColorHover();
         }
-        else if (property == "selectedbackgroundcolor")
+        else if (property == RendererProperty::SelectedBackgroundColor)
         {
             m_selectedBackgroundColorCached = getSharedRenderer()->getSelectedBackgroundColor();
         }
-        else if (property == "selectedbackgroundcolorhover")
+        else if (property == RendererProperty::SelectedBackgroundColorHover)
         {
             m_selectedBackgroundColorHoverCached = getSharedRenderer()->getSelectedBackgroundColorHover();
         }
-        else if ((property == "opacity") || (property == "opacitydisabled"))
+        else if ((property == RendererProperty::Opacity) || (property == RendererProperty::OpacityDisabled))
         {
             Widget::rendererChanged(property);
 
@@ -771,8 +994,10 @@ namespace tgui
             m_spriteBackground.setOpacity(m_opacityCached);
             for (auto& item : m_items)
                 item.setOpacity(m_opacityCached);
+            for (auto& text : m_visibleItemTexts)
+                text.setOpacity(m_opacityCached);
         }
-        else if (property == "font")
+        else if (property == RendererProperty::Font)
         {
             Widget::rendererChanged(property);
 
@@ -787,6 +1012,7 @@ namespace tgui
                     item.setCharacterSize(m_textSize);
             }
 
+            m_visibleItemTexts.clear();
             setPosition(m_position);
         }
         else
@@ -799,7 +1025,8 @@ namespace tgui
     {
         auto node = Widget::save(renderers);
 
-        if (getItemCount() > 0)
+        // Items from a data provider aren't owned by the list box and are thus not saved
+        if (!m_items.empty())
         {
             const auto& items = getItems();
             const auto& ids = getItemIds();
@@ -894,23 +1121,104 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    sf::String ListBox::getIdOfItem(std::size_t index) const
+    {
+        if (m_dataProvider)
+            return m_dataProvider->getRowId(index);
+        else
+            return m_itemIds[index];
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListBox::setItemColor(std::size_t index, const Color& color)
+    {
+        if (!m_dataProvider)
+            m_items[index].setColor(color);
+        else if ((index >= m_firstVisibleItem) && (index < m_firstVisibleItem + m_visibleItemTexts.size()))
+            m_visibleItemTexts[index - m_firstVisibleItem].setColor(color);
+
+        invalidate();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListBox::setItemStyle(std::size_t index, TextStyle style)
+    {
+        if (!m_dataProvider)
+            m_items[index].setStyle(style);
+        else if ((index >= m_firstVisibleItem) && (index < m_firstVisibleItem + m_visibleItemTexts.size()))
+            m_visibleItemTexts[index - m_firstVisibleItem].setStyle(style);
+
+        invalidate();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListBox::updateVisibleItemTexts(std::size_t firstItem, std::size_t lastItem) const
+    {
+        if ((firstItem == m_firstVisibleItem) && (lastItem - firstItem == m_visibleItemTexts.size()))
+            return;
+
+        // Reuse the texts of items that were already visible and only create texts for the items that became visible
+        std::vector<Text> visibleItemTexts(lastItem - firstItem);
+        for (std::size_t i = firstItem; i < lastItem; ++i)
+        {
+            if ((i >= m_firstVisibleItem) && (i < m_firstVisibleItem + m_visibleItemTexts.size()))
+            {
+                visibleItemTexts[i - firstItem] = std::move(m_visibleItemTexts[i - m_firstVisibleItem]);
+                continue;
+            }
+
+            const bool selected = (static_cast<int>(i) == m_selectedItem);
+            const bool hovered = (static_cast<int>(i) == m_hoveringItem);
+
+            Text& text = visibleItemTexts[i - firstItem];
+            text.setFont(m_fontCached);
+            text.setOpacity(m_opacityCached);
+            text.setCharacterSize(m_textSize);
+            text.setString(m_dataProvider->getCellText(i, 0));
+
+            if (selected && hovered && m_selectedTextColorHoverCached.isSet())
+                text.setColor(m_selectedTextColorHoverCached);
+            else if (selected && m_selectedTextColorCached.isSet())
+                text.setColor(m_selectedTextColorCached);
+            else if (hovered && m_textColorHoverCached.isSet())
+                text.setColor(m_textColorHoverCached);
+            else
+                text.setColor(m_textColorCached);
+
+            if (selected && m_selectedTextStyleCached.isSet())
+                text.setStyle(m_selectedTextStyleCached);
+            else
+                text.setStyle(m_textStyleCached);
+
+            text.setPosition({0, (i * m_itemHeight) + ((m_itemHeight - text.getSize().y) / 2.0f)});
+        }
+
+        m_visibleItemTexts = std::move(visibleItemTexts);
+        m_firstVisibleItem = firstItem;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void ListBox::updateSelectedAndHoveringItemColorsAndStyle()
     {
         if (m_selectedItem >= 0)
         {
             if ((m_selectedItem == m_hoveringItem) && m_selectedTextColorHoverCached.isSet())
-                m_items[m_selectedItem].setColor(m_selectedTextColorHoverCached);
+                setItemColor(m_selectedItem, m_selectedTextColorHoverCached);
             else if (m_selectedTextColorCached.isSet())
-                m_items[m_selectedItem].setColor(m_selectedTextColorCached);
+                setItemColor(m_selectedItem, m_selectedTextColorCached);
 
             if (m_selectedTextStyleCached.isSet())
-                m_items[m_selectedItem].setStyle(m_selectedTextStyleCached);
+                setItemStyle(m_selectedItem, m_selectedTextStyleCached);
         }
 
         if ((m_hoveringItem >= 0) && (m_selectedItem != m_hoveringItem))
         {
             if (m_textColorHoverCached.isSet())
-                m_items[m_hoveringItem].setColor(m_textColorHoverCached);
+                setItemColor(m_hoveringItem, m_textColorHoverCached);
         }
     }
 
@@ -924,6 +1232,7 @@ namespace tgui
             item.setStyle(m_textStyleCached);
         }
 
+        m_visibleItemTexts.clear();
         updateSelectedAndHoveringItemColorsAndStyle();
     }
 
@@ -936,9 +1245,9 @@ namespace tgui
             if (m_hoveringItem >= 0)
             {
                 if ((m_selectedItem == m_hoveringItem) && m_selectedTextColorCached.isSet())
-                    m_items[m_hoveringItem].setColor(m_selectedTextColorCached);
+                    setItemColor(m_hoveringItem, m_selectedTextColorCached);
                 else
-                    m_items[m_hoveringItem].setColor(m_textColorCached);
+                    setItemColor(m_hoveringItem, m_textColorCached);
             }
 
             m_hoveringItem = item;
@@ -956,21 +1265,23 @@ namespace tgui
             if (m_selectedItem >= 0)
             {
                 if ((m_selectedItem == m_hoveringItem) && m_textColorHoverCached.isSet())
-                    m_items[m_selectedItem].setColor(m_textColorHoverCached);
+                    setItemColor(m_selectedItem, m_textColorHoverCached);
                 else
-                    m_items[m_selectedItem].setColor(m_textColorCached);
+                    setItemColor(m_selectedItem, m_textColorCached);
 
-                m_items[m_selectedItem].setStyle(m_textStyleCached);
+                setItemStyle(m_selectedItem, m_textStyleCached);
             }
 
             m_selectedItem = item;
             if (m_selectedItem >= 0)
-                onItemSelect.emit(this, m_items[m_selectedItem].getString(), m_itemIds[m_selectedItem]);
+                onItemSelect.emit(this, getItemByIndex(m_selectedItem), getIdOfItem(m_selectedItem));
             else
                 onItemSelect.emit(this, "", "");
 
             updateSelectedAndHoveringItemColorsAndStyle();
         }
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1016,7 +1327,7 @@ namespace tgui
 
             // Find out which items are visible
             std::size_t firstItem = 0;
-            std::size_t lastItem = m_items.size();
+            std::size_t lastItem = getItemCount();
             if (m_scroll->getViewportSize() < m_scroll->getMaximum())
             {
                 firstItem = m_scroll->getValue() / m_itemHeight;
@@ -1053,8 +1364,17 @@ namespace tgui
 
             // Draw the items
             states.transform.translate({Text::getExtraHorizontalPadding(m_fontCached, m_textSize, m_textStyleCached), 0});
-            for (std::size_t i = firstItem; i < lastItem; ++i)
-                m_items[i].draw(target, states);
+            if (m_dataProvider)
+            {
+                updateVisibleItemTexts(firstItem, lastItem);
+                for (const auto& text : m_visibleItemTexts)
+                    text.draw(target, states);
+            }
+            else
+            {
+                for (std::size_t i = firstItem; i < lastItem; ++i)
+                    m_items[i].draw(target, states);
+            }
         }
 
         // Draw the scrollbar
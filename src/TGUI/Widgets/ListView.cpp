@@ -27,6 +27,10 @@
 #include <TGUI/Clipping.hpp>
 #include <cmath>
 
+#ifdef TGUI_USE_CPP17
+    #include <optional>
+#endif
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
@@ -36,6 +40,7 @@ namespace tgui
     ListView::ListView()
     {
         m_type = "ListView";
+        m_renderBatchType = &typeid(ListView);
         m_draggableWidget = true;
 
         m_horizontalScrollbar->setSize(m_horizontalScrollbar->getSize().y, m_horizontalScrollbar->getSize().x);
@@ -127,6 +132,10 @@ namespace tgui
         m_columns.push_back(std::move(column));
         updateHorizontalScrollbarMaximum();
 
+        // The amount of columns determines how many texts are requested from a data provider
+        if (m_dataProvider)
+            m_visibleItemTexts.clear();
+
         return m_columns.size()-1;
     }
 
@@ -198,6 +207,9 @@ namespace tgui
     {
         m_columns.clear();
         updateHorizontalScrollbarMaximum();
+
+        if (m_dataProvider)
+            m_visibleItemTexts.clear();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -245,6 +257,8 @@ namespace tgui
         {
             TGUI_PRINT_WARNING("setColumnAlignment called with invalid columnIndex.");
         }
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -279,13 +293,19 @@ namespace tgui
 
     std::size_t ListView::addItem(const sf::String& text)
     {
+        if (m_dataProvider)
+        {
+            TGUI_PRINT_WARNING("addItem can't be used while the list view has a data provider.");
+            return 0;
+        }
+
 #ifdef TGUI_USE_CPP17
         Item& item = m_items.emplace_back();
 #else
         m_items.emplace_back();
         Item& item = m_items.back();
 #endif
-        item.texts.push_back(createText(text));
+        item.texts.push_back(text);
         item.icon.setOpacity(m_opacityCached);
 
         updateVerticalScrollbarMaximum();
@@ -301,16 +321,19 @@ namespace tgui
 
     std::size_t ListView::addItem(const std::vector<sf::String>& itemTexts)
     {
+        if (m_dataProvider)
+        {
+            TGUI_PRINT_WARNING("addItem can't be used while the list view has a data provider.");
+            return 0;
+        }
+
 #ifdef TGUI_USE_CPP17
         Item& item = m_items.emplace_back();
 #else
         m_items.emplace_back();
         Item& item = m_items.back();
 #endif
-        item.texts.reserve(itemTexts.size());
-        for (const auto& text : itemTexts)
-            item.texts.push_back(createText(text));
-
+        item.texts = itemTexts;
         item.icon.setOpacity(m_opacityCached);
 
         updateVerticalScrollbarMaximum();
@@ -326,6 +349,12 @@ namespace tgui
 
     void ListView::addMultipleItems(const std::vector<std::vector<sf::String>>& items)
     {
+        if (m_dataProvider)
+        {
+            TGUI_PRINT_WARNING("addMultipleItems can't be used while the list view has a data provider.");
+            return;
+        }
+
         for (unsigned int i = 0; i < items.size(); ++i)
         {
 #ifdef TGUI_USE_CPP17
@@ -334,9 +363,7 @@ namespace tgui
             m_items.emplace_back();
             Item& item = m_items.back();
 #endif
-            item.texts.reserve(items[i].size());
-            for (const auto& text : items[i])
-                item.texts.push_back(createText(text));
+            item.texts = items[i];
 
             item.icon.setOpacity(m_opacityCached);
         }
@@ -352,15 +379,18 @@ namespace tgui
 
     bool ListView::changeItem(std::size_t index, const std::vector<sf::String>& itemTexts)
     {
-        if (index >= m_items.size())
+        if (m_dataProvider)
+        {
+            TGUI_PRINT_WARNING("changeItem can't be used while the list view has a data provider.");
             return false;
+        }
 
-        Item& item = m_items[index];
-        item.texts.clear();
-        item.texts.reserve(itemTexts.size());
-        for (const auto& text : itemTexts)
-            item.texts.push_back(createText(text));
+        if (index >= m_items.size())
+            return false;
 
+        m_items[index].texts = itemTexts;
+        m_visibleItemTexts.clear();
+        invalidate();
         return true;
     }
 
@@ -368,6 +398,12 @@ namespace tgui
 
     bool ListView::changeSubItem(std::size_t index, std::size_t column, const sf::String& itemText)
     {
+        if (m_dataProvider)
+        {
+            TGUI_PRINT_WARNING("changeSubItem can't be used while the list view has a data provider.");
+            return false;
+        }
+
         if (index >= m_items.size())
             return false;
 
@@ -375,7 +411,9 @@ namespace tgui
         if (column >= item.texts.size())
             item.texts.resize(column + 1);
 
-        item.texts[column] = createText(itemText);
+        item.texts[column] = itemText;
+        m_visibleItemTexts.clear();
+        invalidate();
         return true;
     }
 
@@ -383,6 +421,12 @@ namespace tgui
 
     bool ListView::removeItem(std::size_t index)
     {
+        if (m_dataProvider)
+        {
+            TGUI_PRINT_WARNING("removeItem can't be used while the list view has a data provider.");
+            return false;
+        }
+
         // Update the hovered item
         if (m_hoveredItem >= 0)
         {
@@ -409,6 +453,7 @@ namespace tgui
 
         const bool wasIconSet = m_items[index].icon.isSet();
         m_items.erase(m_items.begin() + index);
+        m_visibleItemTexts.clear();
 
         if (wasIconSet)
         {
@@ -439,10 +484,17 @@ namespace tgui
 
     void ListView::removeAllItems()
     {
+        if (m_dataProvider)
+        {
+            TGUI_PRINT_WARNING("removeAllItems can't be used while the list view has a data provider.");
+            return;
+        }
+
         updateSelectedItem(-1);
         updateHoveredItem(-1);
 
         m_items.clear();
+        m_visibleItemTexts.clear();
 
         m_iconCount = 0;
         m_maxIconWidth = 0;
@@ -454,7 +506,7 @@ namespace tgui
 
     void ListView::setSelectedItem(std::size_t index)
     {
-        if (index >= m_items.size())
+        if (index >= getItemCount())
         {
             updateSelectedItem(-1);
             return;
@@ -487,6 +539,12 @@ namespace tgui
 
     void ListView::setItemIcon(std::size_t index, const Texture& texture)
     {
+        if (m_dataProvider)
+        {
+            TGUI_PRINT_WARNING("setItemIcon can't be used while the list view has a data provider.");
+            return;
+        }
+
         if (index >= m_items.size())
         {
             TGUI_PRINT_WARNING("setItemIcon called with invalid index.");
@@ -522,6 +580,8 @@ namespace tgui
                 }
             }
         }
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -541,6 +601,9 @@ namespace tgui
 
     std::size_t ListView::getItemCount() const
     {
+        if (m_dataProvider)
+            return m_dataProvider->getRowCount();
+
         return m_items.size();
     }
 
@@ -548,13 +611,16 @@ namespace tgui
 
     sf::String ListView::getItem(std::size_t index) const
     {
-        if (index >= m_items.size())
+        if (index >= getItemCount())
             return "";
 
+        if (m_dataProvider)
+            return m_dataProvider->getCellText(index, 0);
+
         if (m_items[index].texts.empty())
             return "";
 
-        return m_items[index].texts[0].getString();
+        return m_items[index].texts[0];
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -562,10 +628,15 @@ namespace tgui
     std::vector<sf::String> ListView::getItemRow(std::size_t index) const
     {
         std::vector<sf::String> row;
-        if (index < m_items.size())
+        if (index < getItemCount())
         {
-            for (const auto& text : m_items[index].texts)
-                row.push_back(text.getString());
+            if (m_dataProvider)
+            {
+                for (std::size_t column = 0; column < std::max<std::size_t>(1, m_columns.size()); ++column)
+                    row.push_back(m_dataProvider->getCellText(index, column));
+            }
+            else
+                row = m_items[index].texts;
         }
 
         row.resize(std::max<std::size_t>(1, m_columns.size()));
@@ -578,12 +649,22 @@ namespace tgui
     {
         std::vector<sf::String> items;
 
+        if (m_dataProvider)
+        {
+            const std::size_t rowCount = m_dataProvider->getRowCount();
+            items.reserve(rowCount);
+            for (std::size_t i = 0; i < rowCount; ++i)
+                items.push_back(m_dataProvider->getCellText(i, 0));
+
+            return items;
+        }
+
         for (const auto& item : m_items)
         {
             if (item.texts.empty())
                 items.push_back("");
             else
-                items.push_back(item.texts[0].getString());
+                items.push_back(item.texts[0]);
         }
 
         return items;
@@ -595,12 +676,19 @@ namespace tgui
     {
         std::vector<std::vector<sf::String>> rows;
 
-        for (const auto& item : m_items)
+        if (m_dataProvider)
         {
-            std::vector<sf::String> row;
-            for (const auto& text : item.texts)
-                row.push_back(text.getString());
+            const std::size_t rowCount = m_dataProvider->getRowCount();
+            rows.reserve(rowCount);
+            for (std::size_t i = 0; i < rowCount; ++i)
+                rows.push_back(getItemRow(i));
+
+            return rows;
+        }
 
+        for (const auto& item : m_items)
+        {
+            std::vector<sf::String> row = item.texts;
             row.resize(std::max<std::size_t>(1, m_columns.size()));
             rows.push_back(std::move(row));
         }
@@ -610,6 +698,89 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void ListView::setDataProvider(ItemDataProvider::Ptr provider)
+    {
+        // The selection has to be cleared while the rows of the old provider can still be accessed
+        updateSelectedItem(-1);
+        updateHoveredItem(-1);
+
+        m_dataProvider = nullptr;
+        removeAllItems();
+
+        m_dataProvider = std::move(provider);
+        updateVerticalScrollbarMaximum();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    ItemDataProvider::Ptr ListView::getDataProvider() const
+    {
+        return m_dataProvider;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListView::notifyItemsInserted(std::size_t index, std::size_t count)
+    {
+        if (count == 0)
+            return;
+
+        // Shift the indices of the selected and hovered items without triggering callbacks, they still refer to the same rows
+        if (m_selectedItem >= static_cast<int>(index))
+            m_selectedItem += static_cast<int>(count);
+        if (m_hoveredItem >= static_cast<int>(index))
+            m_hoveredItem += static_cast<int>(count);
+
+        // Texts of visible rows are only recreated when the visible rows have moved
+        if (index < m_firstVisibleItem + m_visibleItemTexts.size())
+            m_visibleItemTexts.clear();
+
+        updateVerticalScrollbarMaximum();
+
+        // Scroll down when auto-scrolling is enabled
+        if (m_autoScroll && (m_verticalScrollbar->getViewportSize() < m_verticalScrollbar->getMaximum()))
+            m_verticalScrollbar->setValue(m_verticalScrollbar->getMaximum() - m_verticalScrollbar->getViewportSize());
+
+        invalidate();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListView::notifyItemsRemoved(std::size_t index, std::size_t count)
+    {
+        if (count == 0)
+            return;
+
+        if (m_hoveredItem >= static_cast<int>(index + count))
+            m_hoveredItem -= static_cast<int>(count);
+        else if (m_hoveredItem >= static_cast<int>(index))
+            updateHoveredItem(-1);
+
+        if (m_selectedItem >= static_cast<int>(index + count))
+            m_selectedItem -= static_cast<int>(count);
+        else if (m_selectedItem >= static_cast<int>(index))
+            updateSelectedItem(-1);
+
+        if (index < m_firstVisibleItem + m_visibleItemTexts.size())
+            m_visibleItemTexts.clear();
+
+        updateVerticalScrollbarMaximum();
+        invalidate();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListView::notifyItemsChanged(std::size_t index, std::size_t count)
+    {
+        // Only the texts of the changed rows that are currently visible have to be recreated
+        if ((index < m_firstVisibleItem + m_visibleItemTexts.size()) && (index + count > m_firstVisibleItem))
+            m_visibleItemTexts.clear();
+
+        invalidate();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void ListView::setItemHeight(unsigned int itemHeight)
     {
         // Set the new heights
@@ -617,11 +788,7 @@ namespace tgui
         if (m_requestedTextSize == 0)
         {
             m_textSize = Text::findBestTextSize(m_fontCached, itemHeight * 0.8f);
-            for (auto& item : m_items)
-            {
-                for (auto& text : item.texts)
-                    text.setCharacterSize(m_textSize);
-            }
+            m_visibleItemTexts.clear();
         }
 
         updateVerticalScrollbarMaximum();
@@ -645,17 +812,15 @@ namespace tgui
         else
             m_textSize = Text::findBestTextSize(m_fontCached, m_itemHeight * 0.8f);
 
-        for (auto& item : m_items)
-        {
-            for (auto& text : item.texts)
-                text.setCharacterSize(m_textSize);
-        }
+        m_visibleItemTexts.clear();
 
         const unsigned int headerTextSize = getHeaderTextSize();
         for (Column& column : m_columns)
             column.text.setCharacterSize(headerTextSize);
 
         m_horizontalScrollbar->setScrollAmount(m_textSize);
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -788,6 +953,7 @@ namespace tgui
     void ListView::setExpandLastColumn(bool expand)
     {
         m_expandLastColumn = expand;
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1033,33 +1199,36 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    Signal& ListView::getSignal(std::string signalName)
+    Signal* ListView::getSignal(std::uint64_t signalNameHash)
     {
-        if (signalName == toLower(onItemSelect.getName()))
-            return onItemSelect;
-        else if (signalName == toLower(onDoubleClick.getName()))
-            return onDoubleClick;
-        else if (signalName == toLower(onRightClick.getName()))
-            return onRightClick;
-        else
-            return Widget::getSignal(std::move(signalName));
+        switch (signalNameHash)
+        {
+            case hashSignalName("ItemSelected"):
+                return &onItemSelect;
+            case hashSignalName("DoubleClicked"):
+                return &onDoubleClick;
+            case hashSignalName("RightClicked"):
+                return &onRightClick;
+            default:
+                return Widget::getSignal(signalNameHash);
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void ListView::rendererChanged(const std::string& property)
+    void ListView::rendererChanged(RendererProperty property)
     {
-        if (property == "borders")
+        if (property == RendererProperty::Borders)
         {
             m_bordersCached = getSharedRenderer()->getBorders();
-            setSize(m_size);
+            requestSizeUpdate();
         }
-        else if (property == "padding")
+        else if (property == RendererProperty::Padding)
         {
             m_paddingCached = getSharedRenderer()->getPadding();
-            setSize(m_size);
+            requestSizeUpdate();
         }
-        else if (property == "textcolor")
+        else if (property == RendererProperty::TextColor)
         {
             m_textColorCached = getSharedRenderer()->getTextColor();
             updateItemColors();
@@ -1067,22 +1236,22 @@ namespace tgui
             if (!m_headerTextColorCached.isSet())
                 updateHeaderTextsColor();
         }
-        else if (property == "textcolorhover")
+        else if (property == RendererProperty::TextColorHover)
         {
             m_textColorHoverCached = getSharedRenderer()->getTextColorHover();
             updateItemColors();
         }
-        else if (property == "selectedtextcolor")
+        else if (property == RendererProperty::SelectedTextColor)
         {
             m_selectedTextColorCached = getSharedRenderer()->getSelectedTextColor();
             updateItemColors();
         }
-        else if (property == "selectedtextcolorhover")
+        else if (property == RendererProperty::SelectedTextColorHover)
         {
             m_selectedTextColorHoverCached = getSharedRenderer()->getSelectedTextColorHover();
             updateItemColors();
         }
-        else if (property == "scrollbar")
+        else if (property == RendererProperty::Scrollbar)
         {
             m_verticalScrollbar->setRenderer(getSharedRenderer()->getScrollbar());
             m_horizontalScrollbar->setRenderer(getSharedRenderer()->getScrollbar());
@@ -1092,54 +1261,54 @@ namespace tgui
             {
                 m_verticalScrollbar->setSize({m_verticalScrollbar->getDefaultWidth(), m_verticalScrollbar->getSize().y});
                 m_horizontalScrollbar->setSize({m_horizontalScrollbar->getSize().x, m_horizontalScrollbar->getDefaultWidth()});
-                setSize(m_size);
+                requestSizeUpdate();
             }
         }
-        else if (property == "scrollbarwidth")
+        else if (property == RendererProperty::ScrollbarWidth)
         {
             const float width = getSharedRenderer()->getScrollbarWidth() ? getSharedRenderer()->getScrollbarWidth() : m_verticalScrollbar->getDefaultWidth();
             m_verticalScrollbar->setSize({width, m_verticalScrollbar->getSize().y});
             m_horizontalScrollbar->setSize({m_verticalScrollbar->getSize().x, width});
-            setSize(m_size);
+            requestSizeUpdate();
         }
-        else if (property == "bordercolor")
+        else if (property == RendererProperty::BorderColor)
         {
             m_borderColorCached = getSharedRenderer()->getBorderColor();
         }
-        else if (property == "separatorcolor")
+        else if (property == RendererProperty::SeparatorColor)
         {
             m_separatorColorCached = getSharedRenderer()->getSeparatorColor();
         }
-        else if (property == "gridlinescolor")
+        else if (property == RendererProperty::GridLinesColor)
         {
             m_gridLinesColorCached = getSharedRenderer()->getGridLinesColor();
         }
-        else if (property == "headertextcolor")
+        else if (property == RendererProperty::HeaderTextColor)
         {
             m_headerTextColorCached = getSharedRenderer()->getHeaderTextColor();
             updateHeaderTextsColor();
         }
-        else if (property == "headerbackgroundcolor")
+        else if (property == RendererProperty::HeaderBackgroundColor)
         {
             m_headerBackgroundColorCached = getSharedRenderer()->getHeaderBackgroundColor();
         }
-        else if (property == "backgroundcolor")
+        else if (property == RendererProperty::BackgroundColor)
         {
             m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
         }
-        else if (property == "backgroundcolorhover")
+        else if (property == RendererProperty::BackgroundColorHover)
         {
             m_backgroundColorHoverCached = getSharedRenderer()->getBackgroundColorHover();
         }
-        else if (property == "selectedbackgroundcolor")
+        else if (property == RendererProperty::SelectedBackgroundColor)
         {
             m_selectedBackgroundColorCached = getSharedRenderer()->getSelectedBackgroundColor();
         }
-        else if (property == "selectedbackgroundcolorhover")
+        else if (property == RendererProperty::SelectedBackgroundColorHover)
         {
             m_selectedBackgroundColorHoverCached = getSharedRenderer()->getSelectedBackgroundColorHover();
         }
-        else if ((property == "opacity") || (property == "opacitydisabled"))
+        else if ((property == RendererProperty::Opacity) || (property == RendererProperty::OpacityDisabled))
         {
             Widget::rendererChanged(property);
 
@@ -1149,36 +1318,28 @@ namespace tgui
             for (auto& column : m_columns)
                 column.text.setOpacity(m_opacityCached);
 
-            for (auto& item : m_items)
+            for (auto& texts : m_visibleItemTexts)
             {
-                for (auto& text : item.texts)
+                for (auto& text : texts)
                     text.setOpacity(m_opacityCached);
+            }
 
+            for (auto& item : m_items)
                 item.icon.setOpacity(m_opacityCached);
-            }
         }
-        else if (property == "font")
+        else if (property == RendererProperty::Font)
         {
             Widget::rendererChanged(property);
 
             for (auto& column : m_columns)
                 column.text.setFont(m_fontCached);
 
-            for (auto& item : m_items)
-            {
-                for (auto& text : item.texts)
-                    text.setFont(m_fontCached);
-            }
+            m_visibleItemTexts.clear();
 
             // Recalculate the text size with the new font
             if (m_requestedTextSize == 0)
             {
                 m_textSize = Text::findBestTextSize(m_fontCached, m_itemHeight * 0.8f);
-                for (auto& item : m_items)
-                {
-                    for (auto& text : item.texts)
-                        text.setCharacterSize(m_textSize);
-                }
 
                 if (!m_headerTextSize)
                 {
@@ -1229,9 +1390,9 @@ namespace tgui
 
             if (!item.texts.empty())
             {
-                std::string textsList = "[" + Serializer::serialize(item.texts[0].getString());
+                std::string textsList = "[" + Serializer::serialize(item.texts[0]);
                 for (std::size_t i = 1; i < item.texts.size(); ++i)
-                    textsList += ", " + Serializer::serialize(item.texts[i].getString());
+                    textsList += ", " + Serializer::serialize(item.texts[i]);
                 textsList += "]";
 
                 itemNode->propertyValuePairs["Texts"] = std::make_unique<DataIO::ValueNode>(textsList);
@@ -1400,7 +1561,7 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    Text ListView::createText(const sf::String& caption)
+    Text ListView::createText(const sf::String& caption) const
     {
         Text text;
         text.setFont(m_fontCached);
@@ -1431,9 +1592,32 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void ListView::setItemColor(std::size_t index, const Color& color)
+    Color ListView::getItemTextColor(std::size_t index) const
+    {
+        if (static_cast<int>(index) == m_selectedItem)
+        {
+            if ((m_selectedItem == m_hoveredItem) && m_selectedTextColorHoverCached.isSet())
+                return m_selectedTextColorHoverCached;
+            else if (m_selectedTextColorCached.isSet())
+                return m_selectedTextColorCached;
+            else
+                return m_textColorCached;
+        }
+        else if ((static_cast<int>(index) == m_hoveredItem) && m_textColorHoverCached.isSet())
+            return m_textColorHoverCached;
+        else
+            return m_textColorCached;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListView::updateItemColor(std::size_t index)
     {
-        for (auto& text : m_items[index].texts)
+        if ((index < m_firstVisibleItem) || (index >= m_firstVisibleItem + m_visibleItemTexts.size()))
+            return;
+
+        const Color color = getItemTextColor(index);
+        for (auto& text : m_visibleItemTexts[index - m_firstVisibleItem])
             text.setColor(color);
     }
 
@@ -1449,28 +1633,18 @@ namespace tgui
     void ListView::updateSelectedAndhoveredItemColors()
     {
         if (m_selectedItem >= 0)
-        {
-            if ((m_selectedItem == m_hoveredItem) && m_selectedTextColorHoverCached.isSet())
-                setItemColor(m_selectedItem, m_selectedTextColorHoverCached);
-            else if (m_selectedTextColorCached.isSet())
-                setItemColor(m_selectedItem, m_selectedTextColorCached);
-        }
+            updateItemColor(m_selectedItem);
 
         if ((m_hoveredItem >= 0) && (m_selectedItem != m_hoveredItem))
-        {
-            if (m_textColorHoverCached.isSet())
-                setItemColor(m_hoveredItem, m_textColorHoverCached);
-        }
+            updateItemColor(m_hoveredItem);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void ListView::updateItemColors()
     {
-        for (std::size_t i = 0; i < m_items.size(); ++i)
-            setItemColor(i, m_textColorCached);
-
-        updateSelectedAndhoveredItemColors();
+        for (std::size_t i = m_firstVisibleItem; i < m_firstVisibleItem + m_visibleItemTexts.size(); ++i)
+            updateItemColor(i);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1493,16 +1667,12 @@ namespace tgui
         if (m_hoveredItem == item)
             return;
 
-        if (m_hoveredItem >= 0)
-        {
-            if ((m_selectedItem == m_hoveredItem) && m_selectedTextColorCached.isSet())
-                setItemColor(m_hoveredItem, m_selectedTextColorCached);
-            else
-                setItemColor(m_hoveredItem, m_textColorCached);
-        }
-
+        const int oldHoveredItem = m_hoveredItem;
         m_hoveredItem = item;
 
+        if (oldHoveredItem >= 0)
+            updateItemColor(oldHoveredItem);
+
         updateSelectedAndhoveredItemColors();
     }
 
@@ -1513,18 +1683,17 @@ namespace tgui
         if (m_selectedItem == item)
             return;
 
-        if (m_selectedItem >= 0)
-        {
-            if ((m_selectedItem == m_hoveredItem) && m_textColorHoverCached.isSet())
-                setItemColor(m_selectedItem, m_textColorHoverCached);
-            else
-                setItemColor(m_selectedItem, m_textColorCached);
-        }
-
+        const int oldSelectedItem = m_selectedItem;
         m_selectedItem = item;
+
+        if (oldSelectedItem >= 0)
+            updateItemColor(oldSelectedItem);
+
         onItemSelect.emit(this, m_selectedItem);
 
         updateSelectedAndhoveredItemColors();
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1539,7 +1708,7 @@ namespace tgui
         else
             hoveredItem = static_cast<int>(std::ceil((mousePos.y + m_verticalScrollbar->getValue() - m_itemHeight + 1) / m_itemHeight));
 
-        if ((hoveredItem >= 0) && (hoveredItem < static_cast<int>(m_items.size())))
+        if ((hoveredItem >= 0) && (hoveredItem < static_cast<int>(getItemCount())))
             updateHoveredItem(hoveredItem);
         else
             updateHoveredItem(-1);
@@ -1583,6 +1752,8 @@ namespace tgui
         // If the scrollbar was at the bottom then keep it at the bottom if it changes due to a different viewport size
         if (verticalScrollbarAtBottom && (m_verticalScrollbar->getValue() + m_verticalScrollbar->getViewportSize() < m_verticalScrollbar->getMaximum()))
             m_verticalScrollbar->setValue(m_verticalScrollbar->getMaximum() - m_verticalScrollbar->getViewportSize());
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1591,9 +1762,10 @@ namespace tgui
     {
         const bool verticalScrollbarAtBottom = (m_verticalScrollbar->getValue() + m_verticalScrollbar->getViewportSize() >= m_verticalScrollbar->getMaximum());
 
-        unsigned int maximum = static_cast<unsigned int>(m_items.size() * m_itemHeight);
-        if (m_showHorizontalGridLines && (m_gridLinesWidth > 0) && !m_items.empty())
-            maximum += static_cast<unsigned int>((m_items.size() - 1) * m_gridLinesWidth);
+        const std::size_t itemCount = getItemCount();
+        unsigned int maximum = static_cast<unsigned int>(itemCount * m_itemHeight);
+        if (m_showHorizontalGridLines && (m_gridLinesWidth > 0) && (itemCount > 0))
+            maximum += static_cast<unsigned int>((itemCount - 1) * m_gridLinesWidth);
 
         m_verticalScrollbar->setMaximum(maximum);
         updateScrollbars();
@@ -1642,7 +1814,17 @@ namespace tgui
         const unsigned int headerTextSize = getHeaderTextSize();
         const float textPadding = Text::getExtraHorizontalOffset(m_fontCached, headerTextSize);
 
-        const Clipping clipping{target, states, {textPadding, 0}, {columnWidth - (2 * textPadding), headerHeight}};
+        // Only clip the text when it doesn't fit inside the header
+        const Vector2f clipSize{columnWidth - (2 * textPadding), headerHeight};
+    #ifdef TGUI_USE_CPP17
+        std::optional<Clipping> clipping;
+        if ((m_columns[column].text.getSize().x > clipSize.x) || (m_columns[column].text.getSize().y > clipSize.y))
+            clipping.emplace(target, states, Vector2f{textPadding, 0}, clipSize);
+    #else
+        std::unique_ptr<Clipping> clipping;
+        if ((m_columns[column].text.getSize().x > clipSize.x) || (m_columns[column].text.getSize().y > clipSize.y))
+            clipping = std::make_unique<Clipping>(target, states, Vector2f{textPadding, 0}, clipSize);
+    #endif
 
         float translateX;
         if ((m_columns[column].alignment == ColumnAlignment::Left) || (column >= m_columns.size()))
@@ -1674,7 +1856,18 @@ namespace tgui
         if ((column == 0) && (m_iconCount > 0))
         {
             const sf::Transform transformBeforeIcons = states.transform;
-            const Clipping clipping{target, states, {textPadding, 0}, {columnWidth - (2 * textPadding), columnHeight}};
+
+            // The caller already clips the items vertically, the column only needs its own clipping when an icon is too wide
+            const Vector2f clipSize{columnWidth - (2 * textPadding), columnHeight};
+        #ifdef TGUI_USE_CPP17
+            std::optional<Clipping> clipping;
+            if (m_maxIconWidth > clipSize.x)
+                clipping.emplace(target, states, Vector2f{textPadding, 0}, clipSize);
+        #else
+            std::unique_ptr<Clipping> clipping;
+            if (m_maxIconWidth > clipSize.x)
+                clipping = std::make_unique<Clipping>(target, states, Vector2f{textPadding, 0}, clipSize);
+        #endif
 
             states.transform.translate({0, (requiredItemHeight * firstItem) - static_cast<float>(m_verticalScrollbar->getValue())});
 
@@ -1700,12 +1893,31 @@ namespace tgui
             states.transform.translate({extraIconSpace, 0});
         }
 
-        const Clipping clipping{target, states, {textPadding, 0}, {columnWidth - (2 * textPadding), columnHeight}};
+        float maxTextWidth = 0;
+        for (std::size_t i = firstItem; i < lastItem; ++i)
+        {
+            const auto& texts = m_visibleItemTexts[i - m_firstVisibleItem];
+            if (column < texts.size())
+                maxTextWidth = std::max(maxTextWidth, texts[column].getSize().x);
+        }
+
+        // The caller already clips the items vertically, the column only needs its own clipping when a text is too wide
+        const Vector2f clipSize{columnWidth - (2 * textPadding), columnHeight};
+    #ifdef TGUI_USE_CPP17
+        std::optional<Clipping> clipping;
+        if (maxTextWidth > clipSize.x)
+            clipping.emplace(target, states, Vector2f{textPadding, 0}, clipSize);
+    #else
+        std::unique_ptr<Clipping> clipping;
+        if (maxTextWidth > clipSize.x)
+            clipping = std::make_unique<Clipping>(target, states, Vector2f{textPadding, 0}, clipSize);
+    #endif
 
         states.transform.translate({0, (requiredItemHeight * firstItem) - static_cast<float>(m_verticalScrollbar->getValue())});
         for (std::size_t i = firstItem; i < lastItem; ++i)
         {
-            if (column >= m_items[i].texts.size())
+            const auto& texts = m_visibleItemTexts[i - m_firstVisibleItem];
+            if (column >= texts.size())
             {
                 states.transform.translate({0, static_cast<float>(requiredItemHeight)});
                 continue;
@@ -1715,18 +1927,62 @@ namespace tgui
             if ((column >= m_columns.size()) || (m_columns[column].alignment == ColumnAlignment::Left))
                 translateX = textPadding;
             else if (m_columns[column].alignment == ColumnAlignment::Center)
-                translateX = (columnWidth - m_items[i].texts[column].getSize().x) / 2.f;
+                translateX = (columnWidth - texts[column].getSize().x) / 2.f;
             else // if (m_columns[column].alignment == ColumnAlignment::Right)
-                translateX = columnWidth - textPadding - m_items[i].texts[column].getSize().x;
+                translateX = columnWidth - textPadding - texts[column].getSize().x;
 
             states.transform.translate({translateX, verticalTextOffset});
-            m_items[i].texts[column].draw(target, states);
+            texts[column].draw(target, states);
             states.transform.translate({-translateX, static_cast<float>(requiredItemHeight) - verticalTextOffset});
         }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void ListView::updateVisibleItemTexts(std::size_t firstItem, std::size_t lastItem) const
+    {
+        if ((firstItem == m_firstVisibleItem) && (lastItem - firstItem == m_visibleItemTexts.size()))
+            return;
+
+        // Reuse the texts of items that were already visible and only create texts for the items that became visible
+        std::vector<std::vector<Text>> visibleItemTexts(lastItem - firstItem);
+        for (std::size_t i = firstItem; i < lastItem; ++i)
+        {
+            if ((i >= m_firstVisibleItem) && (i < m_firstVisibleItem + m_visibleItemTexts.size()))
+            {
+                visibleItemTexts[i - firstItem] = std::move(m_visibleItemTexts[i - m_firstVisibleItem]);
+                continue;
+            }
+
+            const Color color = getItemTextColor(i);
+            auto& texts = visibleItemTexts[i - firstItem];
+            if (m_dataProvider)
+            {
+                const std::size_t columnCount = std::max<std::size_t>(1, m_columns.size());
+                texts.reserve(columnCount);
+                for (std::size_t column = 0; column < columnCount; ++column)
+                {
+                    texts.push_back(createText(m_dataProvider->getCellText(i, column)));
+                    texts.back().setColor(color);
+                }
+            }
+            else
+            {
+                texts.reserve(m_items[i].texts.size());
+                for (const auto& string : m_items[i].texts)
+                {
+                    texts.push_back(createText(string));
+                    texts.back().setColor(color);
+                }
+            }
+        }
+
+        m_visibleItemTexts = std::move(visibleItemTexts);
+        m_firstVisibleItem = firstItem;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void ListView::update(sf::Time elapsedTime)
     {
         Widget::update(elapsedTime);
@@ -1759,15 +2015,18 @@ namespace tgui
 
         // Find out which items are visible
         std::size_t firstItem = 0;
-        std::size_t lastItem = m_items.size();
+        const std::size_t itemCount = getItemCount();
+        std::size_t lastItem = itemCount;
         if (m_verticalScrollbar->getViewportSize() < m_verticalScrollbar->getMaximum())
         {
             firstItem = m_verticalScrollbar->getValue() / totalItemHeight;
             lastItem = ((m_verticalScrollbar->getValue() + m_verticalScrollbar->getViewportSize()) / totalItemHeight) + 1;
-            if (lastItem > m_items.size())
-                lastItem = m_items.size();
+            if (lastItem > itemCount)
+                lastItem = itemCount;
         }
 
+        updateVisibleItemTexts(firstItem, lastItem);
+
         states.transform.translate({m_paddingCached.getLeft(), m_paddingCached.getTop()});
 
         // Draw the scrollbars
@@ -1810,7 +2069,7 @@ namespace tgui
             const Clipping clipping{target, states, {}, {availableWidth, innerHeight - totalHeaderHeight}};
 
             // Draw the horizontal grid lines
-            if (m_showHorizontalGridLines && (m_gridLinesWidth > 0) && !m_items.empty())
+            if (m_showHorizontalGridLines && (m_gridLinesWidth > 0) && (itemCount > 0))
             {
                 sf::Transform transformBeforeGridLines = states.transform;
 
@@ -1889,7 +2148,9 @@ namespace tgui
             states.transform.translate({0, totalHeaderHeight});
         }
 
-        // Draw the items and the separation lines
+        // Draw the items and the separation lines. All columns share the same clipping below the header.
+        const float horizontalScroll = m_horizontalScrollbar->isShown() ? static_cast<float>(m_horizontalScrollbar->getValue()) : 0.f;
+        const Clipping itemsClipping{target, states, {horizontalScroll, 0}, {availableWidth, innerHeight - totalHeaderHeight}};
         if (m_columns.empty())
             drawColumn(target, states, firstItem, lastItem, 0, getInnerSize().x - m_paddingCached.getLeft() - m_paddingCached.getRight());
         else
@@ -34,6 +34,15 @@ namespace tgui
 {
     namespace
     {
+        FloatRect combineRects(const FloatRect& left, const FloatRect& right)
+        {
+            const float minX = std::min(left.left, right.left);
+            const float minY = std::min(left.top, right.top);
+            const float maxX = std::max(left.left + left.width, right.left + right.width);
+            const float maxY = std::max(left.top + left.height, right.top + right.height);
+            return {minX, minY, maxX - minX, maxY - minY};
+        }
+
         bool removeMenuImpl(const std::vector<sf::String>& hierarchy, bool removeParentsWhenEmpty, unsigned int parentIndex, std::vector<MenuBar::Menu>& menus)
         {
             for (auto it = menus.begin(); it != menus.end(); ++it)
@@ -187,6 +196,7 @@ namespace tgui
     MenuBar::MenuBar()
     {
         m_type = "MenuBar";
+        m_renderBatchType = &typeid(MenuBar);
         m_distanceToSideCached = Text::getLineHeight(m_fontCached, getGlobalTextSize()) * 0.4f;
 
         m_renderer = aurora::makeCopied<MenuBarRenderer>();
@@ -269,6 +279,7 @@ namespace tgui
     void MenuBar::addMenu(const sf::String& text)
     {
         createMenu(m_menus, text);
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -300,6 +311,7 @@ namespace tgui
             return false;
 
         createMenu(menu->menuItems, hierarchy.back());
+        invalidate();
         return true;
     }
 
@@ -308,6 +320,7 @@ namespace tgui
     void MenuBar::removeAllMenus()
     {
         m_menus.clear();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -325,6 +338,7 @@ namespace tgui
             if (m_visibleMenu == static_cast<int>(i))
                 m_visibleMenu = -1;
 
+            invalidate();
             return true;
         }
 
@@ -343,6 +357,8 @@ namespace tgui
 
     bool MenuBar::removeMenuItem(const std::vector<sf::String>& hierarchy, bool removeParentsWhenEmpty)
     {
+        invalidate();
+
         if (hierarchy.size() < 2)
             return false;
 
@@ -360,6 +376,8 @@ namespace tgui
 
     bool MenuBar::removeSubMenuItems(const std::vector<sf::String>& hierarchy)
     {
+        invalidate();
+
         if (hierarchy.empty())
             return false;
 
@@ -380,6 +398,7 @@ namespace tgui
 
             m_menus[i].enabled = enabled;
             updateMenuTextColor(m_menus[i], (m_visibleMenu == static_cast<int>(i)));
+            invalidate();
             return true;
         }
 
@@ -428,6 +447,7 @@ namespace tgui
 
             menuItem.enabled = enabled;
             updateMenuTextColor(menuItem, (menu->selectedMenuItem == static_cast<int>(j)));
+            invalidate();
             return true;
         }
 
@@ -461,6 +481,8 @@ namespace tgui
     {
         m_textSize = size;
         setTextSizeImpl(m_menus, size);
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -475,6 +497,7 @@ namespace tgui
     void MenuBar::setMinimumSubMenuWidth(float minimumWidth)
     {
         m_minimumSubMenuWidth = minimumWidth;
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -489,6 +512,7 @@ namespace tgui
     void MenuBar::setInvertedMenuDirection(bool invertDirection)
     {
         m_invertedMenuDirection = invertDirection;
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -542,6 +566,35 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    FloatRect MenuBar::getDrawBounds() const
+    {
+        const FloatRect barBounds{getPosition(), getSize()};
+        if (m_visibleMenu == -1)
+            return barBounds;
+
+        // Find the position of the open menu in the same way as the draw function does
+        Vector2f menuPos = getPosition();
+        for (int i = 0; i < m_visibleMenu; ++i)
+            menuPos.x += m_menus[i].text.getSize().x + (2 * m_distanceToSideCached);
+
+        if (m_invertedMenuDirection)
+            menuPos.y -= getSize().y * m_menus[m_visibleMenu].menuItems.size();
+        else
+            menuPos.y += getSize().y;
+
+        bool openSubMenuToRight = true;
+        const float menuWidth = calculateMenuWidth(m_menus[m_visibleMenu]);
+        if (getParent() && (menuPos.x + menuWidth > getParent()->getInnerSize().x))
+        {
+            menuPos.x = std::max(0.f, getParent()->getInnerSize().x - menuWidth);
+            openSubMenuToRight = false;
+        }
+
+        return combineRects(barBounds, calculateMenuBounds(menuPos, openSubMenuToRight, m_menus[m_visibleMenu], menuWidth));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     bool MenuBar::mouseOnWidget(Vector2f pos) const
     {
         if (FloatRect{getPosition().x, getPosition().y, getSize().x, getSize().y}.contains(pos))
@@ -766,64 +819,67 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    Signal& MenuBar::getSignal(std::string signalName)
+    Signal* MenuBar::getSignal(std::uint64_t signalNameHash)
     {
-        if (signalName == toLower(onMenuItemClick.getName()))
-            return onMenuItemClick;
-        else
-            return Widget::getSignal(std::move(signalName));
+        switch (signalNameHash)
+        {
+            case hashSignalName("MenuItemClicked"):
+                return &onMenuItemClick;
+            default:
+                return Widget::getSignal(signalNameHash);
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void MenuBar::rendererChanged(const std::string& property)
+    void MenuBar::rendererChanged(RendererProperty property)
     {
-        if (property == "textcolor")
+        if (property == RendererProperty::TextColor)
         {
             m_textColorCached = getSharedRenderer()->getTextColor();
             updateTextColors(m_menus, m_visibleMenu);
         }
-        else if (property == "selectedtextcolor")
+        else if (property == RendererProperty::SelectedTextColor)
         {
             m_selectedTextColorCached = getSharedRenderer()->getSelectedTextColor();
             updateTextColors(m_menus, m_visibleMenu);
         }
-        else if (property == "textcolordisabled")
+        else if (property == RendererProperty::TextColorDisabled)
         {
             m_textColorDisabledCached = getSharedRenderer()->getTextColorDisabled();
             updateTextColors(m_menus, m_visibleMenu);
         }
-        else if (property == "texturebackground")
+        else if (property == RendererProperty::TextureBackground)
         {
             m_spriteBackground.setTexture(getSharedRenderer()->getTextureBackground());
         }
-        else if (property == "textureitembackground")
+        else if (property == RendererProperty::TextureItemBackground)
         {
             m_spriteItemBackground.setTexture(getSharedRenderer()->getTextureItemBackground());
         }
-        else if (property == "textureselecteditembackground")
+        else if (property == RendererProperty::TextureSelectedItemBackground)
         {
             m_spriteSelectedItemBackground.setTexture(getSharedRenderer()->getTextureSelectedItemBackground());
         }
-        else if (property == "backgroundcolor")
+        else if (property == RendererProperty::BackgroundColor)
         {
             m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
         }
-        else if (property == "selectedbackgroundcolor")
+        else if (property == RendererProperty::SelectedBackgroundColor)
         {
             m_selectedBackgroundColorCached = getSharedRenderer()->getSelectedBackgroundColor();
         }
-        else if (property == "distancetoside")
+        else if (property == RendererProperty::DistanceToSide)
         {
             m_distanceToSideCached = getSharedRenderer()->getDistanceToSide();
         }
-        else if ((property == "opacity") || (property == "opacitydisabled"))
+        else if ((property == RendererProperty::Opacity) || (property == RendererProperty::OpacityDisabled))
         {
             Widget::rendererChanged(property);
             updateTextOpacity(m_menus);
             m_spriteBackground.setOpacity(m_opacityCached);
         }
-        else if (property == "font")
+        else if (property == RendererProperty::Font)
         {
             Widget::rendererChanged(property);
             updateTextFont(m_menus);
@@ -1211,6 +1267,21 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    FloatRect MenuBar::calculateMenuBounds(Vector2f menuPos, bool openSubMenuToRight, const Menu& menu, float menuWidth) const
+    {
+        FloatRect bounds{menuPos.x, menuPos.y, menuWidth, menu.menuItems.size() * getSize().y};
+        if ((menu.selectedMenuItem >= 0) && !menu.menuItems[menu.selectedMenuItem].menuItems.empty())
+        {
+            const float subMenuWidth = calculateMenuWidth(menu.menuItems[menu.selectedMenuItem]);
+            const Vector2f offset = calculateSubmenuOffset(menu, menuPos.x, menuWidth, subMenuWidth, openSubMenuToRight);
+            bounds = combineRects(bounds, calculateMenuBounds(menuPos + offset, openSubMenuToRight, menu.menuItems[menu.selectedMenuItem], subMenuWidth));
+        }
+
+        return bounds;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     bool MenuBar::findMenuItemBelowMouse(Vector2f menuPos, Vector2f mousePos, bool openSubMenuToRight, Menu& menu, float menuWidth, Menu** resultMenu, int* resultSelectedMenuItem)
     {
         // Loop over the open submenus and make sure to handle them first as menus can overlap
@@ -1355,7 +1426,7 @@ namespace tgui
                 else
                     arrow.setFillColor(Color::calcColorOpacity(m_textColorCached, m_opacityCached));
 
-                target.draw(arrow, states);
+                RenderBatch::draw(target, arrow, states);
                 states.transform = textTransform;
             }
 
@@ -35,6 +35,7 @@ namespace tgui
     MessageBox::MessageBox()
     {
         m_type = "MessageBox";
+        m_renderBatchType = &typeid(MessageBox);
 
         m_renderer = aurora::makeCopied<MessageBoxRenderer>();
         setRenderer(Theme::getDefault()->getRendererNoThrow(m_type));
@@ -293,29 +294,32 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    Signal& MessageBox::getSignal(std::string signalName)
+    Signal* MessageBox::getSignal(std::uint64_t signalNameHash)
     {
-        if (signalName == toLower(onButtonPress.getName()))
-            return onButtonPress;
-        else
-            return ChildWindow::getSignal(std::move(signalName));
+        switch (signalNameHash)
+        {
+            case hashSignalName("ButtonPressed"):
+                return &onButtonPress;
+            default:
+                return ChildWindow::getSignal(signalNameHash);
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void MessageBox::rendererChanged(const std::string& property)
+    void MessageBox::rendererChanged(RendererProperty property)
     {
-        if (property == "textcolor")
+        if (property == RendererProperty::TextColor)
         {
             m_label->getRenderer()->setTextColor(getSharedRenderer()->getTextColor());
         }
-        else if (property == "button")
+        else if (property == RendererProperty::Button)
         {
             const auto& renderer = getSharedRenderer()->getButton();
             for (auto& button : m_buttons)
                 button->setRenderer(renderer);
         }
-        else if (property == "font")
+        else if (property == RendererProperty::Font)
         {
             ChildWindow::rendererChanged(property);
 
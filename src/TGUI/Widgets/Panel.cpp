@@ -35,6 +35,7 @@ namespace tgui
     Panel::Panel(const Layout2d& size)
     {
         m_type = "Panel";
+        m_renderBatchType = &typeid(Panel);
         m_isolatedFocus = true;
 
         m_renderer = aurora::makeCopied<PanelRenderer>();
@@ -147,32 +148,35 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    Signal& Panel::getSignal(std::string signalName)
+    Signal* Panel::getSignal(std::uint64_t signalNameHash)
     {
-        if (signalName == toLower(onMousePress.getName()))
-            return onMousePress;
-        else if (signalName == toLower(onMouseRelease.getName()))
-            return onMouseRelease;
-        else if (signalName == toLower(onClick.getName()))
-            return onClick;
-        else
-            return Group::getSignal(std::move(signalName));
+        switch (signalNameHash)
+        {
+            case hashSignalName("MousePressed"):
+                return &onMousePress;
+            case hashSignalName("MouseReleased"):
+                return &onMouseRelease;
+            case hashSignalName("Clicked"):
+                return &onClick;
+            default:
+                return Group::getSignal(signalNameHash);
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Panel::rendererChanged(const std::string& property)
+    void Panel::rendererChanged(RendererProperty property)
     {
-        if (property == "borders")
+        if (property == RendererProperty::Borders)
         {
             m_bordersCached = getSharedRenderer()->getBorders();
-            setSize(m_size);
+            requestSizeUpdate();
         }
-        else if (property == "bordercolor")
+        else if (property == RendererProperty::BorderColor)
         {
             m_borderColorCached = getSharedRenderer()->getBorderColor();
         }
-        else if (property == "backgroundcolor")
+        else if (property == RendererProperty::BackgroundColor)
         {
             m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
         }
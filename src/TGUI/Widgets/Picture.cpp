@@ -34,6 +34,7 @@ namespace tgui
     Picture::Picture()
     {
         m_type = "Picture";
+        m_renderBatchType = &typeid(Picture);
 
         m_renderer = aurora::makeCopied<PictureRenderer>();
         setRenderer(Theme::getDefault()->getRendererNoThrow(m_type));
@@ -165,19 +166,22 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    Signal& Picture::getSignal(std::string signalName)
+    Signal* Picture::getSignal(std::uint64_t signalNameHash)
     {
-        if (signalName == toLower(onDoubleClick.getName()))
-            return onDoubleClick;
-        else
-            return ClickableWidget::getSignal(std::move(signalName));
+        switch (signalNameHash)
+        {
+            case hashSignalName("DoubleClicked"):
+                return &onDoubleClick;
+            default:
+                return ClickableWidget::getSignal(signalNameHash);
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Picture::rendererChanged(const std::string& property)
+    void Picture::rendererChanged(RendererProperty property)
     {
-        if (property == "texture")
+        if (property == RendererProperty::Texture)
         {
             const auto& texture = getSharedRenderer()->getTexture();
 
@@ -185,8 +189,11 @@ namespace tgui
                 setSize(texture.getImageSize());
 
             m_sprite.setTexture(texture);
+
+            // The size of an image that is loaded asynchronously is only known once it has been loaded
+            callWhenTextureLoaded(texture);
         }
-        else if ((property == "opacity") || (property == "opacitydisabled"))
+        else if ((property == RendererProperty::Opacity) || (property == RendererProperty::OpacityDisabled))
         {
             Widget::rendererChanged(property);
             m_sprite.setOpacity(m_opacityCached);
@@ -197,6 +204,14 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Picture::textureLoaded()
+    {
+        if (getSize() == Vector2f{0,0})
+            setSize(m_sprite.getTexture().getImageSize());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     std::unique_ptr<DataIO::Node> Picture::save(SavingRenderersMap& renderers) const
     {
         auto node = Widget::save(renderers);
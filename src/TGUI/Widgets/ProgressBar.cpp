@@ -35,6 +35,7 @@ namespace tgui
     ProgressBar::ProgressBar()
     {
         m_type = "ProgressBar";
+        m_renderBatchType = &typeid(ProgressBar);
         m_textBack.setFont(m_fontCached);
         m_textFront.setFont(m_fontCached);
 
@@ -234,6 +235,8 @@ namespace tgui
         }
 
         m_textFront.setCharacterSize(m_textBack.getCharacterSize());
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -289,26 +292,29 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    Signal& ProgressBar::getSignal(std::string signalName)
+    Signal* ProgressBar::getSignal(std::uint64_t signalNameHash)
     {
-        if (signalName == toLower(onValueChange.getName()))
-            return onValueChange;
-        else if (signalName == toLower(onFull.getName()))
-            return onFull;
-        else
-            return ClickableWidget::getSignal(std::move(signalName));
+        switch (signalNameHash)
+        {
+            case hashSignalName("ValueChanged"):
+                return &onValueChange;
+            case hashSignalName("Full"):
+                return &onFull;
+            default:
+                return ClickableWidget::getSignal(signalNameHash);
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void ProgressBar::rendererChanged(const std::string& property)
+    void ProgressBar::rendererChanged(RendererProperty property)
     {
-        if (property == "borders")
+        if (property == RendererProperty::Borders)
         {
             m_bordersCached = getSharedRenderer()->getBorders();
-            setSize(m_size);
+            requestSizeUpdate();
         }
-        else if ((property == "textcolor") || (property == "textcolorfilled"))
+        else if ((property == RendererProperty::TextColor) || (property == RendererProperty::TextColorFilled))
         {
             m_textBack.setColor(getSharedRenderer()->getTextColor());
 
@@ -317,33 +323,33 @@ namespace tgui
             else
                 m_textFront.setColor(getSharedRenderer()->getTextColor());
         }
-        else if (property == "texturebackground")
+        else if (property == RendererProperty::TextureBackground)
         {
             m_spriteBackground.setTexture(getSharedRenderer()->getTextureBackground());
         }
-        else if (property == "texturefill")
+        else if (property == RendererProperty::TextureFill)
         {
             m_spriteFill.setTexture(getSharedRenderer()->getTextureFill());
             recalculateFillSize();
         }
-        else if (property == "textstyle")
+        else if (property == RendererProperty::TextStyle)
         {
             m_textBack.setStyle(getSharedRenderer()->getTextStyle());
             m_textFront.setStyle(getSharedRenderer()->getTextStyle());
         }
-        else if (property == "bordercolor")
+        else if (property == RendererProperty::BorderColor)
         {
             m_borderColorCached = getSharedRenderer()->getBorderColor();
         }
-        else if (property == "backgroundcolor")
+        else if (property == RendererProperty::BackgroundColor)
         {
             m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
         }
-        else if (property == "fillcolor")
+        else if (property == RendererProperty::FillColor)
         {
             m_fillColorCached = getSharedRenderer()->getFillColor();
         }
-        else if ((property == "opacity") || (property == "opacitydisabled"))
+        else if ((property == RendererProperty::Opacity) || (property == RendererProperty::OpacityDisabled))
         {
             Widget::rendererChanged(property);
 
@@ -353,7 +359,7 @@ namespace tgui
             m_textBack.setOpacity(m_opacityCached);
             m_textFront.setOpacity(m_opacityCached);
         }
-        else if (property == "font")
+        else if (property == RendererProperty::Font)
         {
             Widget::rendererChanged(property);
 
@@ -474,6 +480,8 @@ namespace tgui
 
         if (m_spriteFill.isSet())
             m_spriteFill.setVisibleRect(m_frontRect);
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -34,6 +34,7 @@ namespace tgui
     RadioButton::RadioButton()
     {
         m_type = "RadioButton";
+        m_renderBatchType = &typeid(RadioButton);
         m_text.setFont(m_fontCached);
 
         m_renderer = aurora::makeCopied<RadioButtonRenderer>();
@@ -153,6 +154,8 @@ namespace tgui
             m_text.setStyle(m_textStyleCheckedCached);
         else
             m_text.setStyle(m_textStyleCached);
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -167,6 +170,8 @@ namespace tgui
             m_text.setCharacterSize(Text::findBestTextSize(m_fontCached, getSize().y * 0.8f));
         else
             m_text.setCharacterSize(m_textSize);
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -275,34 +280,37 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    Signal& RadioButton::getSignal(std::string signalName)
+    Signal* RadioButton::getSignal(std::uint64_t signalNameHash)
     {
-        if (signalName == toLower(onCheck.getName()))
-            return onCheck;
-        else if (signalName == toLower(onUncheck.getName()))
-            return onUncheck;
-        else if (signalName == toLower(onChange.getName()))
-            return onChange;
-        else
-            return ClickableWidget::getSignal(std::move(signalName));
+        switch (signalNameHash)
+        {
+            case hashSignalName("Checked"):
+                return &onCheck;
+            case hashSignalName("Unchecked"):
+                return &onUncheck;
+            case hashSignalName("Changed"):
+                return &onChange;
+            default:
+                return ClickableWidget::getSignal(signalNameHash);
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void RadioButton::rendererChanged(const std::string& property)
+    void RadioButton::rendererChanged(RendererProperty property)
     {
-        if (property == "borders")
+        if (property == RendererProperty::Borders)
         {
             m_bordersCached = getSharedRenderer()->getBorders();
             m_bordersCached.updateParentSize(getSize());
             updateTextureSizes();
         }
-        else if ((property == "textcolor") || (property == "textcolorhover") || (property == "textcolordisabled")
-              || (property == "textcolorchecked") || (property == "textcolorcheckedhover") || (property == "textcolorcheckeddisabled"))
+        else if ((property == RendererProperty::TextColor) || (property == RendererProperty::TextColorHover) || (property == RendererProperty::TextColorDisabled)
+              || (property == RendererProperty::TextColorChecked) || (property == RendererProperty::TextColorCheckedHover) || (property == RendererProperty::TextColorCheckedDisabled))
         {
             updateTextColor();
         }
-        else if (property == "textstyle")
+        else if (property == RendererProperty::TextStyle)
         {
             m_textStyleCached = getSharedRenderer()->getTextStyle();
 
@@ -311,7 +319,7 @@ namespace tgui
             else
                 m_text.setStyle(m_textStyleCached);
         }
-        else if (property == "textstylechecked")
+        else if (property == RendererProperty::TextStyleChecked)
         {
             m_textStyleCheckedCached = getSharedRenderer()->getTextStyleChecked();
 
@@ -320,113 +328,113 @@ namespace tgui
             else
                 m_text.setStyle(m_textStyleCached);
         }
-        else if (property == "textureunchecked")
+        else if (property == RendererProperty::TextureUnchecked)
         {
             m_spriteUnchecked.setTexture(getSharedRenderer()->getTextureUnchecked());
             updateTextureSizes();
         }
-        else if (property == "texturechecked")
+        else if (property == RendererProperty::TextureChecked)
         {
             m_spriteChecked.setTexture(getSharedRenderer()->getTextureChecked());
             updateTextureSizes();
         }
-        else if (property == "textureuncheckedhover")
+        else if (property == RendererProperty::TextureUncheckedHover)
         {
             m_spriteUncheckedHover.setTexture(getSharedRenderer()->getTextureUncheckedHover());
         }
-        else if (property == "texturecheckedhover")
+        else if (property == RendererProperty::TextureCheckedHover)
         {
             m_spriteCheckedHover.setTexture(getSharedRenderer()->getTextureCheckedHover());
         }
-        else if (property == "textureuncheckeddisabled")
+        else if (property == RendererProperty::TextureUncheckedDisabled)
         {
             m_spriteUncheckedDisabled.setTexture(getSharedRenderer()->getTextureUncheckedDisabled());
         }
-        else if (property == "texturecheckeddisabled")
+        else if (property == RendererProperty::TextureCheckedDisabled)
         {
             m_spriteCheckedDisabled.setTexture(getSharedRenderer()->getTextureCheckedDisabled());
         }
-        else if (property == "textureuncheckedfocused")
+        else if (property == RendererProperty::TextureUncheckedFocused)
         {
             m_spriteUncheckedFocused.setTexture(getSharedRenderer()->getTextureUncheckedFocused());
         }
-        else if (property == "texturecheckedfocused")
+        else if (property == RendererProperty::TextureCheckedFocused)
         {
             m_spriteCheckedFocused.setTexture(getSharedRenderer()->getTextureCheckedFocused());
         }
-        else if (property == "checkcolor")
+        else if (property == RendererProperty::CheckColor)
         {
             m_checkColorCached = getSharedRenderer()->getCheckColor();
         }
-        else if (property == "checkcolorhover")
+        else if (property == RendererProperty::CheckColorHover)
         {
             m_checkColorHoverCached = getSharedRenderer()->getCheckColorHover();
         }
-        else if (property == "checkcolordisabled")
+        else if (property == RendererProperty::CheckColorDisabled)
         {
             m_checkColorDisabledCached = getSharedRenderer()->getCheckColorDisabled();
         }
-        else if (property == "bordercolor")
+        else if (property == RendererProperty::BorderColor)
         {
             m_borderColorCached = getSharedRenderer()->getBorderColor();
         }
-        else if (property == "bordercolorhover")
+        else if (property == RendererProperty::BorderColorHover)
         {
             m_borderColorHoverCached = getSharedRenderer()->getBorderColorHover();
         }
-        else if (property == "bordercolordisabled")
+        else if (property == RendererProperty::BorderColorDisabled)
         {
             m_borderColorDisabledCached = getSharedRenderer()->getBorderColorDisabled();
         }
-        else if (property == "bordercolorfocused")
+        else if (property == RendererProperty::BorderColorFocused)
         {
             m_borderColorFocusedCached = getSharedRenderer()->getBorderColorFocused();
         }
-        else if (property == "bordercolorchecked")
+        else if (property == RendererProperty::BorderColorChecked)
         {
             m_borderColorCheckedCached = getSharedRenderer()->getBorderColorChecked();
         }
-        else if (property == "bordercolorcheckedhover")
+        else if (property == RendererProperty::BorderColorCheckedHover)
         {
             m_borderColorCheckedHoverCached = getSharedRenderer()->getBorderColorCheckedHover();
         }
-        else if (property == "bordercolorcheckeddisabled")
+        else if (property == RendererProperty::BorderColorCheckedDisabled)
         {
             m_borderColorCheckedDisabledCached = getSharedRenderer()->getBorderColorCheckedDisabled();
         }
-        else if (property == "bordercolorcheckedfocused")
+        else if (property == RendererProperty::BorderColorCheckedFocused)
         {
             m_borderColorCheckedFocusedCached = getSharedRenderer()->getBorderColorCheckedFocused();
         }
-        else if (property == "backgroundcolor")
+        else if (property == RendererProperty::BackgroundColor)
         {
             m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
         }
-        else if (property == "backgroundcolorhover")
+        else if (property == RendererProperty::BackgroundColorHover)
         {
             m_backgroundColorHoverCached = getSharedRenderer()->getBackgroundColorHover();
         }
-        else if (property == "backgroundcolordisabled")
+        else if (property == RendererProperty::BackgroundColorDisabled)
         {
             m_backgroundColorDisabledCached = getSharedRenderer()->getBackgroundColorDisabled();
         }
-        else if (property == "backgroundcolorchecked")
+        else if (property == RendererProperty::BackgroundColorChecked)
         {
             m_backgroundColorCheckedCached = getSharedRenderer()->getBackgroundColorChecked();
         }
-        else if (property == "backgroundcolorcheckedhover")
+        else if (property == RendererProperty::BackgroundColorCheckedHover)
         {
             m_backgroundColorCheckedHoverCached = getSharedRenderer()->getBackgroundColorCheckedHover();
         }
-        else if (property == "backgroundcolorcheckeddisabled")
+        else if (property == RendererProperty::BackgroundColorCheckedDisabled)
         {
             m_backgroundColorCheckedDisabledCached = getSharedRenderer()->getBackgroundColorCheckedDisabled();
         }
-        else if (property == "textdistanceratio")
+        else if (property == RendererProperty::TextDistanceRatio)
         {
             m_textDistanceRatioCached = getSharedRenderer()->getTextDistanceRatio();
         }
-        else if ((property == "opacity") || (property == "opacitydisabled"))
+        else if ((property == RendererProperty::Opacity) || (property == RendererProperty::OpacityDisabled))
         {
             Widget::rendererChanged(property);
 
@@ -441,7 +449,7 @@ namespace tgui
 
             m_text.setOpacity(m_opacityCached);
         }
-        else if (property == "font")
+        else if (property == RendererProperty::Font)
         {
             Widget::rendererChanged(property);
 
@@ -663,7 +671,7 @@ namespace tgui
             circle.setOutlineThickness(-m_bordersCached.getLeft());
             circle.setFillColor(Color::Transparent);
             circle.setOutlineColor(Color::calcColorOpacity(getCurrentBorderColor(), m_opacityCached));
-            target.draw(circle, states);
+            RenderBatch::draw(target, circle, states);
         }
 
         // Draw the box
@@ -697,7 +705,7 @@ namespace tgui
         {
             sf::CircleShape circle{innerRadius};
             circle.setFillColor(Color::calcColorOpacity(getCurrentBackgroundColor(), m_opacityCached));
-            target.draw(circle, states);
+            RenderBatch::draw(target, circle, states);
 
             // Draw the check if the radio button is checked
             if (m_checked)
@@ -705,7 +713,7 @@ namespace tgui
                 sf::CircleShape checkShape{innerRadius * 0.4f};
                 checkShape.setFillColor(Color::calcColorOpacity(getCurrentCheckColor(), m_opacityCached));
                 checkShape.setPosition({innerRadius - checkShape.getRadius(), innerRadius - checkShape.getRadius()});
-                target.draw(checkShape, states);
+                RenderBatch::draw(target, checkShape, states);
             }
         }
         states.transform.translate({-m_bordersCached.getLeft(), -m_bordersCached.getLeft()});
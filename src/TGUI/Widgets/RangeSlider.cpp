@@ -35,6 +35,7 @@ namespace tgui
     RangeSlider::RangeSlider()
     {
         m_type = "RangeSlider";
+        m_renderBatchType = &typeid(RangeSlider);
 
         m_draggableWidget = true;
 
@@ -483,24 +484,27 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    Signal& RangeSlider::getSignal(std::string signalName)
+    Signal* RangeSlider::getSignal(std::uint64_t signalNameHash)
     {
-        if (signalName == toLower(onRangeChange.getName()))
-            return onRangeChange;
-        else
-            return Widget::getSignal(std::move(signalName));
+        switch (signalNameHash)
+        {
+            case hashSignalName("RangeChanged"):
+                return &onRangeChange;
+            default:
+                return Widget::getSignal(signalNameHash);
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void RangeSlider::rendererChanged(const std::string& property)
+    void RangeSlider::rendererChanged(RendererProperty property)
     {
-        if (property == "borders")
+        if (property == RendererProperty::Borders)
         {
             m_bordersCached = getSharedRenderer()->getBorders();
-            setSize(m_size);
+            requestSizeUpdate();
         }
-        else if (property == "texturetrack")
+        else if (property == RendererProperty::TextureTrack)
         {
             m_spriteTrack.setTexture(getSharedRenderer()->getTextureTrack());
 
@@ -509,54 +513,54 @@ namespace tgui
             else
                 m_verticalImage = false;
 
-            setSize(m_size);
+            requestSizeUpdate();
         }
-        else if (property == "texturetrackhover")
+        else if (property == RendererProperty::TextureTrackHover)
         {
             m_spriteTrackHover.setTexture(getSharedRenderer()->getTextureTrackHover());
         }
-        else if (property == "texturethumb")
+        else if (property == RendererProperty::TextureThumb)
         {
             m_spriteThumb.setTexture(getSharedRenderer()->getTextureThumb());
-            setSize(m_size);
+            requestSizeUpdate();
         }
-        else if (property == "texturethumbhover")
+        else if (property == RendererProperty::TextureThumbHover)
         {
             m_spriteThumbHover.setTexture(getSharedRenderer()->getTextureThumbHover());
         }
-        else if (property == "trackcolor")
+        else if (property == RendererProperty::TrackColor)
         {
             m_trackColorCached = getSharedRenderer()->getTrackColor();
         }
-        else if (property == "trackcolorhover")
+        else if (property == RendererProperty::TrackColorHover)
         {
             m_trackColorHoverCached = getSharedRenderer()->getTrackColorHover();
         }
-        else if (property == "selectedtrackcolor")
+        else if (property == RendererProperty::SelectedTrackColor)
         {
             m_selectedTrackColorCached = getSharedRenderer()->getSelectedTrackColor();
         }
-        else if (property == "selectedtrackcolorhover")
+        else if (property == RendererProperty::SelectedTrackColorHover)
         {
             m_selectedTrackColorHoverCached = getSharedRenderer()->getSelectedTrackColorHover();
         }
-        else if (property == "thumbcolor")
+        else if (property == RendererProperty::ThumbColor)
         {
             m_thumbColorCached = getSharedRenderer()->getThumbColor();
         }
-        else if (property == "thumbcolorhover")
+        else if (property == RendererProperty::ThumbColorHover)
         {
             m_thumbColorHoverCached = getSharedRenderer()->getThumbColorHover();
         }
-        else if (property == "bordercolor")
+        else if (property == RendererProperty::BorderColor)
         {
             m_borderColorCached = getSharedRenderer()->getBorderColor();
         }
-        else if (property == "bordercolorhover")
+        else if (property == RendererProperty::BorderColorHover)
         {
             m_borderColorHoverCached = getSharedRenderer()->getBorderColorHover();
         }
-        else if ((property == "opacity") || (property == "opacitydisabled"))
+        else if ((property == RendererProperty::Opacity) || (property == RendererProperty::OpacityDisabled))
         {
             Widget::rendererChanged(property);
 
@@ -632,6 +636,8 @@ namespace tgui
             m_thumbs.second.left = (innerSize.x / (m_maximum - m_minimum) * (m_selectionEnd - m_minimum)) - (m_thumbs.second.width / 2.0f);
             m_thumbs.second.top = m_bordersCached.getTop() + (innerSize.y - m_thumbs.second.height) / 2.0f;
         }
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
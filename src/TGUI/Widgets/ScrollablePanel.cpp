@@ -40,6 +40,7 @@ namespace tgui
         Panel{size}
     {
         m_type = "ScrollablePanel";
+        m_renderBatchType = &typeid(ScrollablePanel);
 
         // Rotate the horizontal scrollbar
         m_horizontalScrollbar->setSize(m_horizontalScrollbar->getSize().y, m_horizontalScrollbar->getSize().x);
@@ -554,7 +555,7 @@ namespace tgui
         if ((m_contentSize.y > 0) && (contentSize.y > m_contentSize.y))
             contentSize.y = m_contentSize.y;
 
-        // Draw the child widgets
+        // Draw the child widgets. Only the widgets that are scrolled into view are drawn, as the others lie outside the clip rect.
         {
             const Clipping clipping{target, states, {}, contentSize};
 
@@ -573,9 +574,9 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void ScrollablePanel::rendererChanged(const std::string& property)
+    void ScrollablePanel::rendererChanged(RendererProperty property)
     {
-        if (property == "scrollbar")
+        if (property == RendererProperty::Scrollbar)
         {
             m_verticalScrollbar->setRenderer(getSharedRenderer()->getScrollbar());
             m_horizontalScrollbar->setRenderer(getSharedRenderer()->getScrollbar());
@@ -589,7 +590,7 @@ namespace tgui
                 updateScrollbars();
             }
         }
-        else if (property == "scrollbarwidth")
+        else if (property == RendererProperty::ScrollbarWidth)
         {
             const float width = getSharedRenderer()->getScrollbarWidth() ? getSharedRenderer()->getScrollbarWidth() : m_verticalScrollbar->getDefaultWidth();
             m_verticalScrollbar->setSize({width, m_verticalScrollbar->getSize().y});
@@ -716,6 +717,8 @@ namespace tgui
 
         const float horizontalSpeed = 40.f * (static_cast<float>(m_horizontalScrollbar->getMaximum() - m_horizontalScrollbar->getViewportSize()) / m_horizontalScrollbar->getViewportSize());
         m_horizontalScrollbar->setScrollAmount(static_cast<unsigned int>(std::ceil(std::sqrt(horizontalSpeed))));
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
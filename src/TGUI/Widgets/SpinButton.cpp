@@ -36,6 +36,7 @@ namespace tgui
     SpinButton::SpinButton()
     {
         m_type = "SpinButton";
+        m_renderBatchType = &typeid(SpinButton);
 
         m_renderer = aurora::makeCopied<SpinButtonRenderer>();
         setRenderer(Theme::getDefault()->getRendererNoThrow(m_type));
@@ -303,65 +304,68 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    Signal& SpinButton::getSignal(std::string signalName)
+    Signal* SpinButton::getSignal(std::uint64_t signalNameHash)
     {
-        if (signalName == toLower(onValueChange.getName()))
-            return onValueChange;
-        else
-            return ClickableWidget::getSignal(std::move(signalName));
+        switch (signalNameHash)
+        {
+            case hashSignalName("ValueChanged"):
+                return &onValueChange;
+            default:
+                return ClickableWidget::getSignal(signalNameHash);
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void SpinButton::rendererChanged(const std::string& property)
+    void SpinButton::rendererChanged(RendererProperty property)
     {
-        if (property == "borders")
+        if (property == RendererProperty::Borders)
         {
             m_bordersCached = getSharedRenderer()->getBorders();
-            setSize(m_size);
+            requestSizeUpdate();
         }
-        else if (property == "borderbetweenarrows")
+        else if (property == RendererProperty::BorderBetweenArrows)
         {
             m_borderBetweenArrowsCached = getSharedRenderer()->getBorderBetweenArrows();
-            setSize(m_size);
+            requestSizeUpdate();
         }
-        else if (property == "texturearrowup")
+        else if (property == RendererProperty::TextureArrowUp)
         {
             m_spriteArrowUp.setTexture(getSharedRenderer()->getTextureArrowUp());
         }
-        else if (property == "texturearrowuphover")
+        else if (property == RendererProperty::TextureArrowUpHover)
         {
             m_spriteArrowUpHover.setTexture(getSharedRenderer()->getTextureArrowUpHover());
         }
-        else if (property == "texturearrowdown")
+        else if (property == RendererProperty::TextureArrowDown)
         {
             m_spriteArrowDown.setTexture(getSharedRenderer()->getTextureArrowDown());
         }
-        else if (property == "texturearrowdownhover")
+        else if (property == RendererProperty::TextureArrowDownHover)
         {
             m_spriteArrowDownHover.setTexture(getSharedRenderer()->getTextureArrowDownHover());
         }
-        else if (property == "bordercolor")
+        else if (property == RendererProperty::BorderColor)
         {
             m_borderColorCached = getSharedRenderer()->getBorderColor();
         }
-        else if (property == "backgroundcolor")
+        else if (property == RendererProperty::BackgroundColor)
         {
             m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
         }
-        else if (property == "backgroundcolorhover")
+        else if (property == RendererProperty::BackgroundColorHover)
         {
             m_backgroundColorHoverCached = getSharedRenderer()->getBackgroundColorHover();
         }
-        else if (property == "arrowcolor")
+        else if (property == RendererProperty::ArrowColor)
         {
             m_arrowColorCached = getSharedRenderer()->getArrowColor();
         }
-        else if (property == "arrowcolorhover")
+        else if (property == RendererProperty::ArrowColorHover)
         {
             m_arrowColorHoverCached = getSharedRenderer()->getArrowColorHover();
         }
-        else if ((property == "opacity") || (property == "opacitydisabled"))
+        else if ((property == RendererProperty::Opacity) || (property == RendererProperty::OpacityDisabled))
         {
             Widget::rendererChanged(property);
 
@@ -469,8 +473,8 @@ namespace tgui
             else
                 arrow.setFillColor(Color::calcColorOpacity(m_arrowColorCached, m_opacityCached));
 
-            target.draw(arrowBack, states);
-            target.draw(arrow, states);
+            RenderBatch::draw(target, arrowBack, states);
+            RenderBatch::draw(target, arrow, states);
         }
 
         // Draw the space between the arrows (if there is space)
@@ -535,8 +539,8 @@ namespace tgui
             else
                 arrow.setFillColor(Color::calcColorOpacity(m_arrowColorCached, m_opacityCached));
 
-            target.draw(arrowBack, states);
-            target.draw(arrow, states);
+            RenderBatch::draw(target, arrowBack, states);
+            RenderBatch::draw(target, arrow, states);
         }
     }
 
@@ -39,6 +39,7 @@ namespace tgui
     Tabs::Tabs()
     {
         m_type = "Tabs";
+        m_renderBatchType = &typeid(Tabs);
         m_distanceToSideCached = Text::getLineHeight(m_fontCached, getGlobalTextSize()) * 0.4f;
 
         m_renderer = aurora::makeCopied<TabsRenderer>();
@@ -235,6 +236,7 @@ namespace tgui
         // Select the tab
         m_selectedTab = static_cast<int>(index);
         m_tabs[m_selectedTab].text.setColor(m_selectedTextColorCached);
+        invalidate();
 
         // Send the callback
         onTabSelect.emit(this, m_tabs[index].text.getString());
@@ -250,6 +252,8 @@ namespace tgui
             m_tabs[m_selectedTab].text.setColor(m_textColorCached);
             m_selectedTab = -1;
         }
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -284,6 +288,7 @@ namespace tgui
 
         // New hovered tab depends on several factors, we keep it simple and just remove the hover state
         m_hoveringTab = -1;
+        invalidate();
         return true;
     }
 
@@ -549,102 +554,107 @@ namespace tgui
         }
 
         m_bordersCached.updateParentSize(getSize());
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    Signal& Tabs::getSignal(std::string signalName)
+    Signal* Tabs::getSignal(std::uint64_t signalNameHash)
     {
-        if (signalName == toLower(onTabSelect.getName()))
-            return onTabSelect;
-        else
-            return Widget::getSignal(std::move(signalName));
+        switch (signalNameHash)
+        {
+            case hashSignalName("TabSelected"):
+                return &onTabSelect;
+            default:
+                return Widget::getSignal(signalNameHash);
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void Tabs::rendererChanged(const std::string& property)
+    void Tabs::rendererChanged(RendererProperty property)
     {
-        if (property == "borders")
+        if (property == RendererProperty::Borders)
         {
             m_bordersCached = getSharedRenderer()->getBorders();
             recalculateTabsWidth();
         }
-        else if (property == "textcolor")
+        else if (property == RendererProperty::TextColor)
         {
             m_textColorCached = getSharedRenderer()->getTextColor();
             updateTextColors();
         }
-        else if (property == "textcolorhover")
+        else if (property == RendererProperty::TextColorHover)
         {
             m_textColorHoverCached = getSharedRenderer()->getTextColorHover();
             updateTextColors();
         }
-        else if (property == "textcolordisabled")
+        else if (property == RendererProperty::TextColorDisabled)
         {
             m_textColorDisabledCached = getSharedRenderer()->getTextColorDisabled();
             updateTextColors();
         }
-        else if (property == "selectedtextcolor")
+        else if (property == RendererProperty::SelectedTextColor)
         {
             m_selectedTextColorCached = getSharedRenderer()->getSelectedTextColor();
             updateTextColors();
         }
-        else if (property == "selectedtextcolorhover")
+        else if (property == RendererProperty::SelectedTextColorHover)
         {
             m_selectedTextColorHoverCached = getSharedRenderer()->getSelectedTextColorHover();
             updateTextColors();
         }
-        else if (property == "texturetab")
+        else if (property == RendererProperty::TextureTab)
         {
             m_spriteTab.setTexture(getSharedRenderer()->getTextureTab());
         }
-        else if (property == "texturetabhover")
+        else if (property == RendererProperty::TextureTabHover)
         {
             m_spriteTabHover.setTexture(getSharedRenderer()->getTextureTabHover());
         }
-        else if (property == "textureselectedtab")
+        else if (property == RendererProperty::TextureSelectedTab)
         {
             m_spriteSelectedTab.setTexture(getSharedRenderer()->getTextureSelectedTab());
         }
-        else if (property == "textureselectedtabhover")
+        else if (property == RendererProperty::TextureSelectedTabHover)
         {
             m_spriteSelectedTabHover.setTexture(getSharedRenderer()->getTextureSelectedTabHover());
         }
-        else if (property == "texturedisabledtab")
+        else if (property == RendererProperty::TextureDisabledTab)
         {
             m_spriteDisabledTab.setTexture(getSharedRenderer()->getTextureDisabledTab());
         }
-        else if (property == "distancetoside")
+        else if (property == RendererProperty::DistanceToSide)
         {
             m_distanceToSideCached = getSharedRenderer()->getDistanceToSide();
             recalculateTabsWidth();
         }
-        else if (property == "backgroundcolor")
+        else if (property == RendererProperty::BackgroundColor)
         {
             m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
         }
-        else if (property == "backgroundcolorhover")
+        else if (property == RendererProperty::BackgroundColorHover)
         {
             m_backgroundColorHoverCached = getSharedRenderer()->getBackgroundColorHover();
         }
-        else if (property == "backgroundcolordisabled")
+        else if (property == RendererProperty::BackgroundColorDisabled)
         {
             m_backgroundColorDisabledCached = getSharedRenderer()->getBackgroundColorDisabled();
         }
-        else if (property == "selectedbackgroundcolor")
+        else if (property == RendererProperty::SelectedBackgroundColor)
         {
             m_selectedBackgroundColorCached = getSharedRenderer()->getSelectedBackgroundColor();
         }
-        else if (property == "selectedbackgroundcolorhover")
+        else if (property == RendererProperty::SelectedBackgroundColorHover)
         {
             m_selectedBackgroundColorHoverCached = getSharedRenderer()->getSelectedBackgroundColorHover();
         }
-        else if (property == "bordercolor")
+        else if (property == RendererProperty::BorderColor)
         {
             m_borderColorCached = getSharedRenderer()->getBorderColor();
         }
-        else if ((property == "opacity") || (property == "opacitydisabled"))
+        else if ((property == RendererProperty::Opacity) || (property == RendererProperty::OpacityDisabled))
         {
             Widget::rendererChanged(property);
 
@@ -657,7 +667,7 @@ namespace tgui
             for (auto& tab : m_tabs)
                 tab.text.setOpacity(m_opacityCached);
         }
-        else if (property == "font")
+        else if (property == RendererProperty::Font)
         {
             Widget::rendererChanged(property);
 
@@ -798,6 +808,8 @@ namespace tgui
             if (m_textColorHoverCached.isSet())
                 m_tabs[m_hoveringTab].text.setColor(m_textColorHoverCached);
         }
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
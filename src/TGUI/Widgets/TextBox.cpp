@@ -39,6 +39,7 @@ namespace tgui
     TextBox::TextBox()
     {
         m_type = "TextBox";
+        m_renderBatchType = &typeid(TextBox);
         m_draggableWidget = true;
         m_textBeforeSelection.setFont(m_fontCached);
         m_textSelection1.setFont(m_fontCached);
@@ -134,6 +135,7 @@ namespace tgui
         else
             m_text = text;
 
+        markTextChanged(0, m_text.getSize());
         rearrangeText(false);
     }
 
@@ -141,14 +143,25 @@ namespace tgui
 
     void TextBox::addText(const sf::String& text)
     {
-        setText(m_text + text);
+        // Append the text in place instead of building a new string, only the last paragraphs will be word-wrapped again
+        const std::size_t oldSize = m_text.getSize();
+        if ((m_maxChars > 0) && (m_text.getSize() + text.getSize() > m_maxChars))
+        {
+            if (m_text.getSize() < m_maxChars)
+                m_text.insert(m_text.getSize(), text.substring(0, m_maxChars - m_text.getSize()));
+        }
+        else
+            m_text.insert(m_text.getSize(), text);
+
+        markTextChanged(oldSize, m_text.getSize() - oldSize);
+        rearrangeText(false);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     const sf::String& TextBox::getText() const
     {
-        return m_text;
+        return m_text.toString();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -192,6 +205,9 @@ namespace tgui
         // Calculate the height of one line
         m_lineHeight = static_cast<unsigned int>(m_fontCached.getLineSpacing(m_textSize));
 
+        // All paragraphs have to be word-wrapped again
+        m_paragraphs.clear();
+
         m_verticalScrollbar->setScrollAmount(m_lineHeight);
         m_horizontalScrollbar->setScrollAmount(m_textSize);
 
@@ -217,6 +233,7 @@ namespace tgui
         {
             // Remove all the excess characters
             m_text.erase(m_maxChars, sf::String::InvalidPos);
+            markTextChanged(m_maxChars, 0);
             rearrangeText(false);
         }
     }
@@ -408,6 +425,7 @@ namespace tgui
     void TextBox::enableMonospacedFontOptimization(bool enable)
     {
         m_monospacedFontOptimizationEnabled = enable;
+        m_paragraphs.clear();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -925,6 +943,7 @@ namespace tgui
                         m_selStart = m_selEnd;
 
                         m_text.erase(pos - 1, 1);
+                        markTextChanged(pos - 1, 0);
                         rearrangeText(true);
                     }
                 }
@@ -935,7 +954,8 @@ namespace tgui
                 m_caretVisible = true;
                 m_animationTimeElapsed = {};
 
-                onTextChange.emit(this, m_text);
+                if (onTextChange.hasHandlers())
+                    onTextChange.emit(this, m_text.toString());
                 break;
             }
 
@@ -947,13 +967,16 @@ namespace tgui
                 // Check that we did not select any characters
                 if (m_selStart == m_selEnd)
                 {
-                    m_text.erase(findTextSelectionPositions().second, 1);
+                    const std::size_t pos = findTextSelectionPositions().second;
+                    m_text.erase(pos, 1);
+                    markTextChanged(pos, 0);
                     rearrangeText(true);
                 }
                 else // You did select some characters, so remove them
                     deleteSelectedCharacters();
 
-                onTextChange.emit(this, m_text);
+                if (onTextChange.hasHandlers())
+                    onTextChange.emit(this, m_text.toString());
                 break;
             }
 
@@ -1007,14 +1030,17 @@ namespace tgui
                     {
                         deleteSelectedCharacters();
 
-                        m_text.insert(findTextSelectionPositions().first, clipboardContents);
+                        const std::size_t pos = findTextSelectionPositions().first;
+                        m_text.insert(pos, clipboardContents);
+                        markTextChanged(pos, clipboardContents.getSize());
                         m_lines[m_selStart.y].insert(m_selStart.x, clipboardContents);
 
                         m_selStart.x += clipboardContents.getSize();
                         m_selEnd = m_selStart;
                         rearrangeText(true);
 
-                        onTextChange.emit(this, m_text);
+                        if (onTextChange.hasHandlers())
+                            onTextChange.emit(this, m_text.toString());
                     }
                 }
 
@@ -1041,56 +1067,55 @@ namespace tgui
         if ((m_maxChars > 0) && (m_text.getSize() + 1 > m_maxChars))
             return;
 
-        auto insert = [=]()
+        // When there is no scrollbar, the text may not fit and the insert may have to be reverted.
+        // Only the selected characters that are about to be replaced are stored for this instead of a copy of the entire text.
+        const auto oldSelStart = m_selStart;
+        const auto oldSelEnd = m_selEnd;
+        sf::String replacedText;
+        if (m_verticalScrollbarPolicy == Scrollbar::Policy::Never)
         {
-            deleteSelectedCharacters();
+            auto selectionPositions = findTextSelectionPositions();
+            if (selectionPositions.first > selectionPositions.second)
+                std::swap(selectionPositions.first, selectionPositions.second);
 
-            const std::size_t caretPosition = findTextSelectionPositions().first;
+            replacedText = m_text.substring(selectionPositions.first, selectionPositions.second - selectionPositions.first);
+        }
 
-            m_text.insert(caretPosition, key);
-            m_lines[m_selEnd.y].insert(m_selEnd.x, key);
+        deleteSelectedCharacters();
 
-            // Increment the caret position, unless you type a newline at the start of a line while that line only existed due to word wrapping
-            if ((key != '\n') || (m_selEnd.x > 0) || (m_selEnd.y == 0) || m_lines[m_selEnd.y-1].isEmpty() || (m_text[caretPosition-1] == '\n'))
-            {
-                m_selStart.x++;
-                m_selEnd.x++;
-            }
+        const std::size_t caretPosition = findTextSelectionPositions().first;
 
-            rearrangeText(true);
-        };
+        m_text.insert(caretPosition, key);
+        markTextChanged(caretPosition, 1);
+        m_lines[m_selEnd.y].insert(m_selEnd.x, key);
 
-        // If there is a scrollbar then inserting can't go wrong
-        if (m_verticalScrollbarPolicy != Scrollbar::Policy::Never)
+        // Increment the caret position, unless you type a newline at the start of a line while that line only existed due to word wrapping
+        if ((key != '\n') || (m_selEnd.x > 0) || (m_selEnd.y == 0) || m_lines[m_selEnd.y-1].isEmpty() || (m_text[caretPosition-1] == '\n'))
         {
-            insert();
+            m_selStart.x++;
+            m_selEnd.x++;
         }
-        else // There is no scrollbar, the text may not fit
-        {
-            // Store the data so that it can be reverted
-            sf::String oldText = m_text;
-            const auto oldSelStart = m_selStart;
-            const auto oldSelEnd = m_selEnd;
 
-            // Try to insert the character
-            insert();
+        rearrangeText(true);
 
-            // Undo the insert if the text does not fit
-            if (m_lines.size() > getInnerSize().y / m_lineHeight)
-            {
-                m_text = oldText;
-                m_selStart = oldSelStart;
-                m_selEnd = oldSelEnd;
+        // Undo the insert if the text does not fit
+        if ((m_verticalScrollbarPolicy == Scrollbar::Policy::Never) && (m_lines.size() > getInnerSize().y / m_lineHeight))
+        {
+            m_text.erase(caretPosition, 1);
+            m_text.insert(caretPosition, replacedText);
+            markTextChanged(caretPosition, replacedText.getSize());
+            m_selStart = oldSelStart;
+            m_selEnd = oldSelEnd;
 
-                rearrangeText(true);
-            }
+            rearrangeText(true);
         }
 
         // The caret should be visible again
         m_caretVisible = true;
         m_animationTimeElapsed = {};
 
-        onTextChange.emit(this, m_text);
+        if (onTextChange.hasHandlers())
+            onTextChange.emit(this, m_text.toString());
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1212,11 +1237,13 @@ namespace tgui
             if ((m_selStart.y > m_selEnd.y) || ((m_selStart.y == m_selEnd.y) && (m_selStart.x > m_selEnd.x)))
             {
                 m_text.erase(textSelectionPositions.second, textSelectionPositions.first - textSelectionPositions.second);
+                markTextChanged(textSelectionPositions.second, 0);
                 m_selStart = m_selEnd;
             }
             else
             {
                 m_text.erase(textSelectionPositions.first, textSelectionPositions.second - textSelectionPositions.first);
+                markTextChanged(textSelectionPositions.first, 0);
                 m_selEnd = m_selStart;
             }
 
@@ -1226,28 +1253,51 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void TextBox::markTextChanged(std::size_t position, std::size_t insertedCharacters)
+    {
+        // When multiple edits happen before the text is rearranged, the changed part has to include all of them
+        const std::size_t unchangedAtEnd = m_text.getSize() - position - insertedCharacters;
+        if (m_changedTextStart == sf::String::InvalidPos)
+        {
+            m_changedTextStart = position;
+            m_unchangedTextAtEnd = unchangedAtEnd;
+        }
+        else
+        {
+            m_changedTextStart = std::min(m_changedTextStart, position);
+            m_unchangedTextAtEnd = std::min(m_unchangedTextAtEnd, unchangedAtEnd);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void TextBox::rearrangeText(bool keepSelection)
     {
+        invalidate();
+
         // Don't continue when line height is 0 or when there is no font yet
         if ((m_lineHeight == 0) || (m_fontCached == nullptr))
             return;
 
-        sf::String string;
-        if (m_horizontalScrollbarPolicy != Scrollbar::Policy::Never)
-            string = m_text;
-        else
+        // Find the maximum width of one line (a width of 0 means that no word-wrap is performed)
+        float maxLineWidth = 0;
+        if (m_horizontalScrollbarPolicy == Scrollbar::Policy::Never)
         {
-            // Find the maximum width of one line
             const float textOffset = Text::getExtraHorizontalPadding(m_fontCached, m_textSize);
-            float maxLineWidth = getInnerSize().x - m_paddingCached.getLeft() - m_paddingCached.getRight() - 2 * textOffset;
+            maxLineWidth = getInnerSize().x - m_paddingCached.getLeft() - m_paddingCached.getRight() - 2 * textOffset;
             if (m_verticalScrollbar->isShown())
                 maxLineWidth -= m_verticalScrollbar->getSize().x;
 
             // Don't do anything when there is no room for the text
             if (maxLineWidth <= 0)
                 return;
+        }
 
-            string = Text::wordWrap(maxLineWidth, m_text, m_fontCached, m_textSize, false, false);
+        // The lines can only be reused when they were split in the same way
+        if ((maxLineWidth != m_wordWrapWidth) || m_lines.empty())
+        {
+            m_wordWrapWidth = maxLineWidth;
+            m_paragraphs.clear();
         }
 
         // Store the current selection position when we are keeping the selection
@@ -1255,50 +1305,123 @@ namespace tgui
         if (keepSelection)
             textSelectionPositions = findTextSelectionPositions();
 
-        // Split the string in multiple lines
-        m_maxLineWidth = 0;
-        m_lines.clear();
-        std::size_t searchPosStart = 0;
-        std::size_t newLinePos = 0;
-        std::size_t longestLineCharCount = 0;
-        std::size_t longestLineIndex = 0;
-        while (newLinePos != sf::String::InvalidPos)
+        // Find the paragraphs (parts of the text between newlines) that contain changed characters, together with their lines.
+        // Only these paragraphs have to be word-wrapped again, the lines of the paragraphs around them are kept.
+        if (m_paragraphs.empty())
         {
-            newLinePos = string.find('\n', searchPosStart);
+            m_changedTextStart = 0;
+            m_unchangedTextAtEnd = 0;
+        }
 
-            if (newLinePos != sf::String::InvalidPos)
-                m_lines.push_back(string.substring(searchPosStart, newLinePos - searchPosStart));
-            else
-                m_lines.push_back(string.substring(searchPosStart));
+        if (m_changedTextStart != sf::String::InvalidPos)
+        {
+            std::size_t firstParagraph = 0;
+            std::size_t firstParagraphStart = 0;
+            std::size_t firstChangedLine = 0;
+            while ((firstParagraph + 1 < m_paragraphs.size())
+                && (firstParagraphStart + m_paragraphs[firstParagraph].length < m_changedTextStart))
+            {
+                firstParagraphStart += m_paragraphs[firstParagraph].length + 1;
+                firstChangedLine += m_paragraphs[firstParagraph].lineCount;
+                ++firstParagraph;
+            }
+
+            // Paragraphs at the end of the text are only unchanged when the newline in front of them is unchanged as well
+            std::size_t lastParagraph = m_paragraphs.size();
+            std::size_t lastChangedLine = m_lines.size();
+            std::size_t unchangedCharsAtEnd = 0;
+            while ((lastParagraph > firstParagraph + 1)
+                && (unchangedCharsAtEnd + m_paragraphs[lastParagraph - 1].length + 1 <= m_unchangedTextAtEnd))
+            {
+                unchangedCharsAtEnd += m_paragraphs[lastParagraph - 1].length + 1;
+                lastChangedLine -= m_paragraphs[lastParagraph - 1].lineCount;
+                --lastParagraph;
+            }
 
-            if (m_horizontalScrollbarPolicy != Scrollbar::Policy::Never)
+            // Split the changed part of the text in paragraphs and split those in multiple lines
+            const sf::String changedText = m_text.substring(firstParagraphStart, m_text.getSize() - unchangedCharsAtEnd - firstParagraphStart);
+            std::vector<ParagraphInfo> newParagraphs;
+            std::vector<sf::String> newLines;
+            std::size_t searchPosStart = 0;
+            std::size_t newLinePos = 0;
+            while (newLinePos != sf::String::InvalidPos)
             {
-                if (m_monospacedFontOptimizationEnabled)
+                newLinePos = changedText.find('\n', searchPosStart);
+
+                ParagraphInfo paragraph;
+                const sf::String paragraphText = changedText.substring(searchPosStart,
+                    ((newLinePos != sf::String::InvalidPos) ? newLinePos : changedText.getSize()) - searchPosStart);
+                paragraph.length = paragraphText.getSize();
+
+                if (maxLineWidth > 0)
                 {
-                    if (m_lines.back().getSize() > longestLineCharCount)
+                    const sf::String string = Text::wordWrap(maxLineWidth, paragraphText, m_fontCached, m_textSize, false, false);
+
+                    std::size_t wrapSearchPosStart = 0;
+                    std::size_t wrapNewLinePos = 0;
+                    while (wrapNewLinePos != sf::String::InvalidPos)
                     {
-                        longestLineCharCount = m_lines.back().getSize();
-                        longestLineIndex = m_lines.size() - 1;
+                        wrapNewLinePos = string.find('\n', wrapSearchPosStart);
+
+                        if (wrapNewLinePos != sf::String::InvalidPos)
+                            newLines.push_back(string.substring(wrapSearchPosStart, wrapNewLinePos - wrapSearchPosStart));
+                        else
+                            newLines.push_back(string.substring(wrapSearchPosStart));
+
+                        paragraph.lineCount++;
+                        wrapSearchPosStart = wrapNewLinePos + 1;
                     }
                 }
-                else // Not using optimization for monospaced font, so really calculate the width of every line
+                else // No word-wrap, the paragraph is a single line
                 {
-                    float lineWidth = Text::getLineWidth(m_lines.back(), m_fontCached, m_textSize);
-                    if (lineWidth > m_maxLineWidth)
-                        m_maxLineWidth = lineWidth;
+                    if (m_monospacedFontOptimizationEnabled)
+                        paragraph.width = static_cast<float>(paragraphText.getSize());
+                    else
+                        paragraph.width = Text::getLineWidth(paragraphText, m_fontCached, m_textSize);
+
+                    newLines.push_back(paragraphText);
+                    paragraph.lineCount = 1;
                 }
+
+                newParagraphs.push_back(paragraph);
+                searchPosStart = newLinePos + 1;
             }
 
-            searchPosStart = newLinePos + 1;
+            // Replace the paragraphs that changed and their lines
+            m_paragraphs.erase(m_paragraphs.begin() + firstParagraph, m_paragraphs.begin() + lastParagraph);
+            m_paragraphs.insert(m_paragraphs.begin() + firstParagraph, newParagraphs.begin(), newParagraphs.end());
+            m_lines.erase(m_lines.begin() + firstChangedLine, m_lines.begin() + lastChangedLine);
+            m_lines.insert(m_lines.begin() + firstChangedLine, newLines.begin(), newLines.end());
+            m_changedTextStart = sf::String::InvalidPos;
         }
 
-        if ((m_horizontalScrollbarPolicy != Scrollbar::Policy::Never) && m_monospacedFontOptimizationEnabled)
-            m_maxLineWidth = Text::getLineWidth(m_lines[longestLineIndex], m_fontCached, m_textSize);
+        // Find the width of the longest line
+        m_maxLineWidth = 0;
+        if (m_horizontalScrollbarPolicy != Scrollbar::Policy::Never)
+        {
+            std::size_t longestLineIndex = 0;
+            std::size_t lineIndex = 0;
+            for (const auto& paragraph : m_paragraphs)
+            {
+                if (paragraph.width > m_maxLineWidth)
+                {
+                    m_maxLineWidth = paragraph.width;
+                    longestLineIndex = lineIndex;
+                }
+
+                lineIndex += paragraph.lineCount;
+            }
+
+            if (m_monospacedFontOptimizationEnabled)
+                m_maxLineWidth = Text::getLineWidth(m_lines[longestLineIndex], m_fontCached, m_textSize);
+        }
 
         // Check if we should try to keep our selection
         if (keepSelection)
         {
             std::size_t index = 0;
+            std::size_t paragraphIndex = 0;
+            std::size_t lineInParagraph = 0;
             sf::Vector2<std::size_t> newSelStart;
             sf::Vector2<std::size_t> newSelEnd;
             bool newSelStartFound = false;
@@ -1327,9 +1450,13 @@ namespace tgui
                         break;
                 }
 
-                // Skip newlines in the text
-                if (m_text[index] == '\n')
+                // Skip the newline behind the last line of each paragraph
+                if (++lineInParagraph == m_paragraphs[paragraphIndex].lineCount)
+                {
                     ++index;
+                    ++paragraphIndex;
+                    lineInParagraph = 0;
+                }
             }
 
             // Keep the selection when possible
@@ -1408,17 +1535,84 @@ namespace tgui
             m_horizontalScrollbar->setSize({getInnerSize().x, m_horizontalScrollbar->getSize().y});
             m_horizontalScrollbar->setViewportSize(static_cast<unsigned int>(getInnerSize().x - m_paddingCached.getLeft() - m_paddingCached.getRight()));
         }
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void TextBox::updateSelectionTexts()
     {
-        // If there is no selection then just put the whole text in m_textBeforeSelection
-        if (m_selStart == m_selEnd)
+        // Check if the caret is located above or below the view
+        if (m_verticalScrollbarPolicy != Scrollbar::Policy::Never)
+        {
+            if (m_selEnd.y <= m_topLine)
+                m_verticalScrollbar->setValue(static_cast<unsigned int>(m_selEnd.y * m_lineHeight));
+            else if (m_selEnd.y + 1 >= m_topLine + m_visibleLines)
+                m_verticalScrollbar->setValue(static_cast<unsigned int>(((m_selEnd.y + 1) * m_lineHeight)
+                                                                        + Text::calculateExtraVerticalSpace(m_fontCached, m_textSize)
+                                                                        + Text::getExtraVerticalPadding(m_textSize)
+                                                                        - m_verticalScrollbar->getViewportSize()));
+        }
+
+        // Position the caret
+        {
+            const float textOffset = Text::getExtraHorizontalPadding(m_fontCached, m_textSize);
+            sf::Text tempText{m_lines[m_selEnd.y].substring(0, m_selEnd.x), *m_fontCached.getFont(), getTextSize()};
+
+            float kerning = 0;
+            if ((m_selEnd.x > 0) && (m_selEnd.x < m_lines[m_selEnd.y].getSize()))
+                kerning = m_fontCached.getKerning(m_lines[m_selEnd.y][m_selEnd.x - 1], m_lines[m_selEnd.y][m_selEnd.x], m_textSize);
+
+            m_caretPosition = {textOffset + tempText.findCharacterPos(tempText.getString().getSize()).x + kerning, static_cast<float>(m_selEnd.y * m_lineHeight)};
+        }
+
+        if (m_horizontalScrollbarPolicy != Scrollbar::Policy::Never)
+        {
+            const unsigned int left = m_horizontalScrollbar->getValue();
+            if (m_caretPosition.x <= left)
+            {
+                unsigned int newValue =
+                    static_cast<unsigned int>(std::max(0, static_cast<int>(m_caretPosition.x
+                                                                           - (Text::getExtraHorizontalPadding(m_fontCached, m_textSize) * 2))));
+                m_horizontalScrollbar->setValue(newValue);
+            }
+            else if (m_caretPosition.x > (left + m_horizontalScrollbar->getViewportSize()))
+            {
+                unsigned int newValue = static_cast<unsigned int>(m_caretPosition.x
+                                                                  + (Text::getExtraHorizontalPadding(m_fontCached, m_textSize) * 2)
+                                                                  - m_horizontalScrollbar->getViewportSize());
+                m_horizontalScrollbar->setValue(newValue);
+            }
+        }
+
+        // Find out which lines are visible. The visible lines are only placed in the texts here if this didn't already happen.
+        const std::size_t oldFirstDrawnLine = m_firstDrawnLine;
+        const std::size_t oldLastDrawnLine = m_lastDrawnLine;
+        recalculateVisibleLines();
+        if ((m_firstDrawnLine == oldFirstDrawnLine) && (m_lastDrawnLine == oldLastDrawnLine))
+            updateVisibleTexts();
+
+        invalidate();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextBox::updateVisibleTexts()
+    {
+        const std::size_t firstLine = m_firstDrawnLine;
+        const std::size_t lastLine = m_lastDrawnLine;
+
+        auto selectionStart = m_selStart;
+        auto selectionEnd = m_selEnd;
+        if ((m_selStart.y > m_selEnd.y) || ((m_selStart.y == m_selEnd.y) && (m_selStart.x > m_selEnd.x)))
+            std::swap(selectionStart, selectionEnd);
+
+        // If there is no (visible) selection then just put all visible lines in m_textBeforeSelection
+        if ((m_selStart == m_selEnd) || (firstLine >= lastLine) || (selectionEnd.y < firstLine) || (selectionStart.y >= lastLine))
         {
             sf::String displayedText;
-            for (std::size_t i = 0; i < m_lines.size(); ++i)
+            for (std::size_t i = firstLine; i < lastLine; ++i)
                 displayedText += m_lines[i] + "\n";
 
             m_textBeforeSelection.setString(displayedText);
@@ -1427,29 +1621,26 @@ namespace tgui
             m_textAfterSelection1.setString("");
             m_textAfterSelection2.setString("");
         }
-        else // Some text is selected
+        else // Some of the visible text is selected
         {
-            auto selectionStart = m_selStart;
-            auto selectionEnd = m_selEnd;
-
-            if ((m_selStart.y > m_selEnd.y) || ((m_selStart.y == m_selEnd.y) && (m_selStart.x > m_selEnd.x)))
-                std::swap(selectionStart, selectionEnd);
+            // Only the part of the selection that lies within the visible lines is relevant
+            if (selectionStart.y < firstLine)
+                selectionStart = {0, firstLine};
+            if (selectionEnd.y >= lastLine)
+                selectionEnd = {m_lines[lastLine-1].getSize(), lastLine-1};
 
             // Set the text before the selection
-            if (selectionStart.y > 0)
             {
                 sf::String string;
-                for (std::size_t i = 0; i < selectionStart.y; ++i)
+                for (std::size_t i = firstLine; i < selectionStart.y; ++i)
                     string += m_lines[i] + "\n";
 
                 string += m_lines[selectionStart.y].substring(0, selectionStart.x);
                 m_textBeforeSelection.setString(string);
             }
-            else
-                m_textBeforeSelection.setString(m_lines[0].substring(0, selectionStart.x));
 
             // Set the selected text
-            if (m_selStart.y == m_selEnd.y)
+            if (selectionStart.y == selectionEnd.y)
             {
                 m_textSelection1.setString(m_lines[selectionStart.y].substring(selectionStart.x, selectionEnd.x - selectionStart.x));
                 m_textSelection2.setString("");
@@ -1472,56 +1663,13 @@ namespace tgui
                 m_textAfterSelection1.setString(m_lines[selectionEnd.y].substring(selectionEnd.x, m_lines[selectionEnd.y].getSize() - selectionEnd.x));
 
                 sf::String string;
-                for (std::size_t i = selectionEnd.y + 1; i < m_lines.size(); ++i)
+                for (std::size_t i = selectionEnd.y + 1; i < lastLine; ++i)
                     string += m_lines[i] + "\n";
 
                 m_textAfterSelection2.setString(string);
             }
         }
 
-        // Check if the caret is located above or below the view
-        if (m_verticalScrollbarPolicy != Scrollbar::Policy::Never)
-        {
-            if (m_selEnd.y <= m_topLine)
-                m_verticalScrollbar->setValue(static_cast<unsigned int>(m_selEnd.y * m_lineHeight));
-            else if (m_selEnd.y + 1 >= m_topLine + m_visibleLines)
-                m_verticalScrollbar->setValue(static_cast<unsigned int>(((m_selEnd.y + 1) * m_lineHeight)
-                                                                        + Text::calculateExtraVerticalSpace(m_fontCached, m_textSize)
-                                                                        + Text::getExtraVerticalPadding(m_textSize)
-                                                                        - m_verticalScrollbar->getViewportSize()));
-        }
-
-        // Position the caret
-        {
-            const float textOffset = Text::getExtraHorizontalPadding(m_fontCached, m_textSize);
-            sf::Text tempText{m_lines[m_selEnd.y].substring(0, m_selEnd.x), *m_fontCached.getFont(), getTextSize()};
-
-            float kerning = 0;
-            if ((m_selEnd.x > 0) && (m_selEnd.x < m_lines[m_selEnd.y].getSize()))
-                kerning = m_fontCached.getKerning(m_lines[m_selEnd.y][m_selEnd.x - 1], m_lines[m_selEnd.y][m_selEnd.x], m_textSize);
-
-            m_caretPosition = {textOffset + tempText.findCharacterPos(tempText.getString().getSize()).x + kerning, static_cast<float>(m_selEnd.y * m_lineHeight)};
-        }
-
-        if (m_horizontalScrollbarPolicy != Scrollbar::Policy::Never)
-        {
-            const unsigned int left = m_horizontalScrollbar->getValue();
-            if (m_caretPosition.x <= left)
-            {
-                unsigned int newValue =
-                    static_cast<unsigned int>(std::max(0, static_cast<int>(m_caretPosition.x
-                                                                           - (Text::getExtraHorizontalPadding(m_fontCached, m_textSize) * 2))));
-                m_horizontalScrollbar->setValue(newValue);
-            }
-            else if (m_caretPosition.x > (left + m_horizontalScrollbar->getViewportSize()))
-            {
-                unsigned int newValue = static_cast<unsigned int>(m_caretPosition.x
-                                                                  + (Text::getExtraHorizontalPadding(m_fontCached, m_textSize) * 2)
-                                                                  - m_horizontalScrollbar->getViewportSize());
-                m_horizontalScrollbar->setValue(newValue);
-            }
-        }
-
         recalculatePositions();
     }
 
@@ -1547,6 +1695,8 @@ namespace tgui
 
             // Switch the value of the visible flag
             m_caretVisible = !m_caretVisible;
+            if (m_focused)
+                invalidate();
 
             // Too slow for double clicking
             m_possibleDoubleClick = false;
@@ -1561,17 +1711,25 @@ namespace tgui
             return;
 
         const float textOffset = Text::getExtraHorizontalPadding(m_fontCached, m_textSize);
+        const std::size_t firstLine = m_firstDrawnLine;
+        const std::size_t lastLine = m_lastDrawnLine;
 
         // Calculate the position of the text objects
         m_selectionRects.clear();
-        m_textBeforeSelection.setPosition({textOffset, 0});
-        if (m_selStart != m_selEnd)
-        {
-            auto selectionStart = m_selStart;
-            auto selectionEnd = m_selEnd;
+        m_textBeforeSelection.setPosition({textOffset, static_cast<float>(firstLine * m_lineHeight)});
 
-            if ((m_selStart.y > m_selEnd.y) || ((m_selStart.y == m_selEnd.y) && (m_selStart.x > m_selEnd.x)))
-                std::swap(selectionStart, selectionEnd);
+        auto selectionStart = m_selStart;
+        auto selectionEnd = m_selEnd;
+        if ((m_selStart.y > m_selEnd.y) || ((m_selStart.y == m_selEnd.y) && (m_selStart.x > m_selEnd.x)))
+            std::swap(selectionStart, selectionEnd);
+
+        if ((m_selStart != m_selEnd) && (firstLine < lastLine) && (selectionEnd.y >= firstLine) && (selectionStart.y < lastLine))
+        {
+            // The text objects only contain the part of the selection that is visible
+            if (selectionStart.y < firstLine)
+                selectionStart = {0, firstLine};
+            if (selectionEnd.y >= lastLine)
+                selectionEnd = {m_lines[lastLine-1].getSize(), lastLine-1};
 
             float kerningSelectionStart = 0;
             if ((selectionStart.x > 0) && (selectionStart.x < m_lines[selectionStart.y].getSize()))
@@ -1584,10 +1742,10 @@ namespace tgui
             if (selectionStart.x > 0)
             {
                 m_textSelection1.setPosition({textOffset + m_textBeforeSelection.findCharacterPos(m_textBeforeSelection.getString().getSize()).x + kerningSelectionStart,
-                                              m_textBeforeSelection.getPosition().y + (selectionStart.y * m_lineHeight)});
+                                              static_cast<float>(selectionStart.y * m_lineHeight)});
             }
             else
-                m_textSelection1.setPosition({textOffset, m_textBeforeSelection.getPosition().y + (selectionStart.y * m_lineHeight)});
+                m_textSelection1.setPosition({textOffset, static_cast<float>(selectionStart.y * m_lineHeight)});
 
             m_textSelection2.setPosition({textOffset, static_cast<float>((selectionStart.y + 1) * m_lineHeight)});
 
@@ -1643,8 +1801,6 @@ namespace tgui
                 }
             }
         }
-
-        recalculateVisibleLines();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1679,48 +1835,62 @@ namespace tgui
             m_topLine = 0;
             m_visibleLines = std::min(static_cast<std::size_t>((getInnerSize().y - m_paddingCached.getTop() - m_paddingCached.getBottom() - horiScrollOffset) / m_lineHeight), m_lines.size());
         }
+
+        // Only the visible lines are stored in the texts, so they have to be updated when other lines became visible.
+        // One extra line is included as the bottom line may only be partially visible.
+        const std::size_t firstDrawnLine = std::min(m_topLine, m_lines.size());
+        const std::size_t lastDrawnLine = std::min(m_topLine + m_visibleLines + 1, m_lines.size());
+        if ((firstDrawnLine != m_firstDrawnLine) || (lastDrawnLine != m_lastDrawnLine))
+        {
+            m_firstDrawnLine = firstDrawnLine;
+            m_lastDrawnLine = lastDrawnLine;
+            updateVisibleTexts();
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    Signal& TextBox::getSignal(std::string signalName)
+    Signal* TextBox::getSignal(std::uint64_t signalNameHash)
     {
-        if (signalName == toLower(onTextChange.getName()))
-            return onTextChange;
-        else
-            return Widget::getSignal(std::move(signalName));
+        switch (signalNameHash)
+        {
+            case hashSignalName("TextChanged"):
+                return &onTextChange;
+            default:
+                return Widget::getSignal(signalNameHash);
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void TextBox::rendererChanged(const std::string& property)
+    void TextBox::rendererChanged(RendererProperty property)
     {
-        if (property == "borders")
+        if (property == RendererProperty::Borders)
         {
             m_bordersCached = getSharedRenderer()->getBorders();
-            setSize(m_size);
+            requestSizeUpdate();
         }
-        else if (property == "padding")
+        else if (property == RendererProperty::Padding)
         {
             m_paddingCached = getSharedRenderer()->getPadding();
-            setSize(m_size);
+            requestSizeUpdate();
         }
-        else if (property == "textcolor")
+        else if (property == RendererProperty::TextColor)
         {
             m_textBeforeSelection.setColor(getSharedRenderer()->getTextColor());
             m_textAfterSelection1.setColor(getSharedRenderer()->getTextColor());
             m_textAfterSelection2.setColor(getSharedRenderer()->getTextColor());
         }
-        else if (property == "selectedtextcolor")
+        else if (property == RendererProperty::SelectedTextColor)
         {
             m_textSelection1.setColor(getSharedRenderer()->getSelectedTextColor());
             m_textSelection2.setColor(getSharedRenderer()->getSelectedTextColor());
         }
-        else if (property == "texturebackground")
+        else if (property == RendererProperty::TextureBackground)
         {
             m_spriteBackground.setTexture(getSharedRenderer()->getTextureBackground());
         }
-        else if (property == "scrollbar")
+        else if (property == RendererProperty::Scrollbar)
         {
             m_verticalScrollbar->setRenderer(getSharedRenderer()->getScrollbar());
             m_horizontalScrollbar->setRenderer(getSharedRenderer()->getScrollbar());
@@ -1730,37 +1900,37 @@ namespace tgui
             {
                 m_verticalScrollbar->setSize({m_verticalScrollbar->getDefaultWidth(), m_verticalScrollbar->getSize().y});
                 m_horizontalScrollbar->setSize({m_horizontalScrollbar->getSize().x, m_horizontalScrollbar->getDefaultWidth()});
-                setSize(m_size);
+                requestSizeUpdate();
             }
         }
-        else if (property == "scrollbarwidth")
+        else if (property == RendererProperty::ScrollbarWidth)
         {
             const float width = getSharedRenderer()->getScrollbarWidth() ? getSharedRenderer()->getScrollbarWidth() : m_verticalScrollbar->getDefaultWidth();
             m_verticalScrollbar->setSize({width, m_verticalScrollbar->getSize().y});
             m_horizontalScrollbar->setSize({m_horizontalScrollbar->getSize().x, width});
-            setSize(m_size);
+            requestSizeUpdate();
         }
-        else if (property == "backgroundcolor")
+        else if (property == RendererProperty::BackgroundColor)
         {
             m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
         }
-        else if (property == "selectedtextbackgroundcolor")
+        else if (property == RendererProperty::SelectedTextBackgroundColor)
         {
             m_selectedTextBackgroundColorCached = getSharedRenderer()->getSelectedTextBackgroundColor();
         }
-        else if (property == "bordercolor")
+        else if (property == RendererProperty::BorderColor)
         {
             m_borderColorCached = getSharedRenderer()->getBorderColor();
         }
-        else if (property == "caretcolor")
+        else if (property == RendererProperty::CaretColor)
         {
             m_caretColorCached = getSharedRenderer()->getCaretColor();
         }
-        else if (property == "caretwidth")
+        else if (property == RendererProperty::CaretWidth)
         {
             m_caretWidthCached = getSharedRenderer()->getCaretWidth();
         }
-        else if ((property == "opacity") || (property == "opacitydisabled"))
+        else if ((property == RendererProperty::Opacity) || (property == RendererProperty::OpacityDisabled))
         {
             Widget::rendererChanged(property);
 
@@ -1773,7 +1943,7 @@ namespace tgui
             m_textSelection1.setOpacity(m_opacityCached);
             m_textSelection2.setOpacity(m_opacityCached);
         }
-        else if (property == "font")
+        else if (property == RendererProperty::Font)
         {
             Widget::rendererChanged(property);
 
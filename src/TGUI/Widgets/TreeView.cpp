@@ -237,6 +237,7 @@ namespace tgui
     TreeView::TreeView()
     {
         m_type = "TreeView";
+        m_renderBatchType = &typeid(TreeView);
         m_draggableWidget = true;
 
         // Rotate the horizontal scrollbar
@@ -609,6 +610,8 @@ namespace tgui
             m_textSize = Text::findBestTextSize(m_fontCached, m_itemHeight * 0.8f);
 
         setTextSizeImpl(m_nodes, textSize);
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -816,94 +819,97 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    Signal& TreeView::getSignal(std::string signalName)
+    Signal* TreeView::getSignal(std::uint64_t signalNameHash)
     {
-        if (signalName == toLower(onItemSelect.getName()))
-            return onItemSelect;
-        else if (signalName == toLower(onDoubleClick.getName()))
-            return onDoubleClick;
-        else if (signalName == toLower(onExpand.getName()))
-            return onExpand;
-        else if (signalName == toLower(onCollapse.getName()))
-            return onCollapse;
-        else
-            return Widget::getSignal(std::move(signalName));
+        switch (signalNameHash)
+        {
+            case hashSignalName("ItemSelected"):
+                return &onItemSelect;
+            case hashSignalName("DoubleClicked"):
+                return &onDoubleClick;
+            case hashSignalName("Expanded"):
+                return &onExpand;
+            case hashSignalName("Collapsed"):
+                return &onCollapse;
+            default:
+                return Widget::getSignal(signalNameHash);
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void TreeView::rendererChanged(const std::string& property)
+    void TreeView::rendererChanged(RendererProperty property)
     {
-        if (property == "borders")
+        if (property == RendererProperty::Borders)
         {
             m_bordersCached = getSharedRenderer()->getBorders();
-            setSize(m_size);
+            requestSizeUpdate();
         }
-        else if (property == "padding")
+        else if (property == RendererProperty::Padding)
         {
             m_paddingCached = getSharedRenderer()->getPadding();
-            setSize(m_size);
+            requestSizeUpdate();
         }
-        else if (property == "backgroundcolor")
+        else if (property == RendererProperty::BackgroundColor)
         {
             m_backgroundColorCached = getSharedRenderer()->getBackgroundColor();
         }
-        else if (property == "selectedbackgroundcolor")
+        else if (property == RendererProperty::SelectedBackgroundColor)
         {
             m_selectedBackgroundColorCached = getSharedRenderer()->getSelectedBackgroundColor();
         }
-        else if (property == "backgroundcolorhover")
+        else if (property == RendererProperty::BackgroundColorHover)
         {
             m_backgroundColorHoverCached = getSharedRenderer()->getBackgroundColorHover();
         }
-        else if (property == "selectedbackgroundcolorhover")
+        else if (property == RendererProperty::SelectedBackgroundColorHover)
         {
             m_selectedBackgroundColorHoverCached = getSharedRenderer()->getSelectedBackgroundColorHover();
         }
-        else if (property == "bordercolor")
+        else if (property == RendererProperty::BorderColor)
         {
             m_borderColorCached = getSharedRenderer()->getBorderColor();
         }
-        else if (property == "texturebranchexpanded")
+        else if (property == RendererProperty::TextureBranchExpanded)
         {
             m_spriteBranchExpanded.setTexture(getSharedRenderer()->getTextureBranchExpanded());
             markNodesDirty();
         }
-        else if (property == "texturebranchcollapsed")
+        else if (property == RendererProperty::TextureBranchCollapsed)
         {
             m_spriteBranchCollapsed.setTexture(getSharedRenderer()->getTextureBranchCollapsed());
             markNodesDirty();
         }
-        else if (property == "textureleaf")
+        else if (property == RendererProperty::TextureLeaf)
         {
             m_spriteLeaf.setTexture(getSharedRenderer()->getTextureLeaf());
             markNodesDirty();
         }
-        else if (property == "textcolor")
+        else if (property == RendererProperty::TextColor)
         {
             m_textColorCached = getSharedRenderer()->getTextColor();
             updateTextColors(m_nodes);
             updateSelectedAndHoveringItemColors();
         }
-        else if (property == "textcolorhover")
+        else if (property == RendererProperty::TextColorHover)
         {
             m_textColorHoverCached = getSharedRenderer()->getTextColorHover();
             updateTextColors(m_nodes);
             updateSelectedAndHoveringItemColors();
         }
-        else if (property == "selectedtextcolor")
+        else if (property == RendererProperty::SelectedTextColor)
         {
             m_selectedTextColorCached = getSharedRenderer()->getSelectedTextColor();
             updateTextColors(m_nodes);
             updateSelectedAndHoveringItemColors();
         }
-        else if (property == "selectedtextcolorhover")
+        else if (property == RendererProperty::SelectedTextColorHover)
         {
             m_selectedTextColorHoverCached = getSharedRenderer()->getSelectedTextColorHover();
             updateTextColors(m_nodes);
             updateSelectedAndHoveringItemColors();
         }
-        else if (property == "scrollbar")
+        else if (property == RendererProperty::Scrollbar)
         {
             m_verticalScrollbar->setRenderer(getSharedRenderer()->getScrollbar());
             m_horizontalScrollbar->setRenderer(getSharedRenderer()->getScrollbar());
@@ -917,14 +923,14 @@ namespace tgui
                 markNodesDirty();
             }
         }
-        else if (property == "scrollbarwidth")
+        else if (property == RendererProperty::ScrollbarWidth)
         {
             const float width = getSharedRenderer()->getScrollbarWidth() ? getSharedRenderer()->getScrollbarWidth() : m_verticalScrollbar->getDefaultWidth();
             m_verticalScrollbar->setSize({width, m_verticalScrollbar->getSize().y});
             m_horizontalScrollbar->setSize({m_horizontalScrollbar->getSize().x, width});
             markNodesDirty();
         }
-        else if ((property == "opacity") || (property == "opacitydisabled"))
+        else if ((property == RendererProperty::Opacity) || (property == RendererProperty::OpacityDisabled))
         {
             Widget::rendererChanged(property);
 
@@ -937,7 +943,7 @@ namespace tgui
             m_verticalScrollbar->setInheritedOpacity(m_opacityCached);
             m_horizontalScrollbar->setInheritedOpacity(m_opacityCached);
         }
-        else if (property == "font")
+        else if (property == RendererProperty::Font)
         {
             Widget::rendererChanged(property);
             setTextFontImpl(m_nodes, m_fontCached);
@@ -1105,6 +1111,8 @@ namespace tgui
 
         m_verticalScrollbar->setPosition(getSize().x - m_bordersCached.getRight() - m_verticalScrollbar->getSize().x, m_bordersCached.getTop());
         m_horizontalScrollbar->setPosition(m_bordersCached.getLeft(), getSize().y - m_bordersCached.getBottom() - m_horizontalScrollbar->getSize().y);
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1420,6 +1428,8 @@ namespace tgui
             onItemSelect.emit(this, "", {});
 
         updateSelectedAndHoveringItemColors();
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,215 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2019 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#include <TGUI/WorkerPool.hpp>
+
+#include <condition_variable>
+#include <algorithm>
+#include <utility>
+#include <thread>
+#include <mutex>
+#include <deque>
+#include <vector>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    namespace
+    {
+        unsigned int getDefaultThreadCount()
+        {
+            // Leave one hardware thread for the gui
+            const unsigned int hardwareThreads = std::thread::hardware_concurrency();
+            return (hardwareThreads > 1) ? hardwareThreads - 1 : 1;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        struct Pool
+        {
+            ~Pool()
+            {
+                stopWorkers();
+            }
+
+            void startWorkers();
+            void stopWorkers();
+            void runWorker();
+
+            std::mutex mutex;
+            std::condition_variable taskAdded;
+            std::condition_variable taskCompleted;
+            std::deque<std::pair<std::function<void()>, std::function<void()>>> tasks;
+            std::vector<std::function<void()>> finishedFunctions;
+            std::vector<std::thread> threads;
+            unsigned int threadCount = getDefaultThreadCount();
+            unsigned int runningTasks = 0;
+            bool tasksCompleted = false;
+            bool stopping = false;
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        Pool& getPool()
+        {
+            static Pool pool;
+            return pool;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // The mutex must be locked when calling this function
+        void Pool::startWorkers()
+        {
+            if (!threads.empty())
+                return;
+
+            stopping = false;
+            for (unsigned int i = 0; i < threadCount; ++i)
+                threads.emplace_back([this]{ runWorker(); });
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // The mutex must not be locked when calling this function. Tasks that haven't started yet remain in the queue.
+        void Pool::stopWorkers()
+        {
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                stopping = true;
+            }
+            taskAdded.notify_all();
+
+            for (auto& thread : threads)
+                thread.join();
+
+            threads.clear();
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void Pool::runWorker()
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            while (true)
+            {
+                taskAdded.wait(lock, [this]{ return stopping || !tasks.empty(); });
+                if (stopping)
+                    return;
+
+                auto task = std::move(tasks.front());
+                tasks.pop_front();
+                ++runningTasks;
+
+                lock.unlock();
+                task.first();
+                task.first = nullptr; // Release the resources of the task outside the lock
+                lock.lock();
+
+                --runningTasks;
+                tasksCompleted = true;
+                if (task.second)
+                    finishedFunctions.push_back(std::move(task.second));
+
+                taskCompleted.notify_all();
+            }
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void WorkerPool::addTask(std::function<void()> task, std::function<void()> finished)
+    {
+        Pool& pool = getPool();
+        {
+            std::lock_guard<std::mutex> lock(pool.mutex);
+            pool.tasks.emplace_back(std::move(task), std::move(finished));
+            pool.startWorkers();
+        }
+        pool.taskAdded.notify_one();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool WorkerPool::processFinishedTasks()
+    {
+        Pool& pool = getPool();
+
+        std::vector<std::function<void()>> finishedFunctions;
+        bool tasksCompleted;
+        {
+            std::lock_guard<std::mutex> lock(pool.mutex);
+            finishedFunctions.swap(pool.finishedFunctions);
+            tasksCompleted = pool.tasksCompleted;
+            pool.tasksCompleted = false;
+        }
+
+        // The functions are called without holding the lock, so that they can add new tasks
+        for (auto& function : finishedFunctions)
+            function();
+
+        return tasksCompleted;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void WorkerPool::waitForTasks()
+    {
+        Pool& pool = getPool();
+
+        std::unique_lock<std::mutex> lock(pool.mutex);
+        pool.taskCompleted.wait(lock, [&pool]{ return pool.tasks.empty() && (pool.runningTasks == 0); });
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void WorkerPool::setThreadCount(unsigned int count)
+    {
+        Pool& pool = getPool();
+        pool.stopWorkers();
+
+        std::lock_guard<std::mutex> lock(pool.mutex);
+        pool.threadCount = std::max(1u, count);
+        if (!pool.tasks.empty())
+        {
+            pool.startWorkers();
+            pool.taskAdded.notify_all();
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    unsigned int WorkerPool::getThreadCount()
+    {
+        return getPool().threadCount;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -120,4 +120,32 @@ TEST_CASE("[Clipping]")
 
         TEST_DRAW("Clipping_NestedLayers.png")
     }
+
+    SECTION("Clip rect")
+    {
+        sf::RenderTexture target;
+        target.create(100, 50);
+        target.setView(sf::View{{20, 10, 100, 50}});
+        tgui::Clipping::setGuiView(target.getView());
+
+        tgui::FloatRect clipRect = tgui::Clipping::getClipRect(target);
+        REQUIRE(clipRect.left == Approx(20));
+        REQUIRE(clipRect.top == Approx(10));
+        REQUIRE(clipRect.width == Approx(100));
+        REQUIRE(clipRect.height == Approx(50));
+
+        {
+            const tgui::Clipping clipping{target, {}, {30, 20}, {40, 10}};
+
+            clipRect = tgui::Clipping::getClipRect(target);
+            REQUIRE(clipRect.left == Approx(30));
+            REQUIRE(clipRect.top == Approx(20));
+            REQUIRE(clipRect.width == Approx(40));
+            REQUIRE(clipRect.height == Approx(10));
+        }
+
+        clipRect = tgui::Clipping::getClipRect(target);
+        REQUIRE(clipRect.left == Approx(20));
+        REQUIRE(clipRect.width == Approx(100));
+    }
 }
@@ -265,6 +265,180 @@ TEST_CASE("[Container]")
         REQUIRE(widget5->getInheritedOpacity() == 0.7f);
     }
 
+    SECTION("Redraw needed")
+    {
+        sf::RenderTexture target;
+        target.create(200, 100);
+        container->setTarget(target);
+        REQUIRE(container->isRedrawNeeded());
+
+        container->draw();
+        REQUIRE(!container->isRedrawNeeded());
+
+        widget4->setPosition(10, 20);
+        REQUIRE(container->isRedrawNeeded());
+        container->draw();
+
+        widget3->setVisible(false);
+        REQUIRE(container->isRedrawNeeded());
+        container->draw();
+
+        widget5->getRenderer()->setTextColor(sf::Color::Red);
+        REQUIRE(container->isRedrawNeeded());
+        container->draw();
+
+        widget1->setText("Changed");
+        REQUIRE(container->isRedrawNeeded());
+        container->draw();
+
+        container->remove(widget1);
+        REQUIRE(container->isRedrawNeeded());
+        container->draw();
+
+        widget2->invalidate();
+        REQUIRE(container->isRedrawNeeded());
+        container->draw();
+        REQUIRE(!container->isRedrawNeeded());
+
+        REQUIRE(!container->isRetainedRenderingEnabled());
+        container->setRetainedRenderingEnabled(true);
+        REQUIRE(container->isRetainedRenderingEnabled());
+        REQUIRE(container->isRedrawNeeded());
+        container->draw();
+        REQUIRE(!container->isRedrawNeeded());
+        container->draw();
+        REQUIRE(!container->isRedrawNeeded());
+
+        container->setRetainedRenderingEnabled(false);
+        REQUIRE(!container->isRetainedRenderingEnabled());
+    }
+
+    SECTION("Redraw needed after data provider changes")
+    {
+        struct Provider : public tgui::ItemDataProvider
+        {
+            std::size_t getRowCount() const override
+            {
+                return rows;
+            }
+
+            sf::String getCellText(std::size_t row, std::size_t) const override
+            {
+                return "Item " + std::to_string(row);
+            }
+
+            std::size_t rows = 5;
+        };
+
+        sf::RenderTexture target;
+        target.create(200, 100);
+        container->setTarget(target);
+        container->setRetainedRenderingEnabled(true);
+
+        auto provider = std::make_shared<Provider>();
+        auto listBox = tgui::ListBox::create();
+        auto listView = tgui::ListView::create();
+        listView->addColumn("Column");
+        listBox->setDataProvider(provider);
+        listView->setDataProvider(provider);
+        container->add(listBox);
+        container->add(listView);
+        container->draw();
+        REQUIRE(!container->isRedrawNeeded());
+
+        provider->rows = 7;
+        listBox->notifyItemsInserted(5, 2);
+        REQUIRE(container->isRedrawNeeded());
+        container->draw();
+        listView->notifyItemsInserted(5, 2);
+        REQUIRE(container->isRedrawNeeded());
+        container->draw();
+
+        listBox->notifyItemsChanged(0, 1);
+        REQUIRE(container->isRedrawNeeded());
+        container->draw();
+        listView->notifyItemsChanged(0, 1);
+        REQUIRE(container->isRedrawNeeded());
+        container->draw();
+
+        provider->rows = 6;
+        listBox->notifyItemsRemoved(2, 1);
+        REQUIRE(container->isRedrawNeeded());
+        container->draw();
+        listView->notifyItemsRemoved(2, 1);
+        REQUIRE(container->isRedrawNeeded());
+        container->draw();
+        REQUIRE(!container->isRedrawNeeded());
+    }
+
+    SECTION("Spatial index")
+    {
+        auto group = tgui::Group::create({400, 400});
+        REQUIRE(group->getSpatialIndexCellSize() == 0);
+        group->setSpatialIndexCellSize(50);
+        REQUIRE(group->getSpatialIndexCellSize() == 50);
+
+        tgui::Widget* widgetBelowMouse = nullptr;
+        std::vector<tgui::ClickableWidget::Ptr> widgets;
+        for (unsigned int i = 0; i < 64; ++i)
+        {
+            auto widget = tgui::ClickableWidget::create({40, 40});
+            widget->setPosition(50.f * (i % 8), 50.f * (i / 8));
+            tgui::Widget* rawWidget = widget.get();
+            widget->connect("MouseEntered", [&widgetBelowMouse, rawWidget]{ widgetBelowMouse = rawWidget; });
+            widget->connect("MouseLeft", [&widgetBelowMouse]{ widgetBelowMouse = nullptr; });
+            group->add(widget);
+            widgets.push_back(widget);
+        }
+
+        group->mouseMoved({120, 170});
+        REQUIRE(widgetBelowMouse == widgets[26].get());
+
+        group->mouseMoved({145, 170});
+        REQUIRE(widgetBelowMouse == nullptr);
+
+        // Moved widgets are found at their new position, but are still drawn behind the widgets added after them
+        widgets[0]->setPosition(300, 160);
+        group->mouseMoved({10, 10});
+        REQUIRE(widgetBelowMouse == nullptr);
+        group->mouseMoved({310, 195});
+        REQUIRE(widgetBelowMouse == widgets[0].get());
+        group->mouseMoved({310, 170});
+        REQUIRE(widgetBelowMouse == widgets[30].get());
+
+        group->moveWidgetToFront(widgets[0]);
+        group->mouseMoved({315, 175});
+        REQUIRE(widgetBelowMouse == widgets[0].get());
+
+        widgets[0]->setVisible(false);
+        group->mouseMoved({310, 170});
+        REQUIRE(widgetBelowMouse == widgets[30].get());
+
+        // Widgets covering many cells are also found
+        auto background = tgui::ClickableWidget::create({1000, 1000});
+        background->setPosition(-300, -300);
+        tgui::Widget* rawBackground = background.get();
+        background->connect("MouseEntered", [&widgetBelowMouse, rawBackground]{ widgetBelowMouse = rawBackground; });
+        background->connect("MouseLeft", [&widgetBelowMouse]{ widgetBelowMouse = nullptr; });
+        group->add(background);
+        group->moveWidgetToBack(background);
+
+        group->mouseMoved({145, 170});
+        REQUIRE(widgetBelowMouse == background.get());
+        group->mouseMoved({120, 170});
+        REQUIRE(widgetBelowMouse == widgets[26].get());
+
+        group->remove(widgets[26]);
+        group->mouseMoved({125, 175});
+        REQUIRE(widgetBelowMouse == background.get());
+
+        // The result is the same when the grid is disabled again
+        group->setSpatialIndexCellSize(0);
+        REQUIRE(group->getSpatialIndexCellSize() == 0);
+        group->mouseMoved({310, 170});
+        REQUIRE(widgetBelowMouse == widgets[30].get());
+    }
+
     // TODO: Events
     //       Test parameter of Widget::disable
 }
@@ -35,4 +35,17 @@ TEST_CASE("[Font]")
     REQUIRE(tgui::Font(font1).getFont() != nullptr);
     REQUIRE(tgui::Font(font2).getFont() == font2);
     REQUIRE(tgui::Font("resources/DejaVuSans.ttf").getFont() != nullptr);
+
+    tgui::Font font3{"resources/DejaVuSans.ttf"};
+    const tgui::GlyphAdvanceTable& glyphAdvances = font3.getGlyphAdvanceTable(20, false);
+    REQUIRE(&tgui::Font(font3).getGlyphAdvanceTable(20, false) == &glyphAdvances);
+    REQUIRE(&font3.getGlyphAdvanceTable(20, true) != &glyphAdvances);
+    for (const std::uint32_t codePoint : {U'A', U'V', U'\u00E9', U'\u0416'})
+    {
+        // The second call returns the value that was stored in the table by the first call
+        REQUIRE(glyphAdvances.getAdvance(codePoint) == font3.getGlyph(codePoint, 20, false).advance);
+        REQUIRE(glyphAdvances.getAdvance(codePoint) == font3.getGlyph(codePoint, 20, false).advance);
+        REQUIRE(glyphAdvances.getKerning(U'A', codePoint) == font3.getKerning(U'A', codePoint, 20));
+        REQUIRE(glyphAdvances.getKerning(codePoint, U'A') == font3.getKerning(codePoint, U'A', 20));
+    }
 }
@@ -407,6 +407,83 @@ TEST_CASE("[Layouts]")
         }
     }
 
+    SECTION("Reusing parsed expressions")
+    {
+        // Parsed expressions are cached, but each layout must still bind to its own widgets
+        auto panel1 = std::make_shared<tgui::Panel>();
+        auto panel2 = std::make_shared<tgui::Panel>();
+        panel1->getRenderer()->setBorders(0);
+        panel2->getRenderer()->setBorders(0);
+        panel1->setSize(100, 50);
+        panel2->setSize(300, 150);
+
+        auto button1 = std::make_shared<tgui::Button>();
+        auto button2 = std::make_shared<tgui::Button>();
+        panel1->add(button1);
+        panel2->add(button2);
+        button1->setSize({"min(&.w - 20, 250)", "50%"});
+        button2->setSize({"min(&.w - 20, 250)", "50%"});
+        REQUIRE(button1->getSize() == sf::Vector2f(80, 25));
+        REQUIRE(button2->getSize() == sf::Vector2f(250, 75));
+        REQUIRE(button1->getSizeLayout().toString() == button2->getSizeLayout().toString());
+
+        panel1->setSize(200, 20);
+        REQUIRE(button1->getSize() == sf::Vector2f(180, 10));
+        REQUIRE(button2->getSize() == sf::Vector2f(250, 75));
+
+        REQUIRE(Layout("2 * 3").getValue() == 6);
+        REQUIRE(Layout("2 * 3").toString() == "2 * 3");
+        REQUIRE(!Layout("2 * 3").isConstant());
+    }
+
+    SECTION("Deferred recalculation")
+    {
+        auto panel = std::make_shared<tgui::Panel>();
+        panel->getRenderer()->setBorders(0);
+        panel->setSize(200, 100);
+
+        auto button1 = std::make_shared<tgui::Button>();
+        auto button2 = std::make_shared<tgui::Button>();
+        auto button3 = std::make_shared<tgui::Button>();
+        panel->add(button1, "b1");
+        panel->add(button2, "b2");
+        panel->add(button3, "b3");
+
+        // Button 2 depends on the panel both directly and through button 1, button 3 depends on button 2
+        button1->setSize({"&.w / 2", 20});
+        button2->setSize({"&.w - b1.w", 20});
+        button3->setPosition({"b2.right", "b2.bottom"});
+        REQUIRE(button2->getSize() == sf::Vector2f(100, 20));
+        REQUIRE(button3->getPosition() == sf::Vector2f(100, 20));
+
+        unsigned int button2SizeChanges = 0;
+        unsigned int button3PositionChanges = 0;
+        button2->connect("SizeChanged", [&]{ ++button2SizeChanges; });
+        button3->connect("PositionChanged", [&]{ ++button3PositionChanges; });
+
+        Layout::beginDeferredRecalculation();
+        panel->setSize(400, 100);
+        Layout::beginDeferredRecalculation();
+        panel->setSize(300, 50);
+        Layout::endDeferredRecalculation();
+
+        // Nothing is updated until the outermost scope ends
+        REQUIRE(button2->getSize() == sf::Vector2f(100, 20));
+        REQUIRE(button2SizeChanges == 0);
+        Layout::endDeferredRecalculation();
+
+        REQUIRE(button1->getSize() == sf::Vector2f(150, 20));
+        REQUIRE(button2->getSize() == sf::Vector2f(150, 20));
+        REQUIRE(button3->getPosition() == sf::Vector2f(150, 20));
+        REQUIRE(button2SizeChanges == 1);
+        REQUIRE(button3PositionChanges == 1);
+
+        // Without deferring, the changes are still applied immediately
+        panel->setSize(100, 50);
+        REQUIRE(button2->getSize() == sf::Vector2f(50, 20));
+        REQUIRE(button3->getPosition() == sf::Vector2f(50, 20));
+    }
+
     SECTION("Bug Fixes")
     {
         SECTION("Setting negative size and reverting back to positive (https://github.com/texus/TGUI/issues/54)")
@@ -83,6 +83,28 @@ TEST_CASE("[Theme]")
         REQUIRE(!theme.removeRenderer("nonexistent"));
     }
 
+    SECTION("Transaction")
+    {
+        tgui::Theme theme;
+        auto label = tgui::Label::create();
+        label->setRenderer(theme.getRenderer("label1"));
+
+        unsigned int notifications = 0;
+        label->getSharedRenderer()->subscribe(&notifications, [&](const std::vector<tgui::RendererProperty>&){ ++notifications; });
+
+        theme.beginTransaction();
+        tgui::LabelRenderer(theme.getRenderer("label1")).setTextColor(sf::Color::Red);
+        tgui::LabelRenderer(theme.getRenderer("label1")).setBorders(2);
+        REQUIRE(notifications == 0);
+        theme.commitTransaction();
+
+        REQUIRE(notifications == 1);
+        REQUIRE(label->getSharedRenderer()->getTextColor() == sf::Color::Red);
+        REQUIRE(label->getSharedRenderer()->getBorders() == tgui::Borders(2));
+
+        label->getSharedRenderer()->unsubscribe(&notifications);
+    }
+
     SECTION("Renderers are shared")
     {
         tgui::Theme theme{"resources/Black.txt"};
@@ -0,0 +1,151 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2019 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include "Tests.hpp"
+#include <TGUI/RenderBatch.hpp>
+#include <TGUI/Widgets/Button.hpp>
+#include <SFML/Graphics/RectangleShape.hpp>
+
+namespace
+{
+    // Widget that doesn't promise that it only draws via the render batch
+    class CustomButton : public tgui::Button
+    {
+    };
+}
+
+TEST_CASE("[RenderBatch]")
+{
+    sf::RenderTexture target;
+    target.create(100, 100);
+
+    const sf::Vertex quad[] = {
+        {{10, 10}, sf::Color::Red},
+        {{10, 20}, sf::Color::Red},
+        {{20, 10}, sf::Color::Red},
+        {{20, 20}, sf::Color::Red}
+    };
+
+    SECTION("Merging triangles")
+    {
+        const std::size_t drawCallCount = tgui::RenderBatch::getDrawCallCount();
+        {
+            tgui::RenderBatch batch{target};
+            tgui::RenderBatch::draw(target, quad, 4, sf::PrimitiveType::TrianglesStrip);
+
+            sf::RectangleShape rect{{5, 5}};
+            rect.setFillColor(sf::Color::Green);
+            tgui::RenderBatch::draw(target, rect);
+
+            sf::RenderStates states;
+            states.transform.translate(30, 30);
+            tgui::RenderBatch::draw(target, quad, 4, sf::PrimitiveType::TrianglesStrip, states);
+
+            REQUIRE(tgui::RenderBatch::getDrawCallCount() == drawCallCount);
+        }
+        REQUIRE(tgui::RenderBatch::getDrawCallCount() == drawCallCount + 1);
+    }
+
+    SECTION("Flushing")
+    {
+        const std::size_t drawCallCount = tgui::RenderBatch::getDrawCallCount();
+        {
+            tgui::RenderBatch batch{target};
+            tgui::RenderBatch::draw(target, quad, 4, sf::PrimitiveType::TrianglesStrip);
+
+            // Anything that can't be merged draws the collected triangles first
+            tgui::RenderBatch::draw(target, quad, 4, sf::PrimitiveType::Lines);
+            REQUIRE(tgui::RenderBatch::getDrawCallCount() == drawCallCount + 2);
+
+            // A different blend mode can't be merged either
+            tgui::RenderBatch::draw(target, quad, 4, sf::PrimitiveType::TrianglesStrip);
+            tgui::RenderBatch::draw(target, quad, 4, sf::PrimitiveType::TrianglesStrip, sf::BlendAdd);
+            REQUIRE(tgui::RenderBatch::getDrawCallCount() == drawCallCount + 3);
+
+            tgui::RenderBatch::flush(target);
+            REQUIRE(tgui::RenderBatch::getDrawCallCount() == drawCallCount + 4);
+        }
+        REQUIRE(tgui::RenderBatch::getDrawCallCount() == drawCallCount + 4);
+    }
+
+    SECTION("Disabled batch")
+    {
+        const std::size_t drawCallCount = tgui::RenderBatch::getDrawCallCount();
+        {
+            tgui::RenderBatch batch{target};
+            tgui::RenderBatch::draw(target, quad, 4, sf::PrimitiveType::TrianglesStrip);
+            {
+                tgui::RenderBatch unbatched{target, false};
+                REQUIRE(tgui::RenderBatch::getDrawCallCount() == drawCallCount + 1);
+
+                tgui::RenderBatch::draw(target, quad, 4, sf::PrimitiveType::TrianglesStrip);
+                tgui::RenderBatch::draw(target, quad, 4, sf::PrimitiveType::TrianglesStrip);
+                REQUIRE(tgui::RenderBatch::getDrawCallCount() == drawCallCount + 3);
+            }
+
+            tgui::RenderBatch::draw(target, quad, 4, sf::PrimitiveType::TrianglesStrip);
+            tgui::RenderBatch::draw(target, quad, 4, sf::PrimitiveType::TrianglesStrip);
+        }
+        REQUIRE(tgui::RenderBatch::getDrawCallCount() == drawCallCount + 4);
+    }
+
+    SECTION("Widgets")
+    {
+        tgui::Gui gui{target};
+
+        SECTION("Batched")
+        {
+            for (unsigned int i = 0; i < 20; ++i)
+            {
+                auto button = tgui::Button::create();
+                button->setPosition({(i % 5) * 20.f, (i / 5) * 20.f});
+                button->setSize({15, 15});
+                gui.add(button);
+            }
+
+            const std::size_t drawCallCount = tgui::RenderBatch::getDrawCallCount();
+            gui.draw();
+
+            // The backgrounds and borders of all buttons are drawn together
+            REQUIRE(tgui::RenderBatch::getDrawCallCount() == drawCallCount + 1);
+        }
+
+        SECTION("Unbatched")
+        {
+            for (unsigned int i = 0; i < 20; ++i)
+            {
+                auto button = std::make_shared<CustomButton>();
+                button->setPosition({(i % 5) * 20.f, (i / 5) * 20.f});
+                button->setSize({15, 15});
+                gui.add(button);
+            }
+
+            // Derived widgets may call target.draw themselves, so their geometry is drawn immediately
+            const std::size_t drawCallCount = tgui::RenderBatch::getDrawCallCount();
+            gui.draw();
+            REQUIRE(tgui::RenderBatch::getDrawCallCount() >= drawCallCount + 40);
+        }
+    }
+}
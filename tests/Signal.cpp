@@ -62,7 +62,12 @@ TEST_CASE("[Signal]")
         REQUIRE(widget->connect("AnimationFinished", [](bool){}) == ++id);
         REQUIRE(widget->connect("AnimationFinished", [](tgui::ShowAnimationType, bool){}) == ++id);
 
+        REQUIRE(widget->connect("positionchanged", [](){}) == ++id);
+        REQUIRE(widget->connect("MOUSEENTERED", [](){}) == ++id);
+
         REQUIRE_THROWS_AS(widget->connect("SomeInvalidSignal", [](){}), tgui::Exception);
+        REQUIRE_THROWS_AS(widget->connect("Pressed", [](){}), tgui::Exception);
+        REQUIRE_THROWS_AS(widget->disconnectAll("SomeInvalidSignal"), tgui::Exception);
 
         tgui::Widget::Ptr widget2 = tgui::Button::create();
         REQUIRE(widget2->connect("Pressed", [](){}) == ++id);
@@ -140,5 +145,44 @@ TEST_CASE("[Signal]")
         widget->setPosition(60, 60);
         widget->setSize(400, 100);
         REQUIRE(i == 4);
+
+        id = widget->connect("PositionChanged", [&](){ i++; });
+        REQUIRE(widget->disconnect(id));
+        REQUIRE(!widget->disconnect(id));
+    }
+
+    SECTION("Connecting and disconnecting from inside handler")
+    {
+        unsigned int count1 = 0;
+        unsigned int count2 = 0;
+        unsigned int count3 = 0;
+        unsigned int id1 = 0;
+        id1 = widget->connect("PositionChanged", [&](){
+                count1++;
+                widget->disconnect(id1);
+                widget->connect("PositionChanged", [&](){ count3++; });
+            });
+        widget->connect("PositionChanged", [&](tgui::Vector2f pos){ count2++; REQUIRE(pos == widget->getPosition()); });
+
+        // Handlers that are disconnected during the emit are still called, new handlers are only called on the next emit
+        widget->setPosition(10, 10);
+        REQUIRE(count1 == 1);
+        REQUIRE(count2 == 1);
+        REQUIRE(count3 == 0);
+
+        widget->setPosition(20, 20);
+        REQUIRE(count1 == 1);
+        REQUIRE(count2 == 2);
+        REQUIRE(count3 == 1);
+
+        widget->connect("SizeChanged", [&](){ widget->disconnectAll(); });
+        widget->connect("SizeChanged", [&](){ count3++; });
+        widget->setSize(100, 25);
+        REQUIRE(count3 == 2);
+
+        widget->setSize(200, 50);
+        widget->setPosition(30, 30);
+        REQUIRE(count2 == 2);
+        REQUIRE(count3 == 2);
     }
 }
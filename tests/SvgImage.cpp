@@ -24,6 +24,7 @@
 
 #include "Tests.hpp"
 #include <TGUI/SvgImage.hpp>
+#include <TGUI/WorkerPool.hpp>
 #include <TGUI/Widgets/Picture.hpp>
 
 TEST_CASE("[SvgImage]")
@@ -52,6 +53,68 @@ TEST_CASE("[SvgImage]")
         REQUIRE(texture.getSize() == sf::Vector2u{100, 100});
     }
 
+    SECTION("Raster cache")
+    {
+        const std::size_t oldBudget = tgui::SvgImage::getRasterCacheBudget();
+        {
+            tgui::SvgImage svgImage{"resources/SFML.svg"};
+
+            auto texture1 = svgImage.getRasterizedTexture({100, 100});
+            REQUIRE(texture1 != nullptr);
+            REQUIRE(texture1->getSize() == sf::Vector2u{100, 100});
+            REQUIRE(svgImage.getRasterizedTexture({100, 100}) == texture1);
+
+            auto texture2 = svgImage.getRasterizedTexture({50, 50});
+            REQUIRE(texture2 != nullptr);
+            REQUIRE(texture2 != texture1);
+            REQUIRE(svgImage.getRasterizedTexture({100, 100}) == texture1);
+
+            // The least recently used texture is removed when the budget is exceeded
+            tgui::SvgImage::setRasterCacheBudget(100 * 100 * 4);
+            REQUIRE(tgui::SvgImage::getRasterCacheBudget() == 100 * 100 * 4);
+            REQUIRE(tgui::SvgImage::getRasterCacheUsage() == 100 * 100 * 4);
+            REQUIRE(svgImage.getRasterizedTexture({100, 100}) == texture1);
+            REQUIRE(svgImage.getRasterizedTexture({50, 50}) != texture2);
+            REQUIRE(tgui::SvgImage::getRasterCacheUsage() == 50 * 50 * 4);
+
+            REQUIRE(svgImage.getRasterizedTexture({0, 50}) == nullptr);
+        }
+        REQUIRE(tgui::SvgImage::getRasterCacheUsage() == 0);
+
+        tgui::SvgImage::setRasterCacheBudget(oldBudget);
+    }
+
+    SECTION("Async rasterization")
+    {
+        tgui::SvgImage svgImage{"resources/SFML.svg"};
+
+        REQUIRE(svgImage.requestRasterizedTexture({100, 100}) == nullptr);
+        REQUIRE(svgImage.requestRasterizedTexture({0, 100}) == nullptr);
+
+        // The texture is created on the gui thread once the worker thread is done
+        tgui::WorkerPool::waitForTasks();
+        REQUIRE(svgImage.requestRasterizedTexture({100, 100}) == nullptr);
+        REQUIRE(tgui::WorkerPool::processFinishedTasks());
+
+        auto texture = svgImage.requestRasterizedTexture({100, 100});
+        REQUIRE(texture != nullptr);
+        REQUIRE(texture->getSize() == sf::Vector2u{100, 100});
+        REQUIRE(svgImage.getRasterizedTexture({100, 100}) == texture);
+
+        // Requesting the texture synchronously while it is still being rasterized doesn't wait for the worker
+        REQUIRE(svgImage.requestRasterizedTexture({50, 50}) == nullptr);
+        auto texture2 = svgImage.getRasterizedTexture({50, 50});
+        REQUIRE(texture2 != nullptr);
+        tgui::WorkerPool::waitForTasks();
+        tgui::WorkerPool::processFinishedTasks();
+        REQUIRE(svgImage.requestRasterizedTexture({50, 50}) == texture2);
+
+        tgui::SvgImage::setAsyncRasterizationEnabled(true);
+        REQUIRE(tgui::SvgImage::isAsyncRasterizationEnabled());
+        tgui::SvgImage::setAsyncRasterizationEnabled(false);
+        REQUIRE(!tgui::SvgImage::isAsyncRasterizationEnabled());
+    }
+
     SECTION("Drawing svg")
     {
         auto picture = tgui::Picture::create("resources/SFML.svg");
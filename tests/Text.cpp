@@ -135,4 +135,51 @@ TEST_CASE("[Text]")
             REQUIRE(text.getSize().y == text3.getSize().y);
         }
     }
+
+    SECTION("Layout cache")
+    {
+        tgui::Font font{"resources/DejaVuSans.ttf"};
+        const sf::String string = "Some text that is long enough to be wrapped";
+
+        const std::size_t oldMisses = tgui::Text::getLayoutCacheMisses();
+        const float width = tgui::Text::getLineWidth(string, font, 20);
+        const sf::String wrapped = tgui::Text::wordWrap(width / 2, string, font, 20, false);
+        REQUIRE(tgui::Text::getLayoutCacheMisses() == oldMisses + 2);
+
+        const std::size_t oldHits = tgui::Text::getLayoutCacheHits();
+        REQUIRE(tgui::Text::getLineWidth(string, font, 20) == width);
+        REQUIRE(tgui::Text::wordWrap(width / 2, string, font, 20, false) == wrapped);
+        REQUIRE(tgui::Text::getLayoutCacheHits() == oldHits + 2);
+        REQUIRE(tgui::Text::getLayoutCacheMisses() == oldMisses + 2);
+
+        REQUIRE(wrapped.find("\n") != sf::String::InvalidPos);
+
+        // Results for different parameters aren't taken from the cache
+        REQUIRE(tgui::Text::wordWrap(width / 2, string, font, 20, false, false) != sf::String{});
+        REQUIRE(tgui::Text::getLineWidth(string, font, 20, sf::Text::Bold) > width);
+        REQUIRE(tgui::Text::getLayoutCacheMisses() == oldMisses + 4);
+    }
+
+    SECTION("Best text size")
+    {
+        tgui::Font font{"resources/DejaVuSans.ttf"};
+        REQUIRE(tgui::Text::findBestTextSize(nullptr, 20) == 0);
+        REQUIRE(tgui::Text::findBestTextSize(font, 1) == 1);
+
+        for (float height = 2; height < 60; height += 3.5f)
+        {
+            // The largest text size is the smallest one for which the text is at least as high as requested
+            const unsigned int high = tgui::Text::findBestTextSize(font, height, 1);
+            REQUIRE(tgui::Text::getLineHeight(font, high) >= height);
+            REQUIRE(((high == 1) || (tgui::Text::getLineHeight(font, high - 1) < height)));
+
+            const unsigned int low = tgui::Text::findBestTextSize(font, height, -1);
+            REQUIRE(low <= high);
+            REQUIRE(high - low <= 1);
+
+            const unsigned int best = tgui::Text::findBestTextSize(font, height);
+            REQUIRE(((best == low) || (best == high)));
+            REQUIRE(tgui::Text::findBestTextSize(font, height) == best);
+        }
+    }
 }
@@ -0,0 +1,136 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2019 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include "Tests.hpp"
+#include <TGUI/TextRope.hpp>
+
+TEST_CASE("[TextRope]")
+{
+    tgui::TextRope rope;
+
+    SECTION("Empty")
+    {
+        REQUIRE(rope.isEmpty());
+        REQUIRE(rope.getSize() == 0);
+        REQUIRE(rope.toString() == "");
+        REQUIRE(rope.substring(0) == "");
+
+        rope.erase(0, 5);
+        REQUIRE(rope.isEmpty());
+    }
+
+    SECTION("Assign")
+    {
+        rope = "Hello world";
+        REQUIRE(!rope.isEmpty());
+        REQUIRE(rope.getSize() == 11);
+        REQUIRE(rope.toString() == "Hello world");
+        REQUIRE(rope[0] == 'H');
+        REQUIRE(rope[10] == 'd');
+
+        rope.clear();
+        REQUIRE(rope.isEmpty());
+        REQUIRE(rope.toString() == "");
+    }
+
+    SECTION("Insert")
+    {
+        rope.insert(0, "world");
+        rope.insert(0, "Hello ");
+        rope.insert(11, "!");
+        rope.insert(5, ",");
+        REQUIRE(rope.getSize() == 13);
+        REQUIRE(rope.toString() == "Hello, world!");
+
+        rope.insert(3, "");
+        REQUIRE(rope.toString() == "Hello, world!");
+    }
+
+    SECTION("Erase")
+    {
+        rope = "Hello, world!";
+        rope.erase(5);
+        REQUIRE(rope.toString() == "Hello world!");
+        rope.erase(5, 6);
+        REQUIRE(rope.toString() == "Hello!");
+        rope.erase(4, 100);
+        REQUIRE(rope.toString() == "Hell");
+        rope.erase(0, 4);
+        REQUIRE(rope.isEmpty());
+    }
+
+    SECTION("Substring")
+    {
+        rope = "Hello world";
+        REQUIRE(rope.substring(6) == "world");
+        REQUIRE(rope.substring(0, 5) == "Hello");
+        REQUIRE(rope.substring(4, 3) == "o w");
+        REQUIRE(rope.substring(8, 100) == "rld");
+        REQUIRE(rope.substring(11) == "");
+    }
+
+    SECTION("Copy")
+    {
+        rope = "Hello";
+        tgui::TextRope rope2 = rope;
+        rope2.insert(5, " world");
+        REQUIRE(rope.toString() == "Hello");
+        REQUIRE(rope2.toString() == "Hello world");
+
+        rope = rope2;
+        rope2.clear();
+        REQUIRE(rope.toString() == "Hello world");
+        REQUIRE(rope2.isEmpty());
+    }
+
+    SECTION("Large text")
+    {
+        // Build the same text in a rope and in a string by editing at different positions, so that chunks are split and merged
+        sf::String expected;
+        for (unsigned int i = 0; i < 5000; ++i)
+        {
+            const sf::String part = std::to_string(i) + ((i % 10 == 0) ? "\n" : " ");
+            const std::size_t pos = (expected.getSize() * (i % 7)) / 7;
+            expected.insert(pos, part);
+            rope.insert(pos, part);
+        }
+
+        REQUIRE(rope.getSize() == expected.getSize());
+        REQUIRE(rope.toString() == expected);
+
+        for (unsigned int i = 0; i < 1000; ++i)
+        {
+            const std::size_t pos = (expected.getSize() * (i % 5)) / 5;
+            const std::size_t count = (i % 3 == 0) ? 30 : 3;
+            expected.erase(pos, std::min(count, expected.getSize() - pos));
+            rope.erase(pos, count);
+        }
+
+        REQUIRE(rope.getSize() == expected.getSize());
+        REQUIRE(rope.toString() == expected);
+        REQUIRE(rope.substring(1000, 2000) == expected.substring(1000, 2000));
+        REQUIRE(rope[expected.getSize() / 2] == expected[expected.getSize() / 2]);
+    }
+}
@@ -52,4 +52,78 @@ TEST_CASE("[TextureManager]")
     REQUIRE_NOTHROW(tgui::TextureManager::removeTexture(textureData1));
     REQUIRE_NOTHROW(tgui::TextureManager::removeTexture(textureData1));
     REQUIRE_THROWS_AS(tgui::TextureManager::removeTexture(textureData1), tgui::Exception);
+
+    REQUIRE(!tgui::TextureManager::isTextureAtlasEnabled());
+    tgui::TextureManager::setTextureAtlasEnabled(true);
+    REQUIRE(tgui::TextureManager::isTextureAtlasEnabled());
+    {
+        tgui::Texture part1{"resources/image.png", {0, 0, 20, 50}};
+        tgui::Texture part2{"resources/image.png", {20, 10, 40, 40}};
+        REQUIRE(part1.getData() != part2.getData());
+        REQUIRE(part1.getData()->atlasTexture != nullptr);
+        REQUIRE(part1.getData()->atlasTexture == part2.getData()->atlasTexture);
+        REQUIRE(part1.getData()->atlasRect == sf::IntRect(0, 0, 20, 50));
+        REQUIRE(part2.getData()->atlasRect == sf::IntRect(20, 10, 30, 40));
+        REQUIRE(part2.getImageSize() == sf::Vector2f(30, 40));
+        REQUIRE(part2.getMiddleRect() == sf::IntRect(0, 0, 30, 40));
+    }
+    tgui::TextureManager::setTextureAtlasEnabled(false);
+
+    REQUIRE(tgui::TextureManager::getKeepImagesInMemory());
+    tgui::TextureManager::setKeepImagesInMemory(false);
+    REQUIRE(!tgui::TextureManager::getKeepImagesInMemory());
+    {
+        tgui::Texture textureWithImage;
+        tgui::TextureManager::setKeepImagesInMemory(true);
+        textureWithImage.load("resources/image.png", {10, 5, 30, 40});
+        tgui::TextureManager::setKeepImagesInMemory(false);
+
+        tgui::Texture textureWithMask{"resources/image.png", {0, 0, 40, 50}};
+        REQUIRE(textureWithMask.getData()->image == nullptr);
+        REQUIRE(textureWithMask.getData()->alphaMask != nullptr);
+        REQUIRE(textureWithMask.getData()->imageSize == sf::Vector2u(50, 50));
+        for (unsigned int x = 0; x < 30; x += 3)
+        {
+            for (unsigned int y = 0; y < 40; y += 3)
+                REQUIRE(textureWithMask.isTransparentPixel({x + 10, y + 5}) == textureWithImage.isTransparentPixel({x, y}));
+        }
+    }
+    tgui::TextureManager::setKeepImagesInMemory(true);
+
+    REQUIRE(!tgui::TextureManager::isAsyncLoadingEnabled());
+    tgui::TextureManager::setAsyncLoadingEnabled(true);
+    REQUIRE(tgui::TextureManager::isAsyncLoadingEnabled());
+    {
+        tgui::Texture part1{"resources/image.png", {0, 0, 20, 50}};
+        tgui::Texture part2{"resources/image.png", {20, 10, 40, 40}};
+        REQUIRE(part1.getData()->loading);
+        REQUIRE(part2.getData()->loading);
+        REQUIRE(part2.getImageSize() == sf::Vector2f(0, 0));
+        REQUIRE(tgui::TextureManager::getLoadingImageCount() == 1);
+
+        REQUIRE_NOTHROW(tgui::Texture{"resources/nonexistent.png"});
+
+        bool loaded = false;
+        tgui::TextureManager::addLoadingFinishedCallback([&]{ loaded = true; });
+        REQUIRE(!loaded);
+
+        tgui::TextureManager::waitUntilLoaded();
+        REQUIRE(loaded);
+        REQUIRE(tgui::TextureManager::getLoadingImageCount() == 0);
+        REQUIRE(!part1.getData()->loading);
+        REQUIRE(!part2.getData()->loading);
+        REQUIRE(part1.getImageSize() == sf::Vector2f(20, 50));
+        REQUIRE(part2.getImageSize() == sf::Vector2f(30, 40));
+        REQUIRE(part2.getMiddleRect() == sf::IntRect(0, 0, 30, 40));
+
+        loaded = false;
+        tgui::TextureManager::addLoadingFinishedCallback([&]{ loaded = true; });
+        REQUIRE(loaded);
+    }
+    tgui::TextureManager::setAsyncLoadingEnabled(false);
+
+    REQUIRE(tgui::TextureManager::getLoadingColor() == tgui::Color(200, 200, 200));
+    tgui::TextureManager::setLoadingColor(tgui::Color::Red);
+    REQUIRE(tgui::TextureManager::getLoadingColor() == tgui::Color::Red);
+    tgui::TextureManager::setLoadingColor({200, 200, 200});
 }
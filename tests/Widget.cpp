@@ -289,6 +289,75 @@ TEST_CASE("[Widget]")
             REQUIRE(renderer->getProperty("NonexistentProperty").getString() == "Text");
         }
 
+        SECTION("Property ids")
+        {
+            REQUIRE(tgui::getRendererProperty("opacity") == tgui::RendererProperty::Opacity);
+            REQUIRE(tgui::getRendererPropertyName(tgui::RendererProperty::OpacityDisabled) == "opacitydisabled");
+
+            tgui::RendererProperty property;
+            REQUIRE(!tgui::findRendererProperty("someunknownproperty", property));
+            const tgui::RendererProperty customProperty = tgui::getRendererProperty("someunknownproperty");
+            REQUIRE(tgui::findRendererProperty("someunknownproperty", property));
+            REQUIRE(property == customProperty);
+            REQUIRE(tgui::getRendererProperty("someunknownproperty") == customProperty);
+            REQUIRE(tgui::getRendererPropertyName(customProperty) == "someunknownproperty");
+
+            renderer->setProperty(tgui::RendererProperty::Opacity, 0.25f);
+            REQUIRE(renderer->getOpacity() == 0.25f);
+            REQUIRE(renderer->getProperty("Opacity").getNumber() == 0.25f);
+            REQUIRE(renderer->getProperty(tgui::RendererProperty::Opacity).getNumber() == 0.25f);
+
+            // References to values stay valid when more properties are added
+            tgui::RendererPropertyValues values;
+            tgui::ObjectConverter& value = values[tgui::RendererProperty::Opacity];
+            value = 0.5f;
+            for (unsigned int i = 0; i < static_cast<unsigned int>(customProperty); ++i)
+                values[static_cast<tgui::RendererProperty>(i)];
+            REQUIRE(&value == &values[tgui::RendererProperty::Opacity]);
+            REQUIRE(value.getNumber() == 0.5f);
+
+            tgui::RendererPropertyValues copiedValues = values;
+            REQUIRE(copiedValues.size() == values.size());
+            REQUIRE(copiedValues.find(tgui::RendererProperty::Opacity)->second.getNumber() == 0.5f);
+            REQUIRE(&copiedValues.find(tgui::RendererProperty::Opacity)->second != &value);
+        }
+
+        SECTION("Transaction")
+        {
+            unsigned int notifications = 0;
+            std::vector<tgui::RendererProperty> changedProperties;
+            renderer->subscribe(&notifications, [&](const std::vector<tgui::RendererProperty>& properties){
+                ++notifications;
+                changedProperties = properties;
+            });
+
+            renderer->beginTransaction();
+            renderer->setOpacity(0.5f);
+            renderer->beginTransaction();
+            renderer->setTransparentTexture(true);
+            renderer->setOpacity(0.8f);
+            renderer->commitTransaction();
+            REQUIRE(notifications == 0);
+            renderer->commitTransaction();
+
+            REQUIRE(notifications == 1);
+            REQUIRE(changedProperties.size() == 2);
+            REQUIRE(changedProperties[0] == tgui::RendererProperty::Opacity);
+            REQUIRE(changedProperties[1] == tgui::RendererProperty::TransparentTexture);
+
+            // Committing without any changes doesn't notify the widgets
+            renderer->beginTransaction();
+            renderer->setOpacity(0.8f);
+            renderer->commitTransaction();
+            REQUIRE(notifications == 1);
+
+            renderer->setOpacity(0.2f);
+            REQUIRE(notifications == 2);
+            REQUIRE(changedProperties.size() == 1);
+
+            renderer->unsubscribe(&notifications);
+        }
+
         SECTION("Clone")
         {
             renderer->setOpacity(0.5f);
@@ -24,6 +24,7 @@
 
 #include "Tests.hpp"
 #include <TGUI/Widgets/BitmapButton.hpp>
+#include <TGUI/TextureManager.hpp>
 
 TEST_CASE("[BitmapButton]")
 {
@@ -84,6 +85,23 @@ TEST_CASE("[BitmapButton]")
         REQUIRE(button->getImageScaling() == 0.5f);
     }
 
+    SECTION("Image loaded asynchronously")
+    {
+        tgui::TextureManager::setAsyncLoadingEnabled(true);
+        button->setImageScaling(0.5f);
+        button->setImage("resources/image.png");
+        REQUIRE(button->getSize().x == button->getSize().x); // The size isn't NaN while the image has no size yet
+
+        tgui::TextureManager::waitUntilLoaded();
+        tgui::TextureManager::setAsyncLoadingEnabled(false);
+
+        auto loadedButton = tgui::BitmapButton::create();
+        loadedButton->getRenderer()->setFont("resources/DejaVuSans.ttf");
+        loadedButton->setImageScaling(0.5f);
+        loadedButton->setImage("resources/image.png");
+        REQUIRE(button->getSize() == loadedButton->getSize());
+    }
+
     SECTION("Events / Signals")
     {
         SECTION("ClickableWidget")
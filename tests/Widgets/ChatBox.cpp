@@ -133,6 +133,29 @@ TEST_CASE("[ChatBox]")
             REQUIRE(chatBox->getLine(0) == "Line 4");
             REQUIRE(chatBox->getLine(1) == "Line 3");
         }
+
+        SECTION("Many lines")
+        {
+            chatBox->setLineLimit(500);
+            for (unsigned int i = 0; i < 1000; ++i)
+                chatBox->addLine("Line " + std::to_string(i), (i % 2) ? sf::Color::Red : sf::Color::Green);
+
+            REQUIRE(chatBox->getLineAmount() == 500);
+            REQUIRE(chatBox->getLine(0) == "Line 500");
+            REQUIRE(chatBox->getLine(499) == "Line 999");
+
+            // Resizing only rewraps the visible lines immediately, the lines must remain unchanged
+            chatBox->setSize(60, 100);
+            chatBox->setTextSize(20);
+            REQUIRE(chatBox->removeLine(0));
+            chatBox->addLine("Line 1000");
+
+            REQUIRE(chatBox->getLineAmount() == 500);
+            REQUIRE(chatBox->getLine(0) == "Line 501");
+            REQUIRE(chatBox->getLineColor(0) == sf::Color::Red);
+            REQUIRE(chatBox->getLine(499) == "Line 1000");
+            REQUIRE(chatBox->getLineColor(499) == chatBox->getTextColor());
+        }
     }
 
     SECTION("Text size")
@@ -247,6 +247,65 @@ TEST_CASE("[ListBox]")
         REQUIRE(!listBox->containsId("1"));
     }
 
+    SECTION("Data provider")
+    {
+        struct Provider : public tgui::ItemDataProvider
+        {
+            std::size_t getRowCount() const override
+            {
+                return rows;
+            }
+
+            sf::String getCellText(std::size_t row, std::size_t) const override
+            {
+                return "Item " + std::to_string(row);
+            }
+
+            sf::String getRowId(std::size_t row) const override
+            {
+                return std::to_string(row);
+            }
+
+            std::size_t rows = 500;
+        };
+
+        auto provider = std::make_shared<Provider>();
+        listBox->addItem("Removed");
+        listBox->setDataProvider(provider);
+        REQUIRE(listBox->getDataProvider() == provider);
+
+        REQUIRE(listBox->getItemCount() == 500);
+        REQUIRE(listBox->getItemByIndex(499) == "Item 499");
+        REQUIRE(listBox->getItemById("20") == "Item 20");
+        REQUIRE(listBox->contains("Item 3"));
+        REQUIRE(listBox->containsId("3"));
+        REQUIRE(!listBox->contains("Removed"));
+
+        REQUIRE(!listBox->addItem("Item"));
+        REQUIRE(!listBox->removeItemByIndex(0));
+        REQUIRE(!listBox->removeItem("Item 0"));
+        REQUIRE(!listBox->removeItemById("0"));
+        REQUIRE(!listBox->changeItem("Item 0", "Changed"));
+        REQUIRE(!listBox->changeItemById("0", "Changed"));
+        REQUIRE(!listBox->changeItemByIndex(0, "Changed"));
+        listBox->removeAllItems();
+        REQUIRE(listBox->getItemCount() == 500);
+        REQUIRE(listBox->getItemByIndex(0) == "Item 0");
+
+        REQUIRE(listBox->setSelectedItemById("7"));
+        REQUIRE(listBox->getSelectedItem() == "Item 7");
+        REQUIRE(listBox->getSelectedItemId() == "7");
+
+        provider->rows = 502;
+        listBox->notifyItemsInserted(0, 2);
+        REQUIRE(listBox->getItemCount() == 502);
+        REQUIRE(listBox->getSelectedItemIndex() == 9);
+
+        provider->rows = 500;
+        listBox->notifyItemsRemoved(8, 2);
+        REQUIRE(listBox->getSelectedItemIndex() == -1);
+    }
+
     SECTION("ItemHeight")
     {
         listBox->setItemHeight(20);
@@ -25,6 +25,8 @@
 #include "Tests.hpp"
 #include <TGUI/Widgets/ListView.hpp>
 #include <TGUI/Widgets/Group.hpp>
+#include <algorithm>
+#include <functional>
 
 TEST_CASE("[ListView]")
 {
@@ -200,6 +202,56 @@ TEST_CASE("[ListView]")
         REQUIRE(listView->getItemRows() == std::vector<std::vector<sf::String>>{{"1,1", "1,2", "1,3", ""}, {"2,1", "2,2", "", ""}});
     }
 
+    SECTION("Data provider")
+    {
+        struct Provider : public tgui::ItemDataProvider
+        {
+            std::size_t getRowCount() const override
+            {
+                return rows;
+            }
+
+            sf::String getCellText(std::size_t row, std::size_t column) const override
+            {
+                return std::to_string(row) + "," + std::to_string(column);
+            }
+
+            std::size_t rows = 1000;
+        };
+
+        auto provider = std::make_shared<Provider>();
+        listView->addColumn("Col 1");
+        listView->addColumn("Col 2");
+        listView->addItem("Removed");
+        listView->setDataProvider(provider);
+        REQUIRE(listView->getDataProvider() == provider);
+
+        REQUIRE(listView->getItemCount() == 1000);
+        REQUIRE(listView->getItem(999) == "999,0");
+        REQUIRE(listView->getItemRow(5) == std::vector<sf::String>{"5,0", "5,1"});
+        REQUIRE(listView->getItem(1000) == "");
+
+        REQUIRE(!listView->removeItem(0));
+        REQUIRE(!listView->changeItem(0, {"x"}));
+        REQUIRE(listView->getItemCount() == 1000);
+
+        listView->setSelectedItem(10);
+        provider->rows = 1010;
+        listView->notifyItemsInserted(0, 10);
+        REQUIRE(listView->getItemCount() == 1010);
+        REQUIRE(listView->getSelectedItemIndex() == 20);
+
+        provider->rows = 1005;
+        listView->notifyItemsRemoved(0, 5);
+        REQUIRE(listView->getSelectedItemIndex() == 15);
+        provider->rows = 1000;
+        listView->notifyItemsRemoved(10, 5);
+        REQUIRE(listView->getSelectedItemIndex() == -1);
+
+        listView->setDataProvider(nullptr);
+        REQUIRE(listView->getItemCount() == 0);
+    }
+
     SECTION("Selecting items")
     {
         listView->addItem("1,1");
@@ -706,6 +758,111 @@ TEST_CASE("[ListView]")
         testSavingWidget("listView", listView);
     }
 
+    SECTION("Visible item texts")
+    {
+        // The texts of the visible items are kept between draws. A list view that is changed after it was drawn must
+        // therefore look the same as a list view to which the same changes were made before drawing it for the first time.
+        const auto createListView = []{
+            auto widget = tgui::ListView::create();
+            widget->getRenderer()->setFont("resources/DejaVuSans.ttf");
+            widget->setSize(160, 100);
+            widget->setItemHeight(18);
+            widget->setTextSize(14);
+            widget->addColumn("C1", 60);
+            widget->addColumn("C2", 60);
+            for (unsigned int i = 0; i < 30; ++i)
+                widget->addItem({"Item " + std::to_string(i), "Sub " + std::to_string(i)});
+
+            return widget;
+        };
+
+        const auto drawListView = [](const tgui::ListView::Ptr& widget){
+            sf::RenderTexture target;
+            target.create(160, 100);
+            tgui::Gui gui{target};
+            gui.add(widget);
+            target.clear();
+            gui.draw();
+            target.display();
+            gui.remove(widget);
+            return target.getTexture().copyToImage();
+        };
+
+        const auto testChanges = [&](const std::vector<std::function<void(tgui::ListView&)>>& changes){
+            listView = createListView();
+            drawListView(listView);
+
+            for (std::size_t i = 0; i < changes.size(); ++i)
+            {
+                changes[i](*listView);
+                const sf::Image image = drawListView(listView);
+
+                auto expectedListView = createListView();
+                for (std::size_t j = 0; j <= i; ++j)
+                    changes[j](*expectedListView);
+                const sf::Image expectedImage = drawListView(expectedListView);
+
+                REQUIRE(image.getSize() == expectedImage.getSize());
+                REQUIRE(std::equal(image.getPixelsPtr(), image.getPixelsPtr() + image.getSize().x * image.getSize().y * 4,
+                                   expectedImage.getPixelsPtr()));
+            }
+        };
+
+        SECTION("Changing visible and scrolled-off items")
+        {
+            testChanges({
+                [](tgui::ListView& widget){ widget.changeItem(1, {"Changed 1", "Changed 1.2"}); },
+                [](tgui::ListView& widget){ widget.changeSubItem(2, 1, "Changed 2.2"); },
+                [](tgui::ListView& widget){ widget.changeItem(25, {"Changed 25", "Changed 25.2"}); },
+                [](tgui::ListView& widget){ widget.changeSubItem(26, 0, "Changed 26"); },
+                [](tgui::ListView& widget){ widget.setSelectedItem(26); },
+                [](tgui::ListView& widget){ widget.changeItem(25, {"Changed again 25"}); }
+            });
+
+            REQUIRE(listView->getItemRow(1) == std::vector<sf::String>{"Changed 1", "Changed 1.2"});
+            REQUIRE(listView->getItemRow(2) == std::vector<sf::String>{"Item 2", "Changed 2.2"});
+            REQUIRE(listView->getItemRow(25) == std::vector<sf::String>{"Changed again 25", ""});
+            REQUIRE(listView->getItemRow(26) == std::vector<sf::String>{"Changed 26", "Sub 26"});
+        }
+
+        SECTION("Text properties")
+        {
+            testChanges({
+                [](tgui::ListView& widget){ widget.setTextSize(18); },
+                [](tgui::ListView& widget){ widget.setItemHeight(25); },
+                [](tgui::ListView& widget){ widget.getRenderer()->setFont(tgui::Font{"resources/DejaVuSans.ttf"}); },
+                [](tgui::ListView& widget){ widget.setTextSize(12); }
+            });
+        }
+
+        SECTION("Scrolling")
+        {
+            testChanges({
+                [](tgui::ListView& widget){ widget.mouseWheelScrolled(-1, {30, 60}); },
+                [](tgui::ListView& widget){ widget.mouseWheelScrolled(-1, {30, 60}); },
+                [](tgui::ListView& widget){ widget.mouseWheelScrolled(1, {30, 60}); },
+                [](tgui::ListView& widget){ widget.setSelectedItem(29); },
+                [](tgui::ListView& widget){ widget.setSelectedItem(0); }
+            });
+        }
+
+        SECTION("Hover and selection")
+        {
+            testChanges({
+                [](tgui::ListView& widget){ widget.getRenderer()->setTextColorHover(sf::Color::Red); },
+                [](tgui::ListView& widget){ widget.getRenderer()->setSelectedTextColor(sf::Color::Blue); },
+                [](tgui::ListView& widget){ widget.mouseMoved({30, 60}); },
+                [](tgui::ListView& widget){ widget.setSelectedItem(1); },
+                [](tgui::ListView& widget){ widget.mouseMoved({30, 80}); },
+                [](tgui::ListView& widget){ widget.setSelectedItem(20); },
+                [](tgui::ListView& widget){ widget.mouseMoved({30, 60}); },
+                [](tgui::ListView& widget){ widget.setSelectedItem(2); },
+                [](tgui::ListView& widget){ widget.deselectItem(); },
+                [](tgui::ListView& widget){ widget.mouseNoLongerOnWidget(); }
+            });
+        }
+    }
+
     SECTION("Draw")
     {
         TEST_DRAW_INIT(180, 140, listView)
@@ -296,6 +296,32 @@ TEST_CASE("[MenuBar]")
         REQUIRE(!menuBar->getInvertedMenuDirection());
     }
 
+    SECTION("Draw bounds")
+    {
+        menuBar->setPosition(10, 5);
+        menuBar->setSize(200, 20);
+        menuBar->setMinimumSubMenuWidth(60);
+        menuBar->addMenu("File");
+        menuBar->addMenuItem("Open");
+        menuBar->addMenuItem("Quit");
+        tgui::FloatRect bounds = menuBar->getDrawBounds();
+        REQUIRE(bounds.left == 10);
+        REQUIRE(bounds.top == 5);
+        REQUIRE(bounds.width == 200);
+        REQUIRE(bounds.height == 20);
+
+        // The open menu is drawn below the bar and has to be included
+        const sf::Vector2f mousePos = {15, 15};
+        menuBar->mouseMoved(mousePos);
+        menuBar->leftMousePressed(mousePos);
+        menuBar->leftMouseReleased(mousePos);
+        bounds = menuBar->getDrawBounds();
+        REQUIRE(bounds.left == 10);
+        REQUIRE(bounds.top == 5);
+        REQUIRE(bounds.width == 200);
+        REQUIRE(bounds.height == 60);
+    }
+
     SECTION("Events / Signals")
     {
         SECTION("Widget")
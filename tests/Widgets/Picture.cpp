@@ -26,6 +26,7 @@
 #include <TGUI/Widgets/Picture.hpp>
 #include <TGUI/Widgets/Panel.hpp>
 #include <TGUI/Gui.hpp>
+#include <TGUI/TextureManager.hpp>
 
 TEST_CASE("[Picture]")
 {
@@ -61,6 +62,18 @@ TEST_CASE("[Picture]")
             REQUIRE(picture->getRenderer()->getTexture().getId() == "");
         }
 
+        SECTION("while the image is loaded asynchronously")
+        {
+            tgui::TextureManager::setAsyncLoadingEnabled(true);
+            auto loadingPicture = tgui::Picture::create("resources/image.png");
+            picture = tgui::Picture::copy(loadingPicture);
+            loadingPicture = nullptr;
+
+            // The copy gets the size of the image once it is loaded, the original no longer exists
+            tgui::TextureManager::waitUntilLoaded();
+            tgui::TextureManager::setAsyncLoadingEnabled(false);
+        }
+
         REQUIRE(picture->getSize() == sf::Vector2f(texture.getSize()));
     }
 
@@ -85,6 +85,24 @@ TEST_CASE("[TextBox]")
 
         textBox->setSelectedText(2, 2);
         REQUIRE(textBox->getSelectedText() == "");
+
+        SECTION("Selection outside visible lines")
+        {
+            sf::String text;
+            for (unsigned int i = 0; i < 1000; ++i)
+                text += "Line " + std::to_string(i) + "\n";
+
+            textBox->setSize(150, 100);
+            textBox->setText(text);
+            REQUIRE(textBox->getLinesCount() == 1001);
+
+            textBox->setSelectedText(0, 14);
+            REQUIRE(textBox->getSelectedText() == "Line 0\nLine 1\n");
+
+            textBox->setSelectedText(text.getSize() - 7, 7);
+            REQUIRE(textBox->getSelectedText() == text.substring(7, text.getSize() - 14));
+            REQUIRE(textBox->getCaretPosition() == 7);
+        }
     }
 
     SECTION("TextSize")
@@ -432,6 +450,58 @@ TEST_CASE("[TextBox]")
             textBox->textEntered('C');
             REQUIRE(textBox->getText() == "ABCDEFGHIJKLMNOPQRSTUVWXYZABC");
         }
+
+        SECTION("Typing in large text")
+        {
+            sf::String paragraph = "The quick brown fox jumps over the lazy dog.";
+            sf::String text;
+            for (unsigned int i = 0; i < 2000; ++i)
+                text += paragraph + "\n";
+
+            textBox->setText(text);
+            textBox->setCaretPosition(100 * (paragraph.getSize() + 1));
+
+            const sf::String typedText = "Some words typed in the middle of the text\nwith a newline";
+            for (const auto c : typedText)
+                textBox->textEntered(c);
+
+            sf::Event::KeyEvent event;
+            event.control = false;
+            event.alt     = false;
+            event.shift   = false;
+            event.system  = false;
+            event.code    = sf::Keyboard::BackSpace;
+            for (unsigned int i = 0; i < 5; ++i)
+                textBox->keyPressed(event);
+
+            text.insert(100 * (paragraph.getSize() + 1), typedText.substring(0, typedText.getSize() - 5));
+            REQUIRE(textBox->getText() == text);
+
+            // The lines have to be the same as when the whole text gets word-wrapped at once
+            auto textBox2 = tgui::TextBox::create();
+            textBox2->getRenderer()->setFont("resources/DejaVuSans.ttf");
+            textBox2->setSize(textBox->getSize());
+            textBox2->setTextSize(textBox->getTextSize());
+            textBox2->setText(text);
+            REQUIRE(textBox->getLinesCount() == textBox2->getLinesCount());
+            REQUIRE(textBox->getCaretPosition() == 100 * (paragraph.getSize() + 1) + typedText.getSize() - 5);
+
+            // Compare the contents of the lines around the edited paragraphs by moving the caret to the end of each line
+            event.code = sf::Keyboard::End;
+            auto getLineEnds = [&](const tgui::TextBox::Ptr& box){
+                std::vector<std::size_t> lineEnds;
+                std::size_t pos = 98 * (paragraph.getSize() + 1);
+                for (unsigned int i = 0; i < 10; ++i)
+                {
+                    box->setCaretPosition(pos);
+                    box->keyPressed(event);
+                    lineEnds.push_back(box->getCaretPosition());
+                    pos = lineEnds.back() + 1;
+                }
+                return lineEnds;
+            };
+            REQUIRE(getLineEnds(textBox) == getLineEnds(textBox2));
+        }
     }
 
     testWidgetRenderer(textBox->getRenderer());